@@ -622,6 +622,59 @@ TEST_F(TestBinaryBuilder, TestZeroLength) {
   Done();
 }
 
+TEST_F(TestBinaryBuilder, TestReserveValuesAndData) {
+  ASSERT_OK(builder_->Reserve(10, 1000));
+  ASSERT_GE(builder_->capacity(), 10);
+  ASSERT_GE(builder_->value_data_capacity(), 1000);
+  ASSERT_EQ(0, builder_->value_data_length());
+
+  ASSERT_RAISES(CapacityError, builder_->Reserve(1, kBinaryMemoryLimit + 1));
+}
+
+TEST_F(TestBinaryBuilder, TestAppendValuesStringViews) {
+  std::vector<util::string_view> values = {"abc", "", "defg", "xx", "hijkl"};
+  std::vector<uint8_t> valid_bytes = {1, 1, 0, 1, 1};
+
+  ASSERT_OK(builder_->Append("first"));
+  ASSERT_OK(builder_->AppendValues(values, valid_bytes.data()));
+  ASSERT_OK(builder_->AppendValues(values));
+  Done();
+
+  ASSERT_EQ(11, result_->length());
+  ASSERT_EQ(1, result_->null_count());
+  ASSERT_EQ("first", result_->GetString(0));
+  for (int64_t i = 0; i < 5; ++i) {
+    ASSERT_EQ(valid_bytes[i] == 0, result_->IsNull(i + 1));
+    if (valid_bytes[i]) {
+      ASSERT_EQ(values[i], result_->GetView(i + 1));
+    }
+    ASSERT_EQ(values[i], result_->GetView(i + 6));
+  }
+  ASSERT_EQ(5 + 10 + 14, result_->value_data()->size());
+}
+
+TEST_F(TestBinaryBuilder, TestAppendValuesOffsetsAndData) {
+  // Offsets need not start at zero: only the referenced data range is copied
+  const std::string data = "..abcdefgh..";
+  std::vector<int32_t> offsets = {2, 5, 5, 7, 10};
+  std::vector<uint8_t> valid_bytes = {1, 0, 1, 1};
+
+  ASSERT_OK(builder_->Append("xy"));
+  ASSERT_OK(builder_->AppendValues(offsets.data(),
+                                   reinterpret_cast<const uint8_t*>(data.data()), 4,
+                                   valid_bytes.data()));
+  ASSERT_OK(builder_->AppendNull());
+  ASSERT_OK(builder_->AppendValues(offsets.data(),
+                                   reinterpret_cast<const uint8_t*>(data.data()), 4));
+  ASSERT_OK(builder_->AppendValues(offsets.data(), nullptr, 0));
+  Done();
+
+  auto expected = ArrayFromJSON(
+      binary(), R"(["xy", "abc", null, "de", "fgh", null, "abc", "", "de", "fgh"])");
+  AssertArraysEqual(*expected, *result_);
+  ASSERT_EQ(2 + 8 + 8, result_->value_data()->size());
+}
+
 // ----------------------------------------------------------------------
 // Slice tests
 
@@ -68,6 +68,58 @@ Status BinaryBuilder::ReserveData(int64_t elements) {
                                         : Status::OK();
 }
 
+Status BinaryBuilder::AppendValues(const std::vector<util::string_view>& values,
+                                   const uint8_t* valid_bytes) {
+  const int64_t length = static_cast<int64_t>(values.size());
+  int64_t total_length = 0;
+  for (const auto& value : values) {
+    total_length += static_cast<int64_t>(value.size());
+  }
+  RETURN_NOT_OK(Reserve(length, total_length));
+
+  if (valid_bytes) {
+    for (int64_t i = 0; i < length; ++i) {
+      UnsafeAppendNextOffset();
+      if (valid_bytes[i]) {
+        value_data_builder_.UnsafeAppend(
+            reinterpret_cast<const uint8_t*>(values[i].data()), values[i].size());
+      }
+    }
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      UnsafeAppendNextOffset();
+      value_data_builder_.UnsafeAppend(reinterpret_cast<const uint8_t*>(values[i].data()),
+                                       values[i].size());
+    }
+  }
+
+  UnsafeAppendToBitmap(valid_bytes, length);
+  return Status::OK();
+}
+
+Status BinaryBuilder::AppendValues(const int32_t* offsets, const uint8_t* data,
+                                   int64_t length, const uint8_t* valid_bytes) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  const int32_t first_offset = offsets[0];
+  const int64_t total_length = offsets[length] - first_offset;
+  DCHECK_GE(total_length, 0);
+  RETURN_NOT_OK(Reserve(length, total_length));
+
+  // Rebase the incoming offsets onto the end of the current value data
+  const int32_t delta = static_cast<int32_t>(value_data_length()) - first_offset;
+  int32_t* out_offsets = offsets_builder_.mutable_data() + offsets_builder_.length();
+  for (int64_t i = 0; i < length; ++i) {
+    out_offsets[i] = offsets[i] + delta;
+  }
+  offsets_builder_.UnsafeAdvance(length);
+
+  value_data_builder_.UnsafeAppend(data + first_offset, total_length);
+  UnsafeAppendToBitmap(valid_bytes, length);
+  return Status::OK();
+}
+
 Status BinaryBuilder::AppendOverflow(int64_t num_bytes) {
   return Status::CapacityError("BinaryArray cannot contain more than ",
                                kBinaryMemoryLimit, " bytes, have ", num_bytes);
@@ -98,9 +98,45 @@ class ARROW_EXPORT BinaryBuilder : public ArrayBuilder {
     UnsafeAppendToBitmap(false);
   }
 
+  /// \brief Append a sequence of values in one shot.
+  ///
+  /// Offsets, validity and value data are each presized once, so the values
+  /// are copied without intermediate reallocations.
+  ///
+  /// \param[in] values a vector of views on the values to append
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const std::vector<util::string_view>& values,
+                      const uint8_t* valid_bytes = NULLPTR);
+
+  /// \brief Append a block of values laid out as in a BinaryArray.
+  ///
+  /// The value data between offsets[0] and offsets[length] is copied with a
+  /// single memcpy and the offsets are rebased onto the builder's data.
+  ///
+  /// \param[in] offsets length + 1 monotonic offsets into data
+  /// \param[in] data the value data referenced by offsets
+  /// \param[in] length the number of values to append
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const int32_t* offsets, const uint8_t* data, int64_t length,
+                      const uint8_t* valid_bytes = NULLPTR);
+
   void Reset() override;
   Status Resize(int64_t capacity) override;
 
+  using ArrayBuilder::Reserve;
+
+  /// \brief Ensures there is enough allocated capacity to append the indicated
+  /// number of values, holding the indicated total number of value bytes,
+  /// without additional allocations
+  Status Reserve(int64_t elements, int64_t data_bytes) {
+    ARROW_RETURN_NOT_OK(Reserve(elements));
+    return ReserveData(data_bytes);
+  }
+
   /// \brief Ensures there is enough allocated capacity to append the indicated
   /// number of bytes to the value data buffer without additional allocations
   Status ReserveData(int64_t elements);
@@ -150,6 +186,7 @@ class ARROW_EXPORT StringBuilder : public BinaryBuilder {
   explicit StringBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
 
   using BinaryBuilder::Append;
+  using BinaryBuilder::AppendValues;
   using BinaryBuilder::Reset;
   using BinaryBuilder::UnsafeAppend;
 
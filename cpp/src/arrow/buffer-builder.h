@@ -236,6 +236,12 @@ class TypedBufferBuilder<T, typename std::enable_if<std::is_arithmetic<T>::value
     return bytes_builder_.Advance(length * sizeof(T));
   }
 
+  // Advance pointer over elements already written through mutable_data(),
+  // without allocating or zeroing memory
+  void UnsafeAdvance(const int64_t length) {
+    bytes_builder_.UnsafeAdvance(length * sizeof(T));
+  }
+
   Status Finish(std::shared_ptr<Buffer>* out, bool shrink_to_fit = true) {
     return bytes_builder_.Finish(out, shrink_to_fit);
   }
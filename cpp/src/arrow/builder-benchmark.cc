@@ -179,6 +179,72 @@ static void BM_BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const
   state.SetBytesProcessed(state.iterations() * iterations * value.size());
 }
 
+static void BM_BuildBinaryArrayReserved(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // About 160MB
+  const int64_t iterations = 1 << 24;
+  std::string value = "1234567890";
+
+  for (auto _ : state) {
+    BinaryBuilder builder;
+    ABORT_NOT_OK(builder.Reserve(iterations, iterations * value.size()));
+    for (int64_t i = 0; i < iterations; i++) {
+      builder.UnsafeAppend(value);
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * value.size());
+}
+
+static void BM_BuildBinaryArrayBulkViews(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // About 160MB, appended in blocks of 64K values
+  const int64_t iterations = 1 << 24;
+  const int64_t block_size = 1 << 16;
+  std::string value = "1234567890";
+  std::vector<util::string_view> block(block_size, value);
+
+  for (auto _ : state) {
+    BinaryBuilder builder;
+    for (int64_t i = 0; i < iterations; i += block_size) {
+      ABORT_NOT_OK(builder.AppendValues(block));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * value.size());
+}
+
+static void BM_BuildBinaryArrayBulkOffsets(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // About 160MB, appended in blocks of 64K values with one memcpy per block
+  const int64_t iterations = 1 << 24;
+  const int64_t block_size = 1 << 16;
+  std::string value = "1234567890";
+  const int32_t value_size = static_cast<int32_t>(value.size());
+
+  std::string data;
+  std::vector<int32_t> offsets;
+  for (int64_t i = 0; i < block_size; i++) {
+    offsets.push_back(static_cast<int32_t>(data.size()));
+    data += value;
+  }
+  offsets.push_back(static_cast<int32_t>(data.size()));
+  const auto data_ptr = reinterpret_cast<const uint8_t*>(data.data());
+
+  for (auto _ : state) {
+    BinaryBuilder builder;
+    ABORT_NOT_OK(builder.Reserve(iterations, iterations * value_size));
+    for (int64_t i = 0; i < iterations; i += block_size) {
+      ABORT_NOT_OK(builder.AppendValues(offsets.data(), data_ptr, block_size));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * value.size());
+}
+
 static void BM_BuildChunkedBinaryArray(
     benchmark::State& state) {  // NOLINT non-const reference
   // About 160MB
@@ -394,6 +460,9 @@ BENCHMARK(BM_BuildAdaptiveUIntNoNullsScalarAppend)
     ->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_BuildBinaryArray)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildBinaryArrayReserved)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildBinaryArrayBulkViews)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildBinaryArrayBulkOffsets)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildChunkedBinaryArray)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildFixedSizeBinaryArray)->MinTime(3.0)->Unit(benchmark::kMicrosecond);
 
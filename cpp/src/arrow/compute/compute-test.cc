@@ -40,6 +40,7 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/selection-vector.h"
 #include "arrow/compute/test-util.h"
 
 namespace arrow {
@@ -67,6 +68,64 @@ TEST(TestDatum, ImplicitConstructors) {
   CheckImplicitConstructor<RecordBatch>(Datum::RECORD_BATCH);
 
   CheckImplicitConstructor<Table>(Datum::TABLE);
+
+  CheckImplicitConstructor<SelectionVector>(Datum::SELECTION_VECTOR);
+}
+
+// ----------------------------------------------------------------------
+// SelectionVector
+
+TEST(TestSelectionVector, FromMask) {
+  auto mask = ArrayFromJSON(boolean(), "[true, false, null, true, true, false]");
+  std::shared_ptr<SelectionVector> selection;
+  ASSERT_OK(SelectionVector::FromMask(default_memory_pool(), *mask, &selection));
+  ASSERT_OK(selection->Validate());
+  ASSERT_EQ(6, selection->array_length());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3, 4]"), *selection->indices());
+
+  // Positions are relative to the slice
+  ASSERT_OK(
+      SelectionVector::FromMask(default_memory_pool(), *mask->Slice(2), &selection));
+  ASSERT_EQ(4, selection->array_length());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2]"), *selection->indices());
+
+  ASSERT_RAISES(Invalid, SelectionVector::FromMask(default_memory_pool(),
+                                                   *ArrayFromJSON(int8(), "[1]"),
+                                                   &selection));
+}
+
+TEST(TestSelectionVector, AllAndToMask) {
+  std::shared_ptr<SelectionVector> selection;
+  ASSERT_OK(SelectionVector::All(default_memory_pool(), 4, &selection));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 1, 2, 3]"), *selection->indices());
+
+  std::shared_ptr<Array> mask;
+  ASSERT_OK(selection->ToMask(default_memory_pool(), &mask));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, true, true, true]"), *mask);
+
+  SelectionVector sparse(ArrayFromJSON(int32(), "[1, 3]"), 5);
+  ASSERT_OK(sparse.ToMask(default_memory_pool(), &mask));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, true, false, true, false]"),
+                    *mask);
+
+  ASSERT_OK(SelectionVector::All(default_memory_pool(), 0, &selection));
+  ASSERT_EQ(0, selection->length());
+}
+
+TEST(TestSelectionVector, ValidateAndEquals) {
+  SelectionVector a(ArrayFromJSON(int32(), "[0, 2]"), 3);
+  SelectionVector b(ArrayFromJSON(int32(), "[0, 2]"), 3);
+  ASSERT_TRUE(a.Equals(b));
+  ASSERT_FALSE(a.Equals(SelectionVector(ArrayFromJSON(int32(), "[0, 2]"), 4)));
+  ASSERT_FALSE(a.Equals(SelectionVector(ArrayFromJSON(int32(), "[0, 1]"), 3)));
+  ASSERT_TRUE(Datum(std::make_shared<SelectionVector>(a))
+                  .Equals(Datum(std::make_shared<SelectionVector>(b))));
+
+  ASSERT_OK(a.Validate());
+  ASSERT_RAISES(Invalid, SelectionVector(ArrayFromJSON(int32(), "[2, 0]"), 3).Validate());
+  ASSERT_RAISES(Invalid, SelectionVector(ArrayFromJSON(int32(), "[0, 3]"), 3).Validate());
+  ASSERT_RAISES(Invalid,
+                SelectionVector(ArrayFromJSON(int32(), "[0, null]"), 3).Validate());
 }
 
 class TestInvokeBinaryKernel : public ComputeFixture, public TestBase {};
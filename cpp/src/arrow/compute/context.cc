@@ -25,8 +25,10 @@
 namespace arrow {
 namespace compute {
 
-FunctionContext::FunctionContext(MemoryPool* pool)
-    : pool_(pool), cpu_info_(internal::CpuInfo::GetInstance()) {}
+FunctionContext::FunctionContext(MemoryPool* pool, internal::ThreadPool* thread_pool)
+    : pool_(pool),
+      thread_pool_(thread_pool),
+      cpu_info_(internal::CpuInfo::GetInstance()) {}
 
 MemoryPool* FunctionContext::memory_pool() const { return pool_; }
 
@@ -32,6 +32,7 @@ class Buffer;
 
 namespace internal {
 class CpuInfo;
+class ThreadPool;
 }  // namespace internal
 
 namespace compute {
@@ -46,9 +47,18 @@ namespace compute {
 /// \brief Container for variables and options used by function evaluation
 class ARROW_EXPORT FunctionContext {
  public:
-  explicit FunctionContext(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+  /// \brief Create a context
+  ///
+  /// \param[in] pool the memory pool for allocations
+  /// \param[in] thread_pool if not null, independent pieces of work (such as
+  /// the chunks of a ChunkedArray) are executed concurrently on this pool
+  explicit FunctionContext(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT,
+                           internal::ThreadPool* thread_pool = NULLPTR);
   MemoryPool* memory_pool() const;
 
+  /// \brief The thread pool for parallel execution, or null to run serially
+  internal::ThreadPool* thread_pool() const { return thread_pool_; }
+
   /// \brief Allocate buffer from the context's memory pool
   Status Allocate(const int64_t nbytes, std::shared_ptr<Buffer>* out);
 
@@ -73,6 +83,7 @@ class ARROW_EXPORT FunctionContext {
  private:
   Status status_;
   MemoryPool* pool_;
+  internal::ThreadPool* thread_pool_;
   internal::CpuInfo* cpu_info_;
 };
 
@@ -0,0 +1,235 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/expression-executor.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/logical_type.h"
+#include "arrow/compute/operations/arithmetic.h"
+#include "arrow/compute/operations/boolean.h"
+#include "arrow/compute/operations/cast.h"
+#include "arrow/compute/operations/compare.h"
+#include "arrow/compute/operations/field-ref.h"
+#include "arrow/compute/operations/literal.h"
+#include "arrow/compute/test-util.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestExpressionExecutor : public ComputeFixture, public TestBase {
+ protected:
+  void SetUp() override {
+    schema_ = ::arrow::schema(
+        {field("a", int32()), field("b", int32()), field("c", float64())});
+  }
+
+  static ExprPtr ToExpr(const std::shared_ptr<Operation>& op) {
+    ExprPtr expr;
+    ARROW_EXPECT_OK(op->ToExpr(&expr));
+    return expr;
+  }
+
+  ExprPtr Field(const std::string& name) {
+    return ToExpr(std::make_shared<ops::FieldRef>(schema_->GetFieldByName(name)));
+  }
+
+  static ExprPtr Literal(const std::shared_ptr<Scalar>& value) {
+    return ToExpr(std::make_shared<ops::Literal>(value));
+  }
+
+  static ExprPtr Add(const ExprPtr& left, const ExprPtr& right) {
+    return ToExpr(std::make_shared<ops::Arithmetic>(ops::Arithmetic::ADD, left, right));
+  }
+
+  static ExprPtr Multiply(const ExprPtr& left, const ExprPtr& right) {
+    return ToExpr(
+        std::make_shared<ops::Arithmetic>(ops::Arithmetic::MULTIPLY, left, right));
+  }
+
+  static ExprPtr Greater(const ExprPtr& left, const ExprPtr& right) {
+    return ToExpr(
+        std::make_shared<ops::Compare>(CompareOperator::GREATER, left, right));
+  }
+
+  std::shared_ptr<RecordBatch> MakeBatch(const std::string& a, const std::string& b,
+                                         const std::string& c) {
+    auto array_a = ArrayFromJSON(int32(), a);
+    return RecordBatch::Make(schema_, array_a->length(),
+                             {array_a, ArrayFromJSON(int32(), b),
+                              ArrayFromJSON(float64(), c)});
+  }
+
+  std::shared_ptr<Schema> schema_;
+};
+
+TEST_F(TestExpressionExecutor, Projection) {
+  // (a + b) * 2 > 10, a + b, cast(a, float64) + c, !(a > b)
+  auto sum = Add(Field("a"), Field("b"));
+  auto two = Literal(std::make_shared<Int32Scalar>(2));
+  auto exprs = std::vector<ExprPtr>{
+      Greater(Multiply(sum, two), Literal(std::make_shared<Int32Scalar>(10))), sum,
+      Add(ToExpr(std::make_shared<ops::Cast>(Field("a"), type::float64())), Field("c")),
+      ToExpr(std::make_shared<ops::Invert>(Greater(Field("a"), Field("b"))))};
+
+  std::unique_ptr<ExpressionExecutor> executor;
+  ASSERT_OK(ExpressionExecutor::Make(&this->ctx_, schema_, exprs, &executor));
+
+  std::vector<Datum> out;
+  ASSERT_OK(executor->Execute(
+      *MakeBatch("[1, 2, null, 4]", "[1, 5, 1, 0]", "[0.5, 1.5, 2.5, null]"), &out));
+  ASSERT_EQ(4, out.size());
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, true, null, false]"),
+                    *out[0].make_array());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, 7, null, 4]"), *out[1].make_array());
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[1.5, 3.5, null, null]"),
+                    *out[2].make_array());
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, true, null, false]"),
+                    *out[3].make_array());
+}
+
+TEST_F(TestExpressionExecutor, CommonSubexpressions) {
+  // a + b is computed once, even when built twice.
+  auto product = Multiply(Add(Field("a"), Field("b")), Add(Field("a"), Field("b")));
+  std::unique_ptr<ExpressionExecutor> executor;
+  ASSERT_OK(ExpressionExecutor::Make(&this->ctx_, schema_,
+                                     {product, Add(Field("a"), Field("b"))}, &executor));
+  ASSERT_EQ(4, executor->num_nodes());
+  ASSERT_EQ(2, executor->num_kernel_calls());
+
+  std::vector<Datum> out;
+  ASSERT_OK(executor->Execute(*MakeBatch("[1, 2]", "[2, null]", "[0, 0]"), &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[9, null]"), *out[0].make_array());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[3, null]"), *out[1].make_array());
+}
+
+TEST_F(TestExpressionExecutor, ConstantFolding) {
+  // a > (2 * 3 + 1) folds the right operand into the literal 7
+  auto seven = Add(Multiply(Literal(std::make_shared<Int32Scalar>(2)),
+                            Literal(std::make_shared<Int32Scalar>(3))),
+                   Literal(std::make_shared<Int32Scalar>(1)));
+  auto half = ToExpr(std::make_shared<ops::Cast>(
+      Literal(std::make_shared<Int32Scalar>(1)), type::float64()));
+  std::unique_ptr<ExpressionExecutor> executor;
+  ASSERT_OK(ExpressionExecutor::Make(&this->ctx_, schema_,
+                                     {Greater(Field("a"), seven), seven, half},
+                                     &executor));
+  ASSERT_EQ(4, executor->num_nodes());
+  ASSERT_EQ(1, executor->num_kernel_calls());
+
+  std::vector<Datum> out;
+  ASSERT_OK(executor->Execute(*MakeBatch("[5, 9, null]", "[0, 0, 0]", "[0, 0, 0]"),
+                              &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, true, null]"),
+                    *out[0].make_array());
+  ASSERT_EQ(Datum::SCALAR, out[1].kind());
+  ASSERT_TRUE(out[1].scalar()->Equals(Int32Scalar(7)));
+  ASSERT_TRUE(out[2].scalar()->Equals(DoubleScalar(1.0)));
+
+  // Null literals fold to null
+  auto null_sum = Add(Literal(std::make_shared<Int32Scalar>(0, false)),
+                      Literal(std::make_shared<Int32Scalar>(1)));
+  ASSERT_OK(ExpressionExecutor::Make(&this->ctx_, schema_, {null_sum}, &executor));
+  ASSERT_OK(executor->Execute(*MakeBatch("[1]", "[1]", "[1]"), &out));
+  ASSERT_FALSE(out[0].scalar()->is_valid);
+}
+
+// Count the allocations, to check which buffers are reused.
+class CountingMemoryPool : public MemoryPool {
+ public:
+  Status Allocate(int64_t size, uint8_t** out) override {
+    ++num_allocations;
+    return pool_->Allocate(size, out);
+  }
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override {
+    return pool_->Reallocate(old_size, new_size, ptr);
+  }
+  void Free(uint8_t* buffer, int64_t size) override { pool_->Free(buffer, size); }
+  int64_t bytes_allocated() const override { return pool_->bytes_allocated(); }
+
+  int num_allocations = 0;
+
+ private:
+  MemoryPool* pool_ = default_memory_pool();
+};
+
+TEST_F(TestExpressionExecutor, ReuseIntermediateBuffers) {
+  CountingMemoryPool pool;
+  FunctionContext ctx(&pool);
+  auto expr = Multiply(Add(Field("a"), Field("b")), Field("b"));
+  std::unique_ptr<ExpressionExecutor> executor;
+  ASSERT_OK(ExpressionExecutor::Make(&ctx, schema_, {expr}, &executor));
+
+  std::vector<Datum> out;
+  auto batch = MakeBatch("[1, 2, 3]", "[1, 1, 2]", "[0, 0, 0]");
+  ASSERT_OK(executor->Execute(*batch, &out));
+  auto first = out[0].make_array();
+  ASSERT_EQ(2, pool.num_allocations);
+
+  // Only the final result is allocated by the next batches.
+  ASSERT_OK(executor->Execute(*MakeBatch("[4, 5, 6]", "[2, 2, 0]", "[0, 0, 0]"), &out));
+  auto second = out[0].make_array();
+  ASSERT_EQ(3, pool.num_allocations);
+  ASSERT_OK(executor->Execute(*batch, &out));
+  ASSERT_EQ(4, pool.num_allocations);
+
+  // Unless the batch length changes.
+  ASSERT_OK(executor->Execute(*MakeBatch("[1]", "[1]", "[0]"), &out));
+  ASSERT_EQ(6, pool.num_allocations);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2]"), *out[0].make_array());
+
+  // Results of previous batches are left untouched.
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, 3, 10]"), *first);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[12, 14, 0]"), *second);
+}
+
+TEST_F(TestExpressionExecutor, Errors) {
+  std::unique_ptr<ExpressionExecutor> executor;
+  auto unknown = ToExpr(std::make_shared<ops::FieldRef>(field("z", int32())));
+  ASSERT_RAISES(Invalid, ExpressionExecutor::Make(&this->ctx_, schema_, {unknown},
+                                                  &executor));
+  auto mistyped = ToExpr(std::make_shared<ops::FieldRef>(field("a", int64())));
+  ASSERT_RAISES(Invalid, ExpressionExecutor::Make(&this->ctx_, schema_, {mistyped},
+                                                  &executor));
+  auto broadcast = ToExpr(std::make_shared<ops::Boolean>(
+      ops::Boolean::AND, Greater(Field("a"), Field("b")),
+      Literal(std::make_shared<BooleanScalar>(true))));
+  ASSERT_RAISES(NotImplemented, ExpressionExecutor::Make(&this->ctx_, schema_,
+                                                         {broadcast}, &executor));
+
+  ASSERT_OK(ExpressionExecutor::Make(&this->ctx_, schema_, {Field("a")}, &executor));
+  std::vector<Datum> out;
+  auto other = RecordBatch::Make(::arrow::schema({field("a", int32())}), 1,
+                                 {ArrayFromJSON(int32(), "[1]")});
+  ASSERT_RAISES(Invalid, executor->Execute(*other, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
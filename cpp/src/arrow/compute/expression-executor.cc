@@ -0,0 +1,518 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/compute/expression-executor.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/kernels/boolean.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/logical_type.h"
+#include "arrow/compute/operations/arithmetic.h"
+#include "arrow/compute/operations/boolean.h"
+#include "arrow/compute/operations/cast.h"
+#include "arrow/compute/operations/compare.h"
+#include "arrow/compute/operations/field-ref.h"
+#include "arrow/compute/operations/literal.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+Status ToArrowType(const LogicalType& ty, std::shared_ptr<DataType>* out) {
+  switch (ty.id()) {
+    case LogicalType::NULL_:
+      *out = null();
+      break;
+    case LogicalType::BOOL:
+      *out = boolean();
+      break;
+    case LogicalType::UINT8:
+      *out = uint8();
+      break;
+    case LogicalType::INT8:
+      *out = int8();
+      break;
+    case LogicalType::UINT16:
+      *out = uint16();
+      break;
+    case LogicalType::INT16:
+      *out = int16();
+      break;
+    case LogicalType::UINT32:
+      *out = uint32();
+      break;
+    case LogicalType::INT32:
+      *out = int32();
+      break;
+    case LogicalType::UINT64:
+      *out = uint64();
+      break;
+    case LogicalType::INT64:
+      *out = int64();
+      break;
+    case LogicalType::FLOAT16:
+      *out = float16();
+      break;
+    case LogicalType::FLOAT32:
+      *out = float32();
+      break;
+    case LogicalType::FLOAT64:
+      *out = float64();
+      break;
+    case LogicalType::BINARY:
+      *out = binary();
+      break;
+    case LogicalType::UTF8:
+      *out = utf8();
+      break;
+    default:
+      return Status::NotImplemented("Cannot evaluate expressions of logical type ",
+                                    ty.ToString());
+  }
+  return Status::OK();
+}
+
+// Constants are folded by evaluating the kernels on arrays of length 1.
+
+struct ScalarToArrayVisitor {
+  template <typename T>
+  enable_if_number<T, Status> Visit(const T&) {
+    using BuilderType = typename TypeTraits<T>::BuilderType;
+    using ScalarType = typename TypeTraits<T>::ScalarType;
+    auto typed_builder = checked_cast<BuilderType*>(builder);
+    if (!scalar.is_valid) {
+      return typed_builder->AppendNull();
+    }
+    return typed_builder->Append(checked_cast<const ScalarType&>(scalar).value);
+  }
+
+  Status Visit(const BooleanType&) {
+    auto typed_builder = checked_cast<BooleanBuilder*>(builder);
+    if (!scalar.is_valid) {
+      return typed_builder->AppendNull();
+    }
+    return typed_builder->Append(checked_cast<const BooleanScalar&>(scalar).value);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Cannot fold constants of type ", type);
+  }
+
+  const Scalar& scalar;
+  ArrayBuilder* builder;
+};
+
+struct ArrayToScalarVisitor {
+  template <typename T>
+  enable_if_number<T, Status> Visit(const T&) {
+    using ScalarType = typename TypeTraits<T>::ScalarType;
+    const auto& values = checked_cast<const NumericArray<T>&>(array);
+    *out = std::make_shared<ScalarType>(values.Value(0), array.IsValid(0));
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    const auto& values = checked_cast<const BooleanArray&>(array);
+    *out = std::make_shared<BooleanScalar>(values.Value(0), array.IsValid(0));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Cannot fold constants of type ", type);
+  }
+
+  const Array& array;
+  std::shared_ptr<Scalar>* out;
+};
+
+Status ScalarToArray(MemoryPool* pool, const Scalar& scalar,
+                     std::shared_ptr<Array>* out) {
+  std::unique_ptr<ArrayBuilder> builder;
+  RETURN_NOT_OK(MakeBuilder(pool, scalar.type, &builder));
+  ScalarToArrayVisitor visitor{scalar, builder.get()};
+  RETURN_NOT_OK(VisitTypeInline(*scalar.type, &visitor));
+  return builder->Finish(out);
+}
+
+// A node of the compiled program. The inputs of a node always precede it.
+struct ExpressionNode {
+  enum Kind { LITERAL, FIELD, CAST, ARITHMETIC, COMPARE, BOOLEAN, INVERT };
+
+  Kind kind;
+  // The ops::Arithmetic, ops::Boolean or CompareOperator of the node.
+  int op = 0;
+  int field_index = -1;
+  std::vector<int> inputs;
+  std::shared_ptr<DataType> type;
+  // Whether the kernel writes the next batch over the output buffers, which
+  // only the executor refers to: false for the results, and for the inputs
+  // of casts which may share them.
+  bool reuse_output = false;
+  // The literal value, or the output of the last batch.
+  Datum value;
+};
+
+}  // namespace
+
+class ExpressionExecutor::Impl {
+ public:
+  Impl(FunctionContext* ctx, const std::shared_ptr<Schema>& schema)
+      : ctx_(ctx), schema_(schema) {}
+
+  Status Compile(const std::vector<ExprPtr>& exprs) {
+    for (const auto& expr : exprs) {
+      int index;
+      RETURN_NOT_OK(Compile(expr, &index));
+      results_.push_back(index);
+    }
+    Prune();
+    for (auto& node : nodes_) {
+      node.reuse_output = node.kind != ExpressionNode::LITERAL &&
+                          node.kind != ExpressionNode::FIELD;
+    }
+    for (const auto& node : nodes_) {
+      if (node.kind == ExpressionNode::CAST) {
+        nodes_[node.inputs[0]].reuse_output = false;
+      }
+    }
+    for (int index : results_) {
+      nodes_[index].reuse_output = false;
+    }
+    return Status::OK();
+  }
+
+  Status Execute(const RecordBatch& batch, std::vector<Datum>* out) {
+    if (!batch.schema()->Equals(*schema_, false /* check_metadata */)) {
+      return Status::Invalid("Batch schema does not match the executor schema");
+    }
+    std::vector<Datum> args;
+    for (auto& node : nodes_) {
+      switch (node.kind) {
+        case ExpressionNode::LITERAL:
+          break;
+        case ExpressionNode::FIELD:
+          node.value = Datum(batch.column_data(node.field_index));
+          break;
+        default: {
+          args.clear();
+          for (int input : node.inputs) {
+            args.push_back(nodes_[input].value);
+          }
+          if (!node.reuse_output) {
+            node.value = Datum();
+          }
+          RETURN_NOT_OK(Evaluate(node, args, &node.value));
+        }
+      }
+    }
+
+    out->clear();
+    for (int index : results_) {
+      out->push_back(nodes_[index].value);
+    }
+    // Only keep the buffers which are reused.
+    for (auto& node : nodes_) {
+      if (!node.reuse_output && node.kind != ExpressionNode::LITERAL) {
+        node.value = Datum();
+      }
+    }
+    return Status::OK();
+  }
+
+  int num_nodes() const { return static_cast<int>(nodes_.size()); }
+
+  int num_kernel_calls() const {
+    int count = 0;
+    for (const auto& node : nodes_) {
+      count += node.kind != ExpressionNode::LITERAL && node.kind != ExpressionNode::FIELD;
+    }
+    return count;
+  }
+
+ private:
+  Status Compile(const ExprPtr& expr, int* out) {
+    if (!InheritsFrom<ValueExpr>(*expr)) {
+      return Status::Invalid("Only value expressions can be evaluated");
+    }
+    const Operation* op = expr->op().get();
+    ExpressionNode node;
+
+    if (auto literal = dynamic_cast<const ops::Literal*>(op)) {
+      node.kind = ExpressionNode::LITERAL;
+      node.type = literal->value()->type;
+      node.value = Datum(literal->value());
+      return AddNode(std::move(node), out);
+    }
+    if (auto ref = dynamic_cast<const ops::FieldRef*>(op)) {
+      const Field& field = *ref->field();
+      node.kind = ExpressionNode::FIELD;
+      node.field_index = schema_->GetFieldIndex(field.name());
+      if (node.field_index < 0) {
+        return Status::Invalid("No field named '", field.name(), "' in the schema");
+      }
+      node.type = schema_->field(node.field_index)->type();
+      if (!node.type->Equals(*field.type())) {
+        return Status::Invalid("Field '", field.name(), "' has type ", *node.type,
+                               " in the schema, but ", *field.type(),
+                               " in the expression");
+      }
+      return AddNode(std::move(node), out);
+    }
+
+    if (auto cast = dynamic_cast<const ops::Cast*>(op)) {
+      node.kind = ExpressionNode::CAST;
+      RETURN_NOT_OK(ToArrowType(*cast->out_type(), &node.type));
+    } else if (auto arithmetic = dynamic_cast<const ops::Arithmetic*>(op)) {
+      node.kind = ExpressionNode::ARITHMETIC;
+      node.op = arithmetic->op();
+    } else if (auto compare = dynamic_cast<const ops::Compare*>(op)) {
+      node.kind = ExpressionNode::COMPARE;
+      node.op = compare->op();
+      node.type = boolean();
+    } else if (auto connective = dynamic_cast<const ops::Boolean*>(op)) {
+      node.kind = ExpressionNode::BOOLEAN;
+      node.op = connective->op();
+      node.type = boolean();
+    } else if (dynamic_cast<const ops::Invert*>(op) != nullptr) {
+      node.kind = ExpressionNode::INVERT;
+      node.type = boolean();
+    } else {
+      return Status::NotImplemented("Cannot evaluate an ", expr->kind(),
+                                    " expression of this operation");
+    }
+
+    for (const auto& arg : op->input_args()) {
+      int input;
+      RETURN_NOT_OK(Compile(arg, &input));
+      node.inputs.push_back(input);
+    }
+    if (node.kind == ExpressionNode::ARITHMETIC) {
+      node.type = nodes_[node.inputs[0]].type;
+    }
+    for (int input : node.inputs) {
+      if (node.kind != ExpressionNode::CAST &&
+          !nodes_[input].type->Equals(*nodes_[node.inputs[0]].type)) {
+        return Status::Invalid("Operands of an ", expr->kind(),
+                               " expression have different types ",
+                               *nodes_[node.inputs[0]].type, " and ",
+                               *nodes_[input].type);
+      }
+    }
+    return AddNode(std::move(node), out);
+  }
+
+  // Append a node, unless it is constant and folded into a literal, or an
+  // equivalent node already exists.
+  Status AddNode(ExpressionNode node, int* out) {
+    if (node.kind == ExpressionNode::LITERAL) {
+      for (size_t i = 0; i < nodes_.size(); ++i) {
+        if (nodes_[i].kind == ExpressionNode::LITERAL &&
+            nodes_[i].value.scalar()->Equals(node.value.scalar())) {
+          *out = static_cast<int>(i);
+          return Status::OK();
+        }
+      }
+      return AppendNode(std::move(node), "", out);
+    }
+
+    bool all_literals = node.kind != ExpressionNode::FIELD;
+    int num_literals = 0;
+    for (int input : node.inputs) {
+      bool is_literal = nodes_[input].kind == ExpressionNode::LITERAL;
+      all_literals &= is_literal;
+      num_literals += is_literal;
+    }
+    if (all_literals) {
+      return Fold(node, out);
+    }
+    if (node.kind == ExpressionNode::BOOLEAN && num_literals > 0) {
+      return Status::NotImplemented("Boolean kernels cannot broadcast a scalar");
+    }
+
+    std::stringstream ss;
+    ss << node.kind << ':' << node.op << ':' << node.field_index << ':'
+       << node.type->ToString();
+    for (int input : node.inputs) {
+      ss << ',' << input;
+    }
+    std::string signature = ss.str();
+    auto it = signatures_.find(signature);
+    if (it != signatures_.end()) {
+      *out = it->second;
+      return Status::OK();
+    }
+    return AppendNode(std::move(node), signature, out);
+  }
+
+  Status AppendNode(ExpressionNode node, const std::string& signature, int* out) {
+    *out = static_cast<int>(nodes_.size());
+    nodes_.push_back(std::move(node));
+    if (!signature.empty()) {
+      signatures_[signature] = *out;
+    }
+    return Status::OK();
+  }
+
+  Status Fold(const ExpressionNode& node, int* out) {
+    std::vector<Datum> args;
+    for (int input : node.inputs) {
+      std::shared_ptr<Array> arg;
+      RETURN_NOT_OK(ScalarToArray(ctx_->memory_pool(), *nodes_[input].value.scalar(),
+                                  &arg));
+      args.emplace_back(arg);
+    }
+    Datum result;
+    RETURN_NOT_OK(Evaluate(node, args, &result));
+
+    ExpressionNode literal;
+    literal.kind = ExpressionNode::LITERAL;
+    literal.type = node.type;
+    std::shared_ptr<Scalar> value;
+    auto array = result.make_array();
+    ArrayToScalarVisitor visitor{*array, &value};
+    RETURN_NOT_OK(VisitTypeInline(*array->type(), &visitor));
+    literal.value = Datum(value);
+    return AddNode(std::move(literal), out);
+  }
+
+  Status Evaluate(const ExpressionNode& node, const std::vector<Datum>& args,
+                  Datum* out) {
+    switch (node.kind) {
+      case ExpressionNode::CAST:
+        return Cast(ctx_, args[0], node.type, CastOptions(), out);
+      case ExpressionNode::ARITHMETIC: {
+        ArithmeticOptions options;
+        options.reuse_output = node.reuse_output;
+        switch (node.op) {
+          case ops::Arithmetic::ADD:
+            return Add(ctx_, args[0], args[1], options, out);
+          case ops::Arithmetic::SUBTRACT:
+            return Subtract(ctx_, args[0], args[1], options, out);
+          case ops::Arithmetic::MULTIPLY:
+            return Multiply(ctx_, args[0], args[1], options, out);
+          default:
+            return Divide(ctx_, args[0], args[1], options, out);
+        }
+      }
+      case ExpressionNode::COMPARE: {
+        CompareOptions options(static_cast<CompareOperator>(node.op));
+        options.reuse_output = node.reuse_output;
+        return Compare(ctx_, args[0], args[1], options, out);
+      }
+      case ExpressionNode::BOOLEAN:
+        switch (node.op) {
+          case ops::Boolean::AND:
+            return And(ctx_, args[0], args[1], out);
+          case ops::Boolean::OR:
+            return Or(ctx_, args[0], args[1], out);
+          default:
+            return Xor(ctx_, args[0], args[1], out);
+        }
+      case ExpressionNode::INVERT:
+        return Invert(ctx_, args[0], out);
+      default:
+        return Status::Invalid("Not a kernel node");
+    }
+  }
+
+  // Drop the nodes which were folded away, renumbering the others.
+  void Prune() {
+    std::vector<bool> used(nodes_.size(), false);
+    for (int index : results_) {
+      used[index] = true;
+    }
+    for (int i = static_cast<int>(nodes_.size()) - 1; i >= 0; --i) {
+      if (used[i]) {
+        for (int input : nodes_[i].inputs) {
+          used[input] = true;
+        }
+      }
+    }
+    std::vector<int> renumbered(nodes_.size(), -1);
+    std::vector<ExpressionNode> nodes;
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+      if (used[i]) {
+        renumbered[i] = static_cast<int>(nodes.size());
+        nodes.push_back(std::move(nodes_[i]));
+        for (int& input : nodes.back().inputs) {
+          input = renumbered[input];
+        }
+      }
+    }
+    for (int& index : results_) {
+      index = renumbered[index];
+    }
+    nodes_ = std::move(nodes);
+    signatures_.clear();
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<ExpressionNode> nodes_;
+  std::vector<int> results_;
+  std::unordered_map<std::string, int> signatures_;
+};
+
+ExpressionExecutor::ExpressionExecutor(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+ExpressionExecutor::~ExpressionExecutor() {}
+
+Status ExpressionExecutor::Make(FunctionContext* context,
+                                const std::shared_ptr<Schema>& schema,
+                                const std::vector<ExprPtr>& exprs,
+                                std::unique_ptr<ExpressionExecutor>* out) {
+  std::unique_ptr<Impl> impl(new Impl(context, schema));
+  RETURN_NOT_OK(impl->Compile(exprs));
+  out->reset(new ExpressionExecutor(std::move(impl)));
+  return Status::OK();
+}
+
+Status ExpressionExecutor::Execute(const RecordBatch& batch, std::vector<Datum>* out) {
+  return impl_->Execute(batch, out);
+}
+
+int ExpressionExecutor::num_nodes() const { return impl_->num_nodes(); }
+
+int ExpressionExecutor::num_kernel_calls() const { return impl_->num_kernel_calls(); }
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/type_fwd.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class Schema;
+
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+
+/// \class ExpressionExecutor
+/// \brief Evaluate expressions against record batches with the kernels
+///
+/// The expressions are compiled once into a flat program of kernel calls,
+/// then evaluated a batch at a time without any code generation. Compiling:
+///
+/// - binds the ops::FieldRef of the expressions to the columns of the schema
+///   with the same name and type;
+/// - eliminates common subexpressions, so that an operation applied to the
+///   same inputs is evaluated once per batch even if several expressions
+///   share it;
+/// - folds the operations whose inputs are all literals into a literal.
+///
+/// Supported operations are ops::FieldRef, ops::Literal, ops::Cast,
+/// ops::Arithmetic, ops::Compare, ops::Boolean and ops::Invert.
+///
+/// The buffers of intermediate results are written over by the next batch
+/// when the kernel supports it, so a batch allocates nothing but the final
+/// results as long as the batch length does not change. Final results are
+/// always newly allocated, and remain valid after the next batch.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT ExpressionExecutor {
+ public:
+  ~ExpressionExecutor();
+
+  /// \brief Compile expressions for evaluation against batches of a schema
+  ///
+  /// \param[in] context the FunctionContext of the kernel calls
+  /// \param[in] schema the schema of the batches to evaluate
+  /// \param[in] exprs the value expressions to evaluate
+  /// \param[out] out the compiled executor
+  static Status Make(FunctionContext* context, const std::shared_ptr<Schema>& schema,
+                     const std::vector<ExprPtr>& exprs,
+                     std::unique_ptr<ExpressionExecutor>* out);
+
+  /// \brief Evaluate the expressions against a batch
+  ///
+  /// \param[in] batch a batch of the schema given to Make
+  /// \param[out] out one datum per expression, an Array for array
+  ///             expressions or a Scalar for scalar expressions
+  Status Execute(const RecordBatch& batch, std::vector<Datum>* out);
+
+  /// \brief The number of distinct operations after folding and elimination
+  /// of common subexpressions
+  int num_nodes() const;
+
+  /// \brief The number of kernel calls per batch
+  int num_kernel_calls() const;
+
+ private:
+  class Impl;
+  explicit ExpressionExecutor(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
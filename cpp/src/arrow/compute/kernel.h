@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/compute/selection-vector.h"
 #include "arrow/record_batch.h"
 #include "arrow/scalar.h"
 #include "arrow/table.h"
@@ -67,11 +68,21 @@ static inline bool CollectionEquals(const std::vector<Datum>& left,
 /// \class Datum
 /// \brief Variant type for various Arrow C++ data structures
 struct ARROW_EXPORT Datum {
-  enum type { NONE, SCALAR, ARRAY, CHUNKED_ARRAY, RECORD_BATCH, TABLE, COLLECTION };
+  enum type {
+    NONE,
+    SCALAR,
+    ARRAY,
+    CHUNKED_ARRAY,
+    RECORD_BATCH,
+    TABLE,
+    COLLECTION,
+    SELECTION_VECTOR
+  };
 
   util::variant<decltype(NULLPTR), std::shared_ptr<Scalar>, std::shared_ptr<ArrayData>,
                 std::shared_ptr<ChunkedArray>, std::shared_ptr<RecordBatch>,
-                std::shared_ptr<Table>, std::vector<Datum>>
+                std::shared_ptr<Table>, std::vector<Datum>,
+                std::shared_ptr<SelectionVector>>
       value;
 
   /// \brief Empty datum, to be populated elsewhere
@@ -93,6 +104,8 @@ struct ARROW_EXPORT Datum {
       : value(value) {}
   Datum(const std::vector<Datum>& value)  // NOLINT implicit conversion
       : value(value) {}
+  Datum(const std::shared_ptr<SelectionVector>& value)  // NOLINT implicit conversion
+      : value(value) {}
 
   // Cast from subtypes of Array to Datum
   template <typename T,
@@ -141,6 +154,8 @@ struct ARROW_EXPORT Datum {
         return Datum::TABLE;
       case 6:
         return Datum::COLLECTION;
+      case 7:
+        return Datum::SELECTION_VECTOR;
       default:
         return Datum::NONE;
     }
@@ -174,6 +189,10 @@ struct ARROW_EXPORT Datum {
     return util::get<std::shared_ptr<Scalar>>(this->value);
   }
 
+  std::shared_ptr<SelectionVector> selection_vector() const {
+    return util::get<std::shared_ptr<SelectionVector>>(this->value);
+  }
+
   bool is_array() const { return this->kind() == Datum::ARRAY; }
 
   bool is_arraylike() const {
@@ -214,6 +233,9 @@ struct ARROW_EXPORT Datum {
         return internal::SharedPtrEquals(this->table(), other.table());
       case Datum::COLLECTION:
         return CollectionEquals(this->collection(), other.collection());
+      case Datum::SELECTION_VECTOR:
+        return internal::SharedPtrEquals(this->selection_vector(),
+                                         other.selection_vector());
       default:
         return false;
     }
@@ -33,6 +33,7 @@
 #include "arrow/compute/benchmark-util.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/minmax.h"
 #include "arrow/compute/kernels/sum.h"
 
 namespace arrow {
@@ -330,5 +331,26 @@ static void RegressionSumKernel(benchmark::State& state) {
 
 BENCHMARK(RegressionSumKernel)->Apply(RegressionSetArgs);
 
+static void RegressionMinMaxKernel(benchmark::State& state) {
+  const int64_t array_size = state.range(0) / sizeof(int64_t);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = std::static_pointer_cast<NumericArray<Int64Type>>(
+      rand.Int64(array_size, -100, 100, null_percent));
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(MinMax(&ctx, MinMaxOptions(), Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(state.range(0));
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+}
+
+BENCHMARK(RegressionMinMaxKernel)->Apply(RegressionSetArgs);
+
 }  // namespace compute
 }  // namespace arrow
@@ -16,9 +16,11 @@
 // under the License.
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -26,12 +28,17 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/count.h"
 #include "arrow/compute/kernels/mean.h"
+#include "arrow/compute/kernels/minmax.h"
 #include "arrow/compute/kernels/sum-internal.h"
 #include "arrow/compute/kernels/sum.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/selection-vector.h"
 #include "arrow/compute/test-util.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/thread-pool.h"
 
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -242,6 +249,181 @@ TYPED_TEST(TestRandomNumericMeanKernel, RandomArrayMean) {
   }
 }
 
+///
+/// MinMax
+///
+
+template <typename ArrowType>
+struct MinMaxResult {
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  CType min = std::numeric_limits<CType>::max();
+  CType max = std::numeric_limits<CType>::lowest();
+  bool is_valid = false;
+};
+
+template <typename ArrowType>
+static MinMaxResult<ArrowType> NaiveMinMax(const Array& array,
+                                           const MinMaxOptions& options) {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  MinMaxResult<ArrowType> result;
+  const auto& values = internal::checked_cast<const ArrayType&>(array);
+  for (int64_t i = 0; i < values.length(); i++) {
+    if (values.IsValid(i)) {
+      result.min = std::min(result.min, values.Value(i));
+      result.max = std::max(result.max, values.Value(i));
+      result.is_valid = true;
+    }
+  }
+
+  if (options.null_handling == MinMaxOptions::OUTPUT_NULL && array.null_count() > 0) {
+    result.is_valid = false;
+  }
+  return result;
+}
+
+template <typename ArrowType>
+void ValidateMinMax(FunctionContext* ctx, const MinMaxOptions& options,
+                    const Array& input, const MinMaxResult<ArrowType>& expected) {
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  Datum result;
+  ASSERT_OK(MinMax(ctx, options, input, &result));
+  ASSERT_EQ(Datum::COLLECTION, result.kind());
+  const auto out = result.collection();
+  ASSERT_EQ(2, out.size());
+
+  const auto& min = internal::checked_cast<const ScalarType&>(*out[0].scalar());
+  const auto& max = internal::checked_cast<const ScalarType&>(*out[1].scalar());
+  ASSERT_TRUE(min.type->Equals(*input.type()));
+  ASSERT_TRUE(max.type->Equals(*input.type()));
+  ASSERT_EQ(expected.is_valid, min.is_valid);
+  ASSERT_EQ(expected.is_valid, max.is_valid);
+  if (expected.is_valid) {
+    ASSERT_EQ(expected.min, min.value);
+    ASSERT_EQ(expected.max, max.value);
+  }
+}
+
+// The expected extrema are given as an array to reuse NaiveMinMax.
+template <typename ArrowType>
+void ValidateMinMax(FunctionContext* ctx, const MinMaxOptions& options,
+                    const std::shared_ptr<DataType>& type, const char* json,
+                    const char* expected_json) {
+  auto array = ArrayFromJSON(type, json);
+  auto expected = ArrayFromJSON(type, expected_json);
+  ValidateMinMax<ArrowType>(ctx, options, *array,
+                            NaiveMinMax<ArrowType>(*expected, options));
+}
+
+template <typename ArrowType>
+void ValidateMinMax(FunctionContext* ctx, const MinMaxOptions& options,
+                    const Array& array) {
+  ValidateMinMax<ArrowType>(ctx, options, array, NaiveMinMax<ArrowType>(array, options));
+}
+
+template <typename ArrowType>
+class TestMinMaxKernelNumeric : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestMinMaxKernelNumeric, NumericArrowTypes);
+TYPED_TEST(TestMinMaxKernelNumeric, SimpleMinMax) {
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  MinMaxOptions skip;
+  MinMaxOptions output_null(MinMaxOptions::OUTPUT_NULL);
+
+  ValidateMinMax<TypeParam>(&this->ctx_, skip, type, "[]", "[]");
+  ValidateMinMax<TypeParam>(&this->ctx_, skip, type, "[null, null]", "[]");
+  ValidateMinMax<TypeParam>(&this->ctx_, skip, type, "[5, 1, 2, 3, 4]", "[1, 5]");
+  ValidateMinMax<TypeParam>(&this->ctx_, skip, type, "[5, null, 2, 3, 4]", "[2, 5]");
+  ValidateMinMax<TypeParam>(&this->ctx_, output_null, type, "[5, 1, 2, 3, 4]", "[1, 5]");
+
+  // All null, as a null is present
+  ValidateMinMax<TypeParam>(&this->ctx_, output_null, type, "[5, null, 2]", "[]");
+}
+
+TYPED_TEST(TestMinMaxKernelNumeric, Merge) {
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  auto aggregate = MakeMinMaxAggregateFunction(type, &this->ctx_, MinMaxOptions());
+  ASSERT_NE(nullptr, aggregate);
+
+  std::vector<uint8_t> left(aggregate->Size()), right(aggregate->Size());
+  aggregate->New(left.data());
+  aggregate->New(right.data());
+  ASSERT_OK(aggregate->Consume(*ArrayFromJSON(type, "[3, null, 7]"), left.data()));
+  ASSERT_OK(aggregate->Consume(*ArrayFromJSON(type, "[5, 2]"), right.data()));
+  ASSERT_OK(aggregate->Merge(right.data(), left.data()));
+
+  Datum result;
+  ASSERT_OK(aggregate->Finalize(left.data(), &result));
+  Datum expected;
+  ASSERT_OK(MinMax(&this->ctx_, MinMaxOptions(),
+                   *ArrayFromJSON(type, "[3, null, 7, 5, 2]"), &expected));
+  AssertDatumsEqual(expected, result);
+  aggregate->Delete(left.data());
+  aggregate->Delete(right.data());
+}
+
+template <typename ArrowType>
+class TestRandomNumericMinMaxKernel : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestRandomNumericMinMaxKernel, NumericArrowTypes);
+TYPED_TEST(TestRandomNumericMinMaxKernel, RandomArrayMinMax) {
+  auto rand = random::RandomArrayGenerator(0x8afc056);
+  for (size_t i = 3; i < 14; i++) {
+    for (auto null_probability : {0.0, 0.01, 0.1, 0.5, 0.99, 1.0}) {
+      for (auto length_adjust : {-2, -1, 0, 1, 2}) {
+        int64_t length = (1UL << i) + length_adjust;
+        auto array = rand.Numeric<TypeParam>(length, 0, 100, null_probability);
+        ValidateMinMax<TypeParam>(&this->ctx_, MinMaxOptions(), *array);
+        ValidateMinMax<TypeParam>(&this->ctx_, MinMaxOptions(MinMaxOptions::OUTPUT_NULL),
+                                  *array);
+      }
+    }
+  }
+}
+
+TYPED_TEST(TestRandomNumericMinMaxKernel, RandomSliceArrayMinMax) {
+  // Exercise validity words that are not byte-aligned.
+  auto rand = random::RandomArrayGenerator(0x8afc057);
+  auto array = rand.Numeric<TypeParam>(1024, 0, 100, 0.1);
+  for (int64_t offset : {1, 7, 13, 64, 127}) {
+    for (int64_t length : {0, 1, 63, 64, 65, 200, 500}) {
+      ValidateMinMax<TypeParam>(&this->ctx_, MinMaxOptions(),
+                                *array->Slice(offset, length));
+    }
+  }
+}
+
+class TestMinMaxKernel : public ComputeFixture, public TestBase {};
+
+TEST_F(TestMinMaxKernel, Temporal) {
+  ValidateMinMax<Date32Type>(&this->ctx_, MinMaxOptions(), date32(),
+                             "[10, null, -5, 3]", "[-5, 10]");
+  ValidateMinMax<Date64Type>(&this->ctx_, MinMaxOptions(), date64(),
+                             "[86400000, null, 0]", "[0, 86400000]");
+  ValidateMinMax<Time32Type>(&this->ctx_, MinMaxOptions(), time32(TimeUnit::SECOND),
+                             "[3, 2, null, 1]", "[1, 3]");
+  ValidateMinMax<Time64Type>(&this->ctx_, MinMaxOptions(), time64(TimeUnit::NANO),
+                             "[3, 2, null, 1]", "[1, 3]");
+  ValidateMinMax<TimestampType>(&this->ctx_, MinMaxOptions(),
+                                timestamp(TimeUnit::MILLI, "UTC"), "[3, null, -1]",
+                                "[-1, 3]");
+}
+
+TEST_F(TestMinMaxKernel, NaN) {
+  ValidateMinMax<DoubleType>(&this->ctx_, MinMaxOptions(), float64(),
+                             "[NaN, 2.5, null, -1.0, NaN]", "[-1.0, 2.5]");
+  ValidateMinMax<FloatType>(&this->ctx_, MinMaxOptions(), float32(), "[NaN, null]",
+                            "[]");
+}
+
+TEST_F(TestMinMaxKernel, Unsupported) {
+  Datum result;
+  ASSERT_RAISES(Invalid, MinMax(&this->ctx_, MinMaxOptions(),
+                                *ArrayFromJSON(utf8(), R"(["a"])"), &result));
+}
+
 ///
 /// Count
 ///
@@ -308,5 +490,101 @@ TYPED_TEST(TestRandomNumericCountKernel, RandomArrayCount) {
   }
 }
 
+///
+/// ChunkedArray aggregation
+///
+
+template <typename ArrowType>
+class TestChunkedAggregate : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestChunkedAggregate, NumericArrowTypes);
+TYPED_TEST(TestChunkedAggregate, MatchesContiguous) {
+  using SumType = typename FindAccumulatorType<TypeParam>::Type;
+
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(4, &pool));
+  FunctionContext parallel_ctx(default_memory_pool(), pool.get());
+
+  auto rand = random::RandomArrayGenerator(0x3429ab);
+  auto array = rand.Numeric<TypeParam>(1000, 0, 100, 0.1);
+  ArrayVector chunks = {array->Slice(0, 10), array->Slice(10, 0), array->Slice(10, 290),
+                        array->Slice(300, 699), array->Slice(999, 1)};
+  auto chunked = std::make_shared<ChunkedArray>(chunks);
+
+  Datum expected_min_max;
+  ASSERT_OK(MinMax(&this->ctx_, MinMaxOptions(), *array, &expected_min_max));
+
+  for (FunctionContext* ctx : {&this->ctx_, &parallel_ctx}) {
+    Datum result;
+    ASSERT_OK(Sum(ctx, chunked, &result));
+    DatumEqual<SumType>::EnsureEqual(result, NaiveSum<TypeParam>(*array));
+
+    ASSERT_OK(Count(ctx, CountOptions(CountOptions::COUNT_ALL), chunked, &result));
+    AssertDatumsEqual(result, Datum(NaiveCount(*array).first));
+
+    ASSERT_OK(MinMax(ctx, MinMaxOptions(), chunked, &result));
+    AssertDatumsEqual(result, expected_min_max);
+  }
+
+  Datum result;
+  auto empty = std::make_shared<ChunkedArray>(ArrayVector{}, array->type());
+  ASSERT_OK(Count(&parallel_ctx, CountOptions(CountOptions::COUNT_ALL), empty, &result));
+  AssertDatumsEqual(result, Datum(static_cast<int64_t>(0)));
+}
+
+///
+/// Aggregation of a selection
+///
+
+template <typename ArrowType>
+class TestSelectionAggregate : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestSelectionAggregate, NumericArrowTypes);
+TYPED_TEST(TestSelectionAggregate, MatchesTaken) {
+  using SumType = typename FindAccumulatorType<TypeParam>::Type;
+
+  auto rand = random::RandomArrayGenerator(0x3429ac);
+  for (auto null_probability : {0.0, 0.1}) {
+    auto array = rand.Numeric<TypeParam>(1000, 0, 100, null_probability)->Slice(3);
+    auto mask = rand.Boolean(array->length(), 0.3, 0.1);
+    std::shared_ptr<SelectionVector> selection;
+    ASSERT_OK(SelectionVector::FromMask(default_memory_pool(), *mask, &selection));
+
+    std::shared_ptr<Array> taken;
+    ASSERT_OK(Take(&this->ctx_, *array, *selection->indices(), TakeOptions(), &taken));
+
+    Datum expected, result;
+    ASSERT_OK(Sum(&this->ctx_, *taken, &expected));
+    ASSERT_OK(Sum(&this->ctx_, array, *selection, &result));
+    // Floating point sums may be accumulated in a different order
+    DatumEqual<SumType>::EnsureEqual(result, expected);
+
+    ASSERT_OK(Mean(&this->ctx_, *taken, &expected));
+    ASSERT_OK(Mean(&this->ctx_, array, *selection, &result));
+    DatumEqual<DoubleType>::EnsureEqual(result, expected);
+
+    for (auto mode : {CountOptions::COUNT_ALL, CountOptions::COUNT_NULL}) {
+      ASSERT_OK(Count(&this->ctx_, CountOptions(mode), *taken, &expected));
+      ASSERT_OK(Count(&this->ctx_, CountOptions(mode), array, *selection, &result));
+      AssertDatumsEqual(expected, result);
+    }
+
+    ASSERT_OK(MinMax(&this->ctx_, MinMaxOptions(), *taken, &expected));
+    ASSERT_OK(MinMax(&this->ctx_, MinMaxOptions(), array, *selection, &result));
+    AssertDatumsEqual(expected, result);
+  }
+}
+
+TEST(TestSelectionAggregate, Errors) {
+  FunctionContext ctx;
+  auto array = ArrayFromJSON(int32(), "[1, 2, 3]");
+  SelectionVector selection(ArrayFromJSON(int32(), "[0, 2]"), 4);
+
+  Datum result;
+  ASSERT_RAISES(Invalid, Sum(&ctx, array, selection, &result));
+  ASSERT_RAISES(Invalid, Sum(&ctx, std::make_shared<ChunkedArray>(ArrayVector{array}),
+                             selection, &result));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -15,14 +15,26 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/selection-vector.h"
+#include "arrow/table.h"
 
 namespace arrow {
 namespace compute {
 
+Status AggregateFunction::ConsumeSelection(const Array& input,
+                                           const SelectionVector& selection,
+                                           void* state) const {
+  return Status::NotImplemented("Aggregate of type ", out_type()->ToString(),
+                                " does not support selections");
+}
+
 // Helper class that properly invokes destructor when state goes out of scope.
 class ManagedAggregateState {
  public:
@@ -50,18 +62,58 @@ class ManagedAggregateState {
 };
 
 Status AggregateUnaryKernel::Call(FunctionContext* ctx, const Datum& input, Datum* out) {
-  if (!input.is_array()) return Status::Invalid("AggregateKernel expects Array datum");
+  if (!input.is_arraylike()) {
+    return Status::Invalid("AggregateKernel expects Array or ChunkedArray datum");
+  }
 
   auto state = ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
   if (!state) return Status::OutOfMemory("AggregateState allocation failed");
 
-  auto array = input.make_array();
-  RETURN_NOT_OK(aggregate_function_->Consume(*array, state->mutable_data()));
+  if (input.is_array()) {
+    auto array = input.make_array();
+    RETURN_NOT_OK(aggregate_function_->Consume(*array, state->mutable_data()));
+  } else {
+    // Each chunk is consumed into its own state, possibly in parallel, and the
+    // partial states are merged in chunk order.
+    const ArrayVector& chunks = input.chunked_array()->chunks();
+    std::vector<std::shared_ptr<ManagedAggregateState>> partials(chunks.size());
+    RETURN_NOT_OK(detail::ParallelFor(
+        ctx, static_cast<int>(chunks.size()), [&](FunctionContext* task_ctx, int i) {
+          partials[i] =
+              ManagedAggregateState::Make(aggregate_function_, task_ctx->memory_pool());
+          if (!partials[i]) {
+            return Status::OutOfMemory("AggregateState allocation failed");
+          }
+          return aggregate_function_->Consume(*chunks[i], partials[i]->mutable_data());
+        }));
+    for (const auto& partial : partials) {
+      RETURN_NOT_OK(
+          aggregate_function_->Merge(partial->mutable_data(), state->mutable_data()));
+    }
+  }
   RETURN_NOT_OK(aggregate_function_->Finalize(state->mutable_data(), out));
 
   return Status::OK();
 }
 
+Status AggregateUnaryKernel::Call(FunctionContext* ctx, const Datum& input,
+                                  const SelectionVector& selection, Datum* out) {
+  if (!input.is_array()) return Status::Invalid("AggregateKernel expects Array datum");
+  const int64_t length = input.array()->length;
+  if (selection.array_length() != length) {
+    return Status::Invalid("Selection of length ", selection.array_length(),
+                           " does not apply to an array of length ", length);
+  }
+
+  auto state = ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
+  if (!state) return Status::OutOfMemory("AggregateState allocation failed");
+
+  auto array = input.make_array();
+  RETURN_NOT_OK(
+      aggregate_function_->ConsumeSelection(*array, selection, state->mutable_data()));
+  return aggregate_function_->Finalize(state->mutable_data(), out);
+}
+
 std::shared_ptr<DataType> AggregateUnaryKernel::out_type() const {
   return aggregate_function_->out_type();
 }
@@ -29,6 +29,7 @@ class Status;
 namespace compute {
 
 class FunctionContext;
+class SelectionVector;
 struct Datum;
 
 /// AggregateFunction is an interface for Aggregates
@@ -49,6 +50,12 @@ class AggregateFunction {
   /// \brief Consume an array into a state.
   virtual Status Consume(const Array& input, void* state) const = 0;
 
+  /// \brief Consume the selected slots of an array into a state.
+  ///
+  /// The selection must apply to input. Not all aggregates support it.
+  virtual Status ConsumeSelection(const Array& input, const SelectionVector& selection,
+                                  void* state) const;
+
   /// \brief Merge states.
   virtual Status Merge(const void* src, void* dst) const = 0;
 
@@ -72,10 +79,20 @@ class AggregateFunctionStaticState : public AggregateFunction {
   virtual Status Merge(const State& src, State* dst) const = 0;
   virtual Status Finalize(const State& src, Datum* output) const = 0;
 
+  virtual Status ConsumeSelection(const Array& input, const SelectionVector& selection,
+                                  State* state) const {
+    return AggregateFunction::ConsumeSelection(input, selection, state);
+  }
+
   Status Consume(const Array& input, void* state) const final {
     return Consume(input, static_cast<State*>(state));
   }
 
+  Status ConsumeSelection(const Array& input, const SelectionVector& selection,
+                          void* state) const final {
+    return ConsumeSelection(input, selection, static_cast<State*>(state));
+  }
+
   Status Merge(const void* src, void* dst) const final {
     return Merge(*static_cast<const State*>(src), static_cast<State*>(dst));
   }
@@ -105,6 +122,10 @@ class ARROW_EXPORT AggregateUnaryKernel : public UnaryKernel {
 
   Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override;
 
+  /// \brief Aggregate the slots of an array at the positions of a selection
+  Status Call(FunctionContext* ctx, const Datum& input, const SelectionVector& selection,
+              Datum* out);
+
   std::shared_ptr<DataType> out_type() const override;
 
  private:
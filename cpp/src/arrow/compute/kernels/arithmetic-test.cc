@@ -0,0 +1,276 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/test-util.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+using ArithmeticFunction = Status (*)(FunctionContext*, const Datum&, const Datum&,
+                                      const ArithmeticOptions&, Datum*);
+
+template <typename ArrowType>
+class TestArithmeticKernel : public ComputeFixture, public TestBase {
+ protected:
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  Datum MakeArray(const std::string& json) { return ArrayFromJSON(type(), json); }
+
+  Datum MakeScalar(CType value, bool is_valid = true) {
+    std::shared_ptr<Scalar> scalar = std::make_shared<ScalarType>(value, is_valid);
+    return scalar;
+  }
+
+  void AssertArithmetic(ArithmeticFunction func, const Datum& left, const Datum& right,
+                        const std::string& expected,
+                        const ArithmeticOptions& options = ArithmeticOptions()) {
+    Datum out;
+    ASSERT_OK(func(&this->ctx_, left, right, options, &out));
+    AssertArraysEqual(*ArrayFromJSON(type(), expected), *out.make_array());
+  }
+};
+
+TYPED_TEST_CASE(TestArithmeticKernel, NumericArrowTypes);
+
+TYPED_TEST(TestArithmeticKernel, ArrayArray) {
+  auto left = this->MakeArray("[4, 12, null, 3, 50]");
+  auto right = this->MakeArray("[2, 3, 4, null, 2]");
+
+  this->AssertArithmetic(Add, left, right, "[6, 15, null, null, 52]");
+  this->AssertArithmetic(Subtract, left, right, "[2, 9, null, null, 48]");
+  this->AssertArithmetic(Multiply, left, right, "[8, 36, null, null, 100]");
+  this->AssertArithmetic(Divide, left, right, "[2, 4, null, null, 25]");
+
+  this->AssertArithmetic(Add, this->MakeArray("[]"), this->MakeArray("[]"), "[]");
+}
+
+TYPED_TEST(TestArithmeticKernel, ArrayScalar) {
+  auto array = this->MakeArray("[4, 12, null, 30]");
+  auto two = this->MakeScalar(2);
+
+  this->AssertArithmetic(Add, array, two, "[6, 14, null, 32]");
+  this->AssertArithmetic(Add, two, array, "[6, 14, null, 32]");
+  this->AssertArithmetic(Subtract, array, two, "[2, 10, null, 28]");
+  this->AssertArithmetic(Subtract, this->MakeScalar(60), array, "[56, 48, null, 30]");
+  this->AssertArithmetic(Multiply, two, array, "[8, 24, null, 60]");
+  this->AssertArithmetic(Divide, array, two, "[2, 6, null, 15]");
+  this->AssertArithmetic(Divide, this->MakeScalar(120), array, "[30, 10, null, 4]");
+
+  // A null scalar makes all results null
+  auto null = this->MakeScalar(0, false);
+  this->AssertArithmetic(Add, array, null, "[null, null, null, null]");
+  this->AssertArithmetic(Divide, null, array, "[null, null, null, null]");
+}
+
+TYPED_TEST(TestArithmeticKernel, Sliced) {
+  auto left = this->MakeArray("[1, 2, 3, null, 5, 6, 7, 8, 9, 10, 11]").make_array();
+  auto right = this->MakeArray("[0, 1, null, 1, 1, 1, 1, 1, 1, 1, 1]").make_array();
+
+  this->AssertArithmetic(Add, left->Slice(1), right->Slice(1),
+                         "[3, null, null, 6, 7, 8, 9, 10, 11, 12]");
+  this->AssertArithmetic(Divide, left->Slice(9), right->Slice(2, 2), "[null, 11]",
+                         ArithmeticOptions(true));
+}
+
+TYPED_TEST(TestArithmeticKernel, Random) {
+  using CType = typename TestFixture::CType;
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  auto rand = random::RandomArrayGenerator(0x7ac5f3);
+  for (int64_t length : {1, 63, 64, 65, 1000}) {
+    auto left = rand.Numeric<TypeParam>(length, 0, 10, 0.1);
+    auto right = rand.Numeric<TypeParam>(length, 1, 10, 0.1);
+    const auto& left_values = static_cast<const ArrayType&>(*left);
+    const auto& right_values = static_cast<const ArrayType&>(*right);
+
+    std::vector<bool> is_valid(length);
+    std::vector<CType> sums(length), products(length);
+    for (int64_t i = 0; i < length; i++) {
+      is_valid[i] = left_values.IsValid(i) && right_values.IsValid(i);
+      sums[i] = static_cast<CType>(left_values.Value(i) + right_values.Value(i));
+      products[i] = static_cast<CType>(left_values.Value(i) * right_values.Value(i));
+    }
+    std::shared_ptr<Array> expected;
+
+    for (bool check_overflow : {false, true}) {
+      Datum out;
+      ASSERT_OK(Add(&this->ctx_, left, right, ArithmeticOptions(check_overflow), &out));
+      ArrayFromVector<TypeParam, CType>(is_valid, sums, &expected);
+      AssertArraysEqual(*expected, *out.make_array());
+
+      ASSERT_OK(
+          Multiply(&this->ctx_, left, right, ArithmeticOptions(check_overflow), &out));
+      ArrayFromVector<TypeParam, CType>(is_valid, products, &expected);
+      AssertArraysEqual(*expected, *out.make_array());
+    }
+  }
+}
+
+class TestArithmeticKernelOverflow : public ComputeFixture, public TestBase {};
+
+TEST_F(TestArithmeticKernelOverflow, WrapAround) {
+  Datum out;
+  ASSERT_OK(Add(&this->ctx_, ArrayFromJSON(int8(), "[100, -100, null]"),
+                ArrayFromJSON(int8(), "[100, -100, 100]"), ArithmeticOptions(), &out));
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[-56, 56, null]"), *out.make_array());
+
+  ASSERT_OK(Subtract(&this->ctx_, ArrayFromJSON(uint8(), "[1, 2]"),
+                     ArrayFromJSON(uint8(), "[2, 2]"), ArithmeticOptions(), &out));
+  AssertArraysEqual(*ArrayFromJSON(uint8(), "[255, 0]"), *out.make_array());
+
+  ASSERT_OK(Multiply(&this->ctx_, ArrayFromJSON(uint16(), "[65535, 256]"),
+                     ArrayFromJSON(uint16(), "[65535, 256]"), ArithmeticOptions(),
+                     &out));
+  AssertArraysEqual(*ArrayFromJSON(uint16(), "[1, 0]"), *out.make_array());
+
+  ASSERT_OK(Divide(&this->ctx_, ArrayFromJSON(int32(), "[-2147483648]"),
+                   ArrayFromJSON(int32(), "[-1]"), ArithmeticOptions(), &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[-2147483648]"), *out.make_array());
+}
+
+TEST_F(TestArithmeticKernelOverflow, Checked) {
+  ArithmeticOptions checked(true);
+  Datum out;
+
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, ArrayFromJSON(int8(), "[1, 100]"),
+                             ArrayFromJSON(int8(), "[1, 100]"), checked, &out));
+  ASSERT_RAISES(Invalid, Subtract(&this->ctx_, ArrayFromJSON(uint8(), "[1, 2]"),
+                                  ArrayFromJSON(uint8(), "[2, 2]"), checked, &out));
+  ASSERT_RAISES(Invalid,
+                Multiply(&this->ctx_, ArrayFromJSON(int64(), "[4294967296]"),
+                         ArrayFromJSON(int64(), "[4294967296]"), checked, &out));
+  ASSERT_RAISES(Invalid, Divide(&this->ctx_, ArrayFromJSON(int32(), "[-2147483648]"),
+                                ArrayFromJSON(int32(), "[-1]"), checked, &out));
+
+  // Floating point follows ieee-754
+  ASSERT_OK(Multiply(&this->ctx_, ArrayFromJSON(float32(), "[1e30]"),
+                     ArrayFromJSON(float32(), "[1e30]"), checked, &out));
+  ASSERT_TRUE(std::isinf(static_cast<const FloatArray&>(*out.make_array()).Value(0)));
+}
+
+TEST_F(TestArithmeticKernelOverflow, NullSlotsIgnored) {
+  // The value behind a null slot may overflow without raising an error.
+  std::shared_ptr<Array> left, right;
+  ArrayFromVector<Int8Type, int8_t>({true, false, true}, {1, 127, 3}, &left);
+  ArrayFromVector<Int8Type, int8_t>({1, 1, 0}, &right);
+
+  Datum out;
+  ASSERT_OK(Add(&this->ctx_, left, right, ArithmeticOptions(true), &out));
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[2, null, 3]"), *out.make_array());
+
+  ASSERT_RAISES(Invalid, Divide(&this->ctx_, left, right, ArithmeticOptions(), &out));
+  ArrayFromVector<Int8Type, int8_t>({true, true, false}, {1, 1, 0}, &right);
+  ASSERT_OK(Divide(&this->ctx_, left, right, ArithmeticOptions(), &out));
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[1, null, null]"), *out.make_array());
+}
+
+TEST_F(TestArithmeticKernelOverflow, DivideByZero) {
+  Datum out;
+  ASSERT_RAISES(Invalid, Divide(&this->ctx_, ArrayFromJSON(int32(), "[1, 2]"),
+                                ArrayFromJSON(int32(), "[1, 0]"), ArithmeticOptions(),
+                                &out));
+
+  ASSERT_OK(Divide(&this->ctx_, ArrayFromJSON(float64(), "[1, -1]"),
+                   ArrayFromJSON(float64(), "[0, 0]"), ArithmeticOptions(), &out));
+  const auto& result = static_cast<const DoubleArray&>(*out.make_array());
+  ASSERT_EQ(std::numeric_limits<double>::infinity(), result.Value(0));
+  ASSERT_EQ(-std::numeric_limits<double>::infinity(), result.Value(1));
+}
+
+class TestArithmeticKernelOutput : public ComputeFixture, public TestBase {};
+
+TEST_F(TestArithmeticKernelOutput, ReusePreallocated) {
+  auto left = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  auto right = ArrayFromJSON(int32(), "[10, 20, 30, null]");
+
+  ArithmeticOptions options;
+  options.reuse_output = true;
+
+  Datum out;
+  ASSERT_OK(Add(&this->ctx_, left, right, options, &out));
+  auto first = out.make_array();
+  const uint8_t* values = out.array()->buffers[1]->data();
+
+  // The intermediate result buffer is reused for the next operation.
+  std::shared_ptr<Scalar> two = std::make_shared<Int32Scalar>(2);
+  ASSERT_OK(Multiply(&this->ctx_, out, two, options, &out));
+  ASSERT_EQ(values, out.array()->buffers[1]->data());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[22, 44, null, null]"), *out.make_array());
+
+  // Arrays previously wrapping the output keep their validity.
+  ASSERT_EQ(2, first->null_count());
+  ASSERT_TRUE(first->IsNull(3));
+
+  // A differently typed or sized output is not reused.
+  ASSERT_OK(Add(&this->ctx_, ArrayFromJSON(int32(), "[1]"), ArrayFromJSON(int32(), "[1]"),
+                options, &out));
+  ASSERT_NE(values, out.array()->buffers[1]->data());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2]"), *out.make_array());
+}
+
+TEST_F(TestArithmeticKernelOutput, NoReuseByDefault) {
+  auto left = ArrayFromJSON(int32(), "[1, 2, 3]");
+  auto right = ArrayFromJSON(int32(), "[10, 20, 30]");
+
+  Datum out;
+  ASSERT_OK(Add(&this->ctx_, left, right, ArithmeticOptions(), &out));
+  auto first = out.make_array();
+
+  // A result from an earlier call is left unchanged
+  ASSERT_OK(Subtract(&this->ctx_, left, right, ArithmeticOptions(), &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[11, 22, 33]"), *first);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[-9, -18, -27]"), *out.make_array());
+}
+
+TEST_F(TestArithmeticKernelOutput, Invalid) {
+  Datum out;
+  std::shared_ptr<Scalar> one = std::make_shared<Int32Scalar>(1);
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, ArrayFromJSON(int32(), "[1]"),
+                             ArrayFromJSON(int64(), "[1]"), ArithmeticOptions(), &out));
+  ASSERT_RAISES(Invalid,
+                Add(&this->ctx_, ArrayFromJSON(int32(), "[1]"),
+                    ArrayFromJSON(int32(), "[1, 2]"), ArithmeticOptions(), &out));
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, one, one, ArithmeticOptions(), &out));
+  ASSERT_RAISES(NotImplemented,
+                Add(&this->ctx_, ArrayFromJSON(utf8(), R"(["a"])"),
+                    ArrayFromJSON(utf8(), R"(["b"])"), ArithmeticOptions(), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,366 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/arithmetic.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/int-util.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+template <typename T, typename R = void>
+using enable_if_integral_c = typename std::enable_if<std::is_integral<T>::value, R>::type;
+
+template <typename T, typename R = void>
+using enable_if_floating_c =
+    typename std::enable_if<std::is_floating_point<T>::value, R>::type;
+
+// Unsigned type which is not promoted to int, wrapping around has a defined
+// behaviour on it.
+template <typename T>
+using WrappingType =
+    typename std::conditional<(sizeof(T) < sizeof(unsigned int)), unsigned int,
+                              typename std::make_unsigned<T>::type>::type;
+
+// Each operation implements
+//
+//   template <bool kCheckOverflow, typename T>
+//   static bool Call(T left, T right, T* out);
+//
+// which stores the result in *out and returns true if the operation failed,
+// and CanFail<kCheckOverflow, T>() which is false when Call never fails. A
+// failed operation on a null slot is ignored.
+
+struct AddOp {
+  template <bool kCheckOverflow, typename T>
+  static enable_if_integral_c<T, bool> Call(T left, T right, T* out) {
+    if (kCheckOverflow) {
+      return internal::AddWithOverflow(left, right, out);
+    }
+    *out = static_cast<T>(static_cast<WrappingType<T>>(left) +
+                          static_cast<WrappingType<T>>(right));
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static enable_if_floating_c<T, bool> Call(T left, T right, T* out) {
+    *out = left + right;
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static constexpr bool CanFail() {
+    return kCheckOverflow && std::is_integral<T>::value;
+  }
+
+  template <typename T>
+  static Status Error(T left, T right) {
+    return Status::Invalid("Overflow in addition");
+  }
+};
+
+struct SubtractOp {
+  template <bool kCheckOverflow, typename T>
+  static enable_if_integral_c<T, bool> Call(T left, T right, T* out) {
+    if (kCheckOverflow) {
+      return internal::SubtractWithOverflow(left, right, out);
+    }
+    *out = static_cast<T>(static_cast<WrappingType<T>>(left) -
+                          static_cast<WrappingType<T>>(right));
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static enable_if_floating_c<T, bool> Call(T left, T right, T* out) {
+    *out = left - right;
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static constexpr bool CanFail() {
+    return kCheckOverflow && std::is_integral<T>::value;
+  }
+
+  template <typename T>
+  static Status Error(T left, T right) {
+    return Status::Invalid("Overflow in subtraction");
+  }
+};
+
+struct MultiplyOp {
+  template <bool kCheckOverflow, typename T>
+  static enable_if_integral_c<T, bool> Call(T left, T right, T* out) {
+    if (kCheckOverflow) {
+      return internal::MultiplyWithOverflow(left, right, out);
+    }
+    *out = static_cast<T>(static_cast<WrappingType<T>>(left) *
+                          static_cast<WrappingType<T>>(right));
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static enable_if_floating_c<T, bool> Call(T left, T right, T* out) {
+    *out = left * right;
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static constexpr bool CanFail() {
+    return kCheckOverflow && std::is_integral<T>::value;
+  }
+
+  template <typename T>
+  static Status Error(T left, T right) {
+    return Status::Invalid("Overflow in multiplication");
+  }
+};
+
+struct DivideOp {
+  template <bool kCheckOverflow, typename T>
+  static enable_if_integral_c<T, bool> Call(T left, T right, T* out) {
+    if (ARROW_PREDICT_FALSE(right == 0)) {
+      *out = 0;
+      return true;
+    }
+    // The only overflowing integer division, which is undefined behaviour.
+    if (std::is_signed<T>::value && right == static_cast<T>(-1) &&
+        left == std::numeric_limits<T>::min()) {
+      *out = left;
+      return kCheckOverflow;
+    }
+    *out = static_cast<T>(left / right);
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static enable_if_floating_c<T, bool> Call(T left, T right, T* out) {
+    *out = left / right;
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static constexpr bool CanFail() {
+    return std::is_integral<T>::value;
+  }
+
+  template <typename T>
+  static Status Error(T left, T right) {
+    if (right == 0) {
+      return Status::Invalid("Divide by zero");
+    }
+    return Status::Invalid("Overflow in division");
+  }
+};
+
+// Operand accessors, letting the same loop serve arrays and broadcast scalars.
+template <typename T>
+struct ArrayOperand {
+  explicit ArrayOperand(const ArrayData& data) : values(data.GetValues<T>(1)) {}
+  T operator[](int64_t i) const { return values[i]; }
+  const T* values;
+};
+
+template <typename T>
+struct ScalarOperand {
+  explicit ScalarOperand(T value) : value(value) {}
+  T operator[](int64_t) const { return value; }
+  const T value;
+};
+
+template <typename Op, bool kCheckOverflow, typename T, typename Left, typename Right>
+Status ArithmeticLoop(Left left, Right right, const uint8_t* validity, int64_t length,
+                      T* out) {
+  if (!Op::template CanFail<kCheckOverflow, T>()) {
+    // Straight loop the compiler can vectorise.
+    for (int64_t i = 0; i < length; i++) {
+      Op::template Call<kCheckOverflow>(left[i], right[i], out + i);
+    }
+    return Status::OK();
+  }
+
+  // Results are computed by blocks into a scratch area, so that failures can be
+  // checked against the validity bitmap before the inputs, which may share
+  // their buffer with the output, are overwritten.
+  constexpr int64_t kBlockSize = 64;
+  T block[kBlockSize];
+  for (int64_t i = 0; i < length; i += kBlockSize) {
+    const int64_t block_length = std::min(kBlockSize, length - i);
+    bool failed = false;
+    for (int64_t j = 0; j < block_length; j++) {
+      failed |= Op::template Call<kCheckOverflow>(left[i + j], right[i + j], block + j);
+    }
+    if (ARROW_PREDICT_FALSE(failed)) {
+      for (int64_t j = 0; j < block_length; j++) {
+        if ((validity == nullptr || BitUtil::GetBit(validity, i + j)) &&
+            Op::template Call<kCheckOverflow>(left[i + j], right[i + j], block + j)) {
+          return Op::Error(left[i + j], right[i + j]);
+        }
+      }
+    }
+    std::memcpy(out + i, block, block_length * sizeof(T));
+  }
+  return Status::OK();
+}
+
+template <typename ArrowType, typename Op>
+struct ArithmeticImpl {
+  using T = typename TypeTraits<ArrowType>::CType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  template <bool kCheckOverflow>
+  static Status Exec(const Datum& left, const Datum& right, ArrayData* output) {
+    const uint8_t* validity =
+        output->null_count > 0 ? output->buffers[0]->data() : nullptr;
+    T* out = output->GetMutableValues<T>(1);
+    const int64_t length = output->length;
+
+    if (left.kind() == Datum::SCALAR) {
+      const T value = static_cast<const ScalarType&>(*left.scalar()).value;
+      return ArithmeticLoop<Op, kCheckOverflow>(ScalarOperand<T>(value),
+                                                ArrayOperand<T>(*right.array()),
+                                                validity, length, out);
+    } else if (right.kind() == Datum::SCALAR) {
+      const T value = static_cast<const ScalarType&>(*right.scalar()).value;
+      return ArithmeticLoop<Op, kCheckOverflow>(ArrayOperand<T>(*left.array()),
+                                                ScalarOperand<T>(value), validity,
+                                                length, out);
+    }
+    return ArithmeticLoop<Op, kCheckOverflow>(ArrayOperand<T>(*left.array()),
+                                              ArrayOperand<T>(*right.array()),
+                                              validity, length, out);
+  }
+
+  static Status Exec(const Datum& left, const Datum& right, bool check_overflow,
+                     ArrayData* output) {
+    if (check_overflow) {
+      return Exec<true>(left, right, output);
+    }
+    return Exec<false>(left, right, output);
+  }
+};
+
+#define ARITHMETIC_CASE(T) \
+  case T::type_id:         \
+    return ArithmeticImpl<T, Op>::Exec(left, right, options.check_overflow, output);
+
+template <typename Op>
+Status ExecArithmetic(FunctionContext* ctx, const Datum& left_arg,
+                      const Datum& right_arg, const ArithmeticOptions& options,
+                      Datum* out) {
+  // The operands are copied as out may be one of them and is overwritten by
+  // PrepareOutput.
+  const Datum left = left_arg;
+  const Datum right = right_arg;
+
+  const bool left_is_array = left.kind() == Datum::ARRAY;
+  const bool right_is_array = right.kind() == Datum::ARRAY;
+  if (!(left_is_array || left.kind() == Datum::SCALAR) ||
+      !(right_is_array || right.kind() == Datum::SCALAR) ||
+      !(left_is_array || right_is_array)) {
+    return Status::Invalid("Arithmetic expects an Array and an Array or a Scalar");
+  }
+  if (!left.type()->Equals(right.type())) {
+    return Status::Invalid("Arithmetic operands must have the same type, got ",
+                           *left.type(), " and ", *right.type());
+  }
+
+  const ArrayData& array = left_is_array ? *left.array() : *right.array();
+  if (left_is_array && right_is_array && right.array()->length != array.length) {
+    return Status::Invalid("Arithmetic operands must have the same length");
+  }
+
+  const auto& type = array.type;
+  if (!is_integer(type->id()) && !is_floating(type->id())) {
+    return Status::NotImplemented("Arithmetic not implemented for type ", *type);
+  }
+
+  RETURN_NOT_OK(
+      detail::PrepareOutput(ctx, type, array.length, options.reuse_output, out));
+  ArrayData* output = out->array().get();
+
+  if ((!left_is_array && !left.scalar()->is_valid) ||
+      (!right_is_array && !right.scalar()->is_valid)) {
+    // A null scalar makes all results null.
+    std::memset(output->buffers[1]->mutable_data(), 0, output->buffers[1]->size());
+    return detail::SetAllNulls(ctx, array, output);
+  }
+
+  if (left_is_array && right_is_array) {
+    RETURN_NOT_OK(
+        detail::AssignNullIntersection(ctx, *left.array(), *right.array(), output));
+  } else {
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, array, output));
+  }
+
+  switch (type->id()) {
+    ARITHMETIC_CASE(UInt8Type);
+    ARITHMETIC_CASE(Int8Type);
+    ARITHMETIC_CASE(UInt16Type);
+    ARITHMETIC_CASE(Int16Type);
+    ARITHMETIC_CASE(UInt32Type);
+    ARITHMETIC_CASE(Int32Type);
+    ARITHMETIC_CASE(UInt64Type);
+    ARITHMETIC_CASE(Int64Type);
+    ARITHMETIC_CASE(FloatType);
+    ARITHMETIC_CASE(DoubleType);
+    default:
+      return Status::NotImplemented("Arithmetic not implemented for type ", *type);
+  }
+}
+
+#undef ARITHMETIC_CASE
+
+}  // namespace
+
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right,
+           const ArithmeticOptions& options, Datum* out) {
+  return ExecArithmetic<AddOp>(ctx, left, right, options, out);
+}
+
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                const ArithmeticOptions& options, Datum* out) {
+  return ExecArithmetic<SubtractOp>(ctx, left, right, options, out);
+}
+
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                const ArithmeticOptions& options, Datum* out) {
+  return ExecArithmetic<MultiplyOp>(ctx, left, right, options, out);
+}
+
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right,
+              const ArithmeticOptions& options, Datum* out) {
+  return ExecArithmetic<DivideOp>(ctx, left, right, options, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
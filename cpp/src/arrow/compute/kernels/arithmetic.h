@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \class ArithmeticOptions
+///
+/// The user control the arithmetic kernels behavior with this class. By
+/// default, integer overflow wraps around.
+struct ARROW_EXPORT ArithmeticOptions {
+  explicit ArithmeticOptions(bool check_overflow = false)
+      : check_overflow(check_overflow) {}
+
+  /// Whether integer overflow returns an error instead of wrapping around.
+  /// Floating point arithmetic always follows ieee-754 semantics.
+  bool check_overflow;
+
+  /// Whether the result may be written into the values buffer of the array
+  /// held by out, see Add().
+  bool reuse_output = false;
+};
+
+/// \brief Add two numeric datums element-wise.
+///
+/// Operands are either two arrays of the same length, or an array and a
+/// scalar, on either side, broadcast to the length of the array. Both must
+/// have the same numeric type, which is the type of the result. The result
+/// slot is null if either input slot is null.
+///
+/// If options.reuse_output is true and out already holds an array of the
+/// result type and length with a mutable values buffer, e.g. an intermediate
+/// result which is not needed anymore, the result is written into that
+/// buffer instead of a new allocation. The buffer may be shared with one of
+/// the operands, but arrays sharing it otherwise see their values change, so
+/// the caller must own it exclusively.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left the left operand, an Array or a Scalar
+/// \param[in] right the right operand, an Array or a Scalar
+/// \param[in] options see ArithmeticOptions for more information
+/// \param[in,out] out resulting datum
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Add(FunctionContext* context, const Datum& left, const Datum& right,
+           const ArithmeticOptions& options, Datum* out);
+
+/// \brief Subtract two numeric datums element-wise, see Add.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left the left operand, an Array or a Scalar
+/// \param[in] right the right operand, an Array or a Scalar
+/// \param[in] options see ArithmeticOptions for more information
+/// \param[in,out] out resulting datum
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Subtract(FunctionContext* context, const Datum& left, const Datum& right,
+                const ArithmeticOptions& options, Datum* out);
+
+/// \brief Multiply two numeric datums element-wise, see Add.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left the left operand, an Array or a Scalar
+/// \param[in] right the right operand, an Array or a Scalar
+/// \param[in] options see ArithmeticOptions for more information
+/// \param[in,out] out resulting datum
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Multiply(FunctionContext* context, const Datum& left, const Datum& right,
+                const ArithmeticOptions& options, Datum* out);
+
+/// \brief Divide two numeric datums element-wise, see Add.
+///
+/// Integer division truncates towards zero, and dividing a (non-null) integer
+/// by zero is an error regardless of options.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left the dividend, an Array or a Scalar
+/// \param[in] right the divisor, an Array or a Scalar
+/// \param[in] options see ArithmeticOptions for more information
+/// \param[in,out] out resulting datum
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Divide(FunctionContext* context, const Datum& left, const Datum& right,
+              const ArithmeticOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
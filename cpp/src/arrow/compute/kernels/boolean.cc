@@ -70,7 +70,7 @@ Status Invert(FunctionContext* ctx, const Datum& value, Datum* out) {
   detail::PrimitiveAllocatingUnaryKernel kernel(&invert);
 
   std::vector<Datum> result;
-  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &kernel, value, &result));
+  RETURN_NOT_OK(detail::ParallelInvokeUnaryArrayKernel(ctx, &kernel, value, &result));
 
   *out = detail::WrapDatumsLike(value, result);
   return Status::OK();
@@ -38,12 +38,14 @@
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/thread-pool.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/cast.h"
 #include "arrow/compute/kernels/hash.h"
 #include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/selection-vector.h"
 #include "arrow/compute/test-util.h"
 
 namespace arrow {
@@ -777,6 +779,43 @@ TEST_F(TestCast, ChunkedArray) {
   ASSERT_TRUE(out.chunked_array()->Equals(*ex_carr));
 }
 
+TEST_F(TestCast, ChunkedArrayThreaded) {
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(4, &pool));
+  FunctionContext ctx(default_memory_pool(), pool.get());
+
+  ArrayVector chunks, ex_chunks;
+  for (int i = 0; i < 20; i++) {
+    chunks.push_back(ArrayFromJSON(int32(), "[0, null, 2]"));
+    ex_chunks.push_back(ArrayFromJSON(int8(), "[0, null, 2]"));
+  }
+  CastOptions options;
+  Datum out;
+  ASSERT_OK(Cast(&ctx, std::make_shared<ChunkedArray>(chunks), int8(), options, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  AssertChunkedEqual(ChunkedArray(ex_chunks), *out.chunked_array());
+
+  // A failure in any chunk is reported
+  chunks[13] = ArrayFromJSON(int32(), "[0, 1000]");
+  auto invalid = std::make_shared<ChunkedArray>(chunks);
+  ASSERT_RAISES(Invalid, Cast(&ctx, invalid, int8(), options, &out));
+  ASSERT_FALSE(ctx.HasError());
+}
+
+TEST_F(TestCast, Selection) {
+  // The rejected slots would overflow, only the selected ones are converted
+  auto values = ArrayFromJSON(int32(), "[1000, 1, null, 2000, 3]");
+  SelectionVector selection(ArrayFromJSON(int32(), "[1, 2, 4]"), 5);
+
+  CastOptions options;
+  Datum out;
+  ASSERT_OK(Cast(&this->ctx_, values, selection, int8(), options, &out));
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[1, null, 3]"), *out.make_array());
+
+  SelectionVector overflow(ArrayFromJSON(int32(), "[0, 1]"), 5);
+  ASSERT_RAISES(Invalid, Cast(&this->ctx_, values, overflow, int8(), options, &out));
+}
+
 TEST_F(TestCast, UnsupportedTarget) {
   std::vector<bool> is_valid = {true, false, true, true, true};
   std::vector<int32_t> v1 = {0, 1, 2, 3, 4};
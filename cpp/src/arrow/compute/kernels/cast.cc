@@ -41,7 +41,9 @@
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/selection-vector.h"
 
 #ifdef ARROW_EXTRA_ERROR_CONTEXT
 
@@ -640,9 +642,9 @@ Status InvokeWithAllocation(FunctionContext* ctx, UnaryKernel* func, const Datum
   if (NeedToPreallocate(*func->out_type())) {
     // Create wrapper that allocates output memory for primitive types
     detail::PrimitiveAllocatingUnaryKernel wrapper(func);
-    RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &wrapper, input, &result));
+    RETURN_NOT_OK(detail::ParallelInvokeUnaryArrayKernel(ctx, &wrapper, input, &result));
   } else {
-    RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, func, input, &result));
+    RETURN_NOT_OK(detail::ParallelInvokeUnaryArrayKernel(ctx, func, input, &result));
   }
   RETURN_IF_ERROR(ctx);
   *out = detail::WrapDatumsLike(input, result);
@@ -1247,6 +1249,15 @@ Status Cast(FunctionContext* ctx, const Datum& value, std::shared_ptr<DataType>
   return InvokeWithAllocation(ctx, func.get(), value, out);
 }
 
+Status Cast(FunctionContext* ctx, const Datum& value, const SelectionVector& selection,
+            std::shared_ptr<DataType> out_type, const CastOptions& options, Datum* out) {
+  // Gather the selected slots first, so that only these are converted.
+  Datum selected;
+  RETURN_NOT_OK(Take(ctx, value, Datum(std::make_shared<SelectionVector>(selection)),
+                     TakeOptions(), &selected));
+  return Cast(ctx, selected, std::move(out_type), options, out);
+}
+
 Status Cast(FunctionContext* ctx, const Array& array, std::shared_ptr<DataType> out_type,
             const CastOptions& options, std::shared_ptr<Array>* out) {
   Datum datum_out;
@@ -32,6 +32,7 @@ namespace compute {
 
 struct Datum;
 class FunctionContext;
+class SelectionVector;
 class UnaryKernel;
 
 struct ARROW_EXPORT CastOptions {
@@ -92,6 +93,26 @@ ARROW_EXPORT
 Status Cast(FunctionContext* context, const Datum& value,
             std::shared_ptr<DataType> to_type, const CastOptions& options, Datum* out);
 
+/// \brief Cast the selected slots of an array to another type
+///
+/// Only the selected values are converted, so that casting the output of a
+/// filter does not pay for the rejected slots. The output has one value per
+/// selected slot.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value datum to cast, expecting Array
+/// \param[in] selection positions of the slots to cast
+/// \param[in] to_type type to cast to
+/// \param[in] options casting options
+/// \param[out] out resulting datum
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Cast(FunctionContext* context, const Datum& value,
+            const SelectionVector& selection, std::shared_ptr<DataType> to_type,
+            const CastOptions& options, Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
 
@@ -17,10 +17,16 @@
 
 #include "arrow/compute/kernels/compare.h"
 
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "arrow/buffer.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/filter.h"
 #include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/selection-vector.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
 
@@ -48,10 +54,99 @@ static Status CompareArrayScalar(const ArrayData& input, const ScalarType& scala
   return Status::OK();
 }
 
+template <typename ArrowType, CompareOperator Op,
+          typename T = typename TypeTraits<ArrowType>::CType>
+static Status CompareArrayArray(const ArrayData& left, const ArrayData& right,
+                                uint8_t* bitmap) {
+  const T* left_values = left.GetValues<T>(1);
+  const T* right_values = right.GetValues<T>(1);
+
+  size_t i = 0;
+  internal::GenerateBitsUnrolled(
+      bitmap, 0, left.length, [left_values, right_values, &i]() -> bool {
+        const bool result = Comparator<T, Op>::Compare(left_values[i], right_values[i]);
+        ++i;
+        return result;
+      });
+
+  return Status::OK();
+}
+
+static inline const uint8_t* ValidityBitmap(const ArrayData& data) {
+  return data.GetNullCount() != 0 && data.buffers[0] ? data.buffers[0]->data() : NULLPTR;
+}
+
+static inline bool IsValidSlot(const uint8_t* bitmap, int64_t offset, int64_t i) {
+  return bitmap == NULLPTR || BitUtil::GetBit(bitmap, offset + i);
+}
+
+// Write the positions, among candidates if any, where is_selected holds. Each
+// position is written unconditionally but only kept if selected, avoiding
+// unpredictable branches.
+template <typename IsSelected>
+static int64_t CollectPositions(int64_t length, const SelectionVector* candidates,
+                                IsSelected&& is_selected, int32_t* positions) {
+  int64_t selected = 0;
+  if (candidates == NULLPTR) {
+    for (int64_t i = 0; i < length; ++i) {
+      positions[selected] = static_cast<int32_t>(i);
+      selected += is_selected(i);
+    }
+  } else {
+    const int32_t* candidate_positions = candidates->raw_indices();
+    for (int64_t j = 0; j < candidates->length(); ++j) {
+      const int32_t i = candidate_positions[j];
+      positions[selected] = i;
+      selected += is_selected(i);
+    }
+  }
+  return selected;
+}
+
+// Select the non-null slots of left (and right, if given) where predicate
+// holds.
+template <typename Predicate>
+static Status SelectPositions(FunctionContext* ctx, const ArrayData& left,
+                              const ArrayData* right, const SelectionVector* candidates,
+                              Predicate&& predicate,
+                              std::shared_ptr<SelectionVector>* out) {
+  if (left.length > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Cannot select from arrays longer than 2^31 - 1");
+  }
+  const int64_t capacity = candidates ? candidates->length() : left.length;
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(ctx->memory_pool(),
+                                        capacity * sizeof(int32_t), &buffer));
+  auto positions = reinterpret_cast<int32_t*>(buffer->mutable_data());
+
+  const uint8_t* left_valid = ValidityBitmap(left);
+  const uint8_t* right_valid = right ? ValidityBitmap(*right) : NULLPTR;
+  int64_t selected;
+  if (left_valid == NULLPTR && right_valid == NULLPTR) {
+    selected = CollectPositions(left.length, candidates, predicate, positions);
+  } else {
+    const int64_t left_offset = left.offset;
+    const int64_t right_offset = right ? right->offset : 0;
+    selected = CollectPositions(
+        left.length, candidates,
+        [&](int64_t i) {
+          return predicate(i) & IsValidSlot(left_valid, left_offset, i) &
+                 IsValidSlot(right_valid, right_offset, i);
+        },
+        positions);
+  }
+
+  RETURN_NOT_OK(buffer->Resize(selected * sizeof(int32_t)));
+  *out = std::make_shared<SelectionVector>(
+      std::make_shared<Int32Array>(selected, buffer), left.length);
+  return Status::OK();
+}
+
 template <typename ArrowType, CompareOperator Op>
 class CompareFunction final : public FilterFunction {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
   using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+  using T = typename TypeTraits<ArrowType>::CType;
 
  public:
   explicit CompareFunction(FunctionContext* ctx) : ctx_(ctx) {}
@@ -77,6 +172,58 @@ class CompareFunction final : public FilterFunction {
         input, static_cast<const ScalarType&>(scalar), bitmap_result);
   }
 
+  Status Filter(const ArrayData& left, const ArrayData& right,
+                ArrayData* output) const {
+    // Caller must cast
+    DCHECK(left.type->Equals(right.type));
+    // Output must be a boolean array
+    DCHECK(output->type->Equals(boolean()));
+    // Output must be of same length
+    DCHECK_EQ(output->length, left.length);
+    DCHECK_EQ(output->length, right.length);
+
+    // A slot is null if it is null in either input.
+    RETURN_NOT_OK(detail::AssignNullIntersection(ctx_, left, right, output));
+
+    uint8_t* bitmap_result = output->buffers[1]->mutable_data();
+    return CompareArrayArray<ArrowType, Op>(left, right, bitmap_result);
+  }
+
+  Status Select(const ArrayData& input, const Scalar& scalar,
+                const SelectionVector* candidates,
+                std::shared_ptr<SelectionVector>* out) const override {
+    DCHECK(input.type->Equals(scalar.type));
+    if (!scalar.is_valid) {
+      // All comparisons are null, nothing is selected.
+      return SelectPositions(ctx_, input, NULLPTR, candidates,
+                             [](int64_t) { return false; }, out);
+    }
+
+    const T right = static_cast<const ScalarType&>(scalar).value;
+    const T* values = input.GetValues<T>(1);
+    return SelectPositions(ctx_, input, NULLPTR, candidates,
+                           [values, right](int64_t i) {
+                             return Comparator<T, Op>::Compare(values[i], right);
+                           },
+                           out);
+  }
+
+  Status Select(const ArrayData& left, const ArrayData& right,
+                const SelectionVector* candidates,
+                std::shared_ptr<SelectionVector>* out) const override {
+    DCHECK(left.type->Equals(right.type));
+    DCHECK_EQ(left.length, right.length);
+
+    const T* left_values = left.GetValues<T>(1);
+    const T* right_values = right.GetValues<T>(1);
+    return SelectPositions(ctx_, left, &right, candidates,
+                           [left_values, right_values](int64_t i) {
+                             return Comparator<T, Op>::Compare(left_values[i],
+                                                               right_values[i]);
+                           },
+                           out);
+  }
+
  private:
   FunctionContext* ctx_;
 };
@@ -147,28 +294,100 @@ std::shared_ptr<FilterFunction> MakeCompareFilterFunction(FunctionContext* ctx,
   }
 }
 
+// Swapping operands requires to mirror the operator, e.g. `1 < x` is `x > 1`.
+static CompareOperator MirrorOperator(CompareOperator op) {
+  switch (op) {
+    case CompareOperator::GREATER:
+      return CompareOperator::LESS;
+    case CompareOperator::GREATER_EQUAL:
+      return CompareOperator::LESS_EQUAL;
+    case CompareOperator::LESS:
+      return CompareOperator::GREATER;
+    case CompareOperator::LESS_EQUAL:
+      return CompareOperator::GREATER_EQUAL;
+    default:
+      return op;
+  }
+}
+
+// Check the operands of a comparison, once a scalar is on the right.
+static Status ValidateCompareOperands(const Datum& left, const Datum& right) {
+  if (left.kind() != Datum::ARRAY ||
+      (right.kind() != Datum::ARRAY && right.kind() != Datum::SCALAR)) {
+    return Status::Invalid("Compare expects an Array and an Array or a Scalar");
+  }
+  if (!left.type()->Equals(right.type())) {
+    return Status::Invalid("Compare operands must have the same type, got ",
+                           *left.type(), " and ", *right.type());
+  }
+  if (right.kind() == Datum::ARRAY && right.array()->length != left.array()->length) {
+    return Status::Invalid("Compare operands must have the same length");
+  }
+  return Status::OK();
+}
+
+static Status GetCompareFunction(FunctionContext* context, const DataType& type,
+                                 struct CompareOptions options,
+                                 std::shared_ptr<FilterFunction>* out) {
+  *out = MakeCompareFilterFunction(context, type, options);
+  if (*out == nullptr) {
+    return Status::NotImplemented("Compare not implemented for type ", type.ToString());
+  }
+  return Status::OK();
+}
+
 ARROW_EXPORT
-Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+Status Compare(FunctionContext* context, const Datum& left_arg, const Datum& right_arg,
                struct CompareOptions options, Datum* out) {
   DCHECK(out);
 
-  DCHECK_EQ(left.kind(), Datum::ARRAY);
-  DCHECK_EQ(right.kind(), Datum::SCALAR);
-  DCHECK(left.type()->Equals(right.type()));
+  // The operands are copied as out may be one of them and is overwritten by
+  // PrepareOutput.
+  const Datum left = left_arg;
+  const Datum right = right_arg;
 
-  auto array = left.make_array();
-  auto type = array->type();
-
-  auto fn = MakeCompareFilterFunction(context, *type, options);
-  if (fn == nullptr) {
-    return Status::NotImplemented("Compare not implemented for type ", type->ToString());
+  if (left.kind() == Datum::SCALAR && right.kind() == Datum::ARRAY) {
+    CompareOptions mirrored(MirrorOperator(options.op));
+    mirrored.reuse_output = options.reuse_output;
+    return Compare(context, right, left, mirrored, out);
   }
+  RETURN_NOT_OK(ValidateCompareOperands(left, right));
+
+  const auto& array = *left.array();
+  std::shared_ptr<FilterFunction> fn;
+  RETURN_NOT_OK(GetCompareFunction(context, *array.type, options, &fn));
 
   FilterBinaryKernel filter_kernel(fn);
-  detail::PrimitiveAllocatingBinaryKernel kernel(&filter_kernel);
-  out->value = ArrayData::Make(filter_kernel.out_type(), array->length());
+  RETURN_NOT_OK(detail::PrepareOutput(context, filter_kernel.out_type(), array.length,
+                                      options.reuse_output, out));
+
+  return filter_kernel.Call(context, left, right, out);
+}
 
-  return kernel.Call(context, left, right, out);
+ARROW_EXPORT
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               struct CompareOptions options, const SelectionVector* selection,
+               std::shared_ptr<SelectionVector>* out) {
+  DCHECK(out);
+
+  if (left.kind() == Datum::SCALAR && right.kind() == Datum::ARRAY) {
+    return Compare(context, right, left, CompareOptions(MirrorOperator(options.op)),
+                   selection, out);
+  }
+  RETURN_NOT_OK(ValidateCompareOperands(left, right));
+
+  const auto& array = *left.array();
+  if (selection != nullptr && selection->array_length() != array.length) {
+    return Status::Invalid("Selection of length ", selection->array_length(),
+                           " does not apply to an array of length ", array.length);
+  }
+  std::shared_ptr<FilterFunction> fn;
+  RETURN_NOT_OK(GetCompareFunction(context, *array.type, options, &fn));
+
+  if (right.kind() == Datum::ARRAY) {
+    return fn->Select(array, *right.array(), selection, out);
+  }
+  return fn->Select(array, *right.scalar(), selection, out);
 }
 
 }  // namespace compute
@@ -33,6 +33,7 @@ namespace compute {
 struct Datum;
 class FilterFunction;
 class FunctionContext;
+class SelectionVector;
 
 enum CompareOperator {
   EQUAL,
@@ -80,6 +81,10 @@ struct CompareOptions {
   explicit CompareOptions(CompareOperator op) : op(op) {}
 
   enum CompareOperator op;
+
+  /// Whether Compare may write its result into the buffer of the array held
+  /// by out, see Compare().
+  bool reuse_output = false;
 };
 
 /// \brief Return a Compare FilterFunction
@@ -95,14 +100,24 @@ std::shared_ptr<FilterFunction> MakeCompareFilterFunction(FunctionContext* conte
                                                           const DataType& type,
                                                           struct CompareOptions options);
 
-/// \brief Compare a numeric array with a scalar.
+/// \brief Compare a numeric array with a scalar or with another array.
+///
+/// Arrays are compared element-wise and must have the same length. A scalar
+/// is broadcast to the length of the array and may be on either side. The
+/// result slot is null if either input slot is null.
+///
+/// If options.reuse_output is true and out already holds a BooleanArray of
+/// the right length with a mutable buffer, e.g. the result of a previous
+/// comparison which is not needed anymore, the result is written into that
+/// buffer instead of a new allocation. Arrays sharing that buffer then see
+/// their values change, so the caller must own it exclusively.
 ///
 /// \param[in] context the FunctionContext
-/// \param[in] left datum to compare, must be an Array
-/// \param[in] right datum to compare, must be a Scalar of the same type than
-///            left Datum.
+/// \param[in] left datum to compare, an Array or a Scalar
+/// \param[in] right datum to compare, an Array or a Scalar of the same type
+///            than left Datum. At least one of left and right is an Array.
 /// \param[in] options compare options
-/// \param[out] out resulting datum
+/// \param[in,out] out resulting datum
 ///
 /// Note on floating point arrays, this uses ieee-754 compare semantics.
 ///
@@ -112,5 +127,29 @@ ARROW_EXPORT
 Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
                struct CompareOptions options, Datum* out);
 
+/// \brief Return the positions where a comparison holds
+///
+/// Like Compare, but the result is the SelectionVector of the slots where the
+/// boolean result would be true, and no boolean array is materialized. If
+/// selection is not null, only its positions are compared: a conjunction of
+/// comparisons narrows down a selection without intermediate arrays.
+///
+/// For example given left = [5, null, 1, 7], right = 3 and a GREATER
+/// operator, the output positions are [0, 3].
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left datum to compare, an Array or a Scalar
+/// \param[in] right datum to compare, an Array or a Scalar of the same type
+/// \param[in] options compare options
+/// \param[in] selection if not null, the only positions to compare
+/// \param[out] out the positions where the comparison is true
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               struct CompareOptions options, const SelectionVector* selection,
+               std::shared_ptr<SelectionVector>* out);
+
 }  // namespace compute
 }  // namespace arrow
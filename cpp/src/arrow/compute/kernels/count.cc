@@ -19,6 +19,8 @@
 
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/selection-vector.h"
+#include "arrow/util/bit-util.h"
 
 namespace arrow {
 namespace compute {
@@ -65,6 +67,25 @@ class CountAggregateFunction final : public AggregateFunctionStaticState<CountSt
     return Status::OK();
   }
 
+  Status ConsumeSelection(const Array& input, const SelectionVector& selection,
+                          CountState* state) const override {
+    const int64_t length = selection.length();
+    int64_t non_nulls = length;
+    if (input.null_count() != 0) {
+      const uint8_t* bitmap = input.null_bitmap_data();
+      const int32_t* indices = selection.raw_indices();
+      non_nulls = 0;
+      for (int64_t i = 0; i < length; i++) {
+        non_nulls += BitUtil::GetBit(bitmap, input.offset() + indices[i]);
+      }
+    }
+
+    state->nulls = length - non_nulls;
+    state->non_nulls = non_nulls;
+
+    return Status::OK();
+  }
+
   Status Merge(const CountState& src, CountState* dst) const override {
     *dst += src;
     return Status::OK();
@@ -98,7 +119,9 @@ std::shared_ptr<AggregateFunction> MakeCountAggregateFunction(
 
 Status Count(FunctionContext* context, const CountOptions& options, const Datum& value,
              Datum* out) {
-  if (!value.is_array()) return Status::Invalid("Count is expecting an array datum.");
+  if (!value.is_arraylike()) {
+    return Status::Invalid("Count is expecting an array-like datum.");
+  }
 
   auto aggregate = MakeCountAggregateFunction(context, options);
   auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
@@ -111,5 +134,13 @@ Status Count(FunctionContext* context, const CountOptions& options, const Array&
   return Count(context, options, array.data(), out);
 }
 
+Status Count(FunctionContext* context, const CountOptions& options, const Datum& value,
+             const SelectionVector& selection, Datum* out) {
+  auto aggregate = MakeCountAggregateFunction(context, options);
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+
+  return kernel->Call(context, value, selection, out);
+}
+
 }  // namespace compute
 }  // namespace arrow
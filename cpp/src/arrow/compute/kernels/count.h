@@ -35,6 +35,7 @@ namespace compute {
 struct Datum;
 class FunctionContext;
 class AggregateFunction;
+class SelectionVector;
 
 /// \class CountOptions
 ///
@@ -84,5 +85,19 @@ ARROW_EXPORT
 Status Count(FunctionContext* context, const CountOptions& options, const Array& array,
              Datum* out);
 
+/// \brief Count non-null (or null) values among the selected slots of an array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options counting options, see CountOptions for more information
+/// \param[in] datum to count, expecting Array
+/// \param[in] selection positions of the slots to count
+/// \param[out] out resulting datum
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Count(FunctionContext* context, const CountOptions& options, const Datum& datum,
+             const SelectionVector& selection, Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
@@ -20,6 +20,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -27,6 +28,7 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/selection-vector.h"
 #include "arrow/compute/test-util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -224,5 +226,175 @@ TYPED_TEST(TestNumericCompareKernel, RandomCompareArrayScalar) {
   }
 }
 
+
+TYPED_TEST(TestNumericCompareKernel, SimpleCompareScalarArray) {
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  Datum one(std::make_shared<ScalarType>(CType(1)));
+  auto array = ArrayFromJSON(type, "[0,1,2,null]");
+
+  // The operator is mirrored when the scalar is on the left side.
+  CompareOptions lt(CompareOperator::LESS);
+  ValidateCompare<TypeParam>(&this->ctx_, lt, one, array,
+                             ArrayFromJSON(boolean(), "[0,0,1,null]"));
+  CompareOptions gte(CompareOperator::GREATER_EQUAL);
+  ValidateCompare<TypeParam>(&this->ctx_, gte, one, array,
+                             ArrayFromJSON(boolean(), "[1,1,0,null]"));
+  CompareOptions neq(CompareOperator::NOT_EQUAL);
+  ValidateCompare<TypeParam>(&this->ctx_, neq, one, array,
+                             ArrayFromJSON(boolean(), "[1,0,1,null]"));
+}
+
+TYPED_TEST(TestNumericCompareKernel, SimpleCompareArrayArray) {
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  auto lhs = ArrayFromJSON(type, "[0,1,2,3,null,5]");
+  auto rhs = ArrayFromJSON(type, "[1,1,1,null,4,0]");
+
+  ValidateCompare<TypeParam>(&this->ctx_, CompareOptions(EQUAL), lhs, rhs,
+                             ArrayFromJSON(boolean(), "[0,1,0,null,null,0]"));
+  ValidateCompare<TypeParam>(&this->ctx_, CompareOptions(GREATER), lhs, rhs,
+                             ArrayFromJSON(boolean(), "[0,0,1,null,null,1]"));
+  ValidateCompare<TypeParam>(&this->ctx_, CompareOptions(LESS_EQUAL), lhs, rhs,
+                             ArrayFromJSON(boolean(), "[1,1,0,null,null,0]"));
+  ValidateCompare<TypeParam>(&this->ctx_, CompareOptions(LESS), lhs->Slice(1),
+                             rhs->Slice(1),
+                             ArrayFromJSON(boolean(), "[0,0,null,null,0]"));
+
+  Datum out;
+  ASSERT_RAISES(Invalid, Compare(&this->ctx_, lhs, rhs->Slice(1), CompareOptions(EQUAL),
+                                 &out));
+}
+
+TYPED_TEST(TestNumericCompareKernel, RandomCompareArrayArray) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  auto rand = random::RandomArrayGenerator(0x5416448);
+  for (int64_t length : {0, 1, 7, 8, 9, 100, 1000}) {
+    for (auto null_probability : {0.0, 0.1, 1.0}) {
+      auto lhs = rand.Numeric<TypeParam>(length, 0, 10, null_probability);
+      auto rhs = rand.Numeric<TypeParam>(length, 0, 10, null_probability);
+      const auto& left = static_cast<const ArrayType&>(*lhs);
+      const auto& right = static_cast<const ArrayType&>(*rhs);
+
+      for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+        std::vector<bool> is_valid(length), values(length);
+        for (int64_t i = 0; i < length; i++) {
+          is_valid[i] = left.IsValid(i) && right.IsValid(i);
+          values[i] = SlowCompare(op, left.Value(i), right.Value(i));
+        }
+        std::shared_ptr<Array> expected;
+        ArrayFromVector<BooleanType>(is_valid, values, &expected);
+        ValidateCompare<TypeParam>(&this->ctx_, CompareOptions(op), lhs, rhs, expected);
+      }
+    }
+  }
+}
+
+class TestCompareKernel : public ComputeFixture, public TestBase {};
+
+TEST_F(TestCompareKernel, ReusePreallocated) {
+  auto lhs = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  auto rhs = ArrayFromJSON(int32(), "[4, 2, 3, 1]");
+
+  CompareOptions less(LESS);
+  less.reuse_output = true;
+  Datum out;
+  ASSERT_OK(Compare(&this->ctx_, lhs, rhs, less, &out));
+  const uint8_t* bitmap = out.array()->buffers[1]->data();
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[1, 0, null, 0]"), *out.make_array());
+
+  // Also reused with the scalar on the left side
+  CompareOptions less_equal(LESS_EQUAL);
+  less_equal.reuse_output = true;
+  ASSERT_OK(Compare(&this->ctx_, Datum(int32_t(2)), lhs, less_equal, &out));
+  ASSERT_EQ(bitmap, out.array()->buffers[1]->data());
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[0, 1, null, 1]"), *out.make_array());
+
+  ASSERT_RAISES(Invalid, Compare(&this->ctx_, lhs, Datum(int64_t(2)),
+                                 CompareOptions(EQUAL), &out));
+}
+
+TEST_F(TestCompareKernel, NoReuseByDefault) {
+  auto lhs = ArrayFromJSON(int32(), "[1, 2, 3, 4]");
+  auto rhs = ArrayFromJSON(int32(), "[0, 0, 0, 0]");
+
+  Datum out;
+  ASSERT_OK(Compare(&this->ctx_, lhs, lhs, CompareOptions(EQUAL), &out));
+  auto first = out.make_array();
+
+  // A result from an earlier call is left unchanged
+  ASSERT_OK(Compare(&this->ctx_, lhs, rhs, CompareOptions(EQUAL), &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, true, true, true]"), *first);
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, false, false, false]"),
+                    *out.make_array());
+}
+
+TEST_F(TestCompareKernel, OutputAliasesInput) {
+  auto lhs = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  auto rhs = ArrayFromJSON(int32(), "[4, 2, 3, 1]");
+
+  Datum left(lhs), right(rhs);
+  ASSERT_OK(Compare(&this->ctx_, left, right, CompareOptions(LESS), &left));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[1, 0, null, 0]"), *left.make_array());
+
+  ASSERT_OK(Compare(&this->ctx_, Datum(int32_t(2)), right, CompareOptions(LESS), &right));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[1, 0, 1, 0]"), *right.make_array());
+}
+
+TEST_F(TestCompareKernel, Selection) {
+  auto lhs = ArrayFromJSON(int32(), "[5, null, 1, 7, 3, 9]");
+  auto rhs = ArrayFromJSON(int32(), "[5, 2, 2, 8, 1, null]");
+
+  std::shared_ptr<SelectionVector> out;
+  ASSERT_OK(Compare(&this->ctx_, lhs, Datum(int32_t(3)), CompareOptions(GREATER),
+                    nullptr, &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3, 5]"), *out->indices());
+  ASSERT_EQ(6, out->array_length());
+
+  // A scalar on the left mirrors the operator
+  ASSERT_OK(Compare(&this->ctx_, Datum(int32_t(3)), lhs, CompareOptions(GREATER),
+                    nullptr, &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2]"), *out->indices());
+
+  ASSERT_OK(Compare(&this->ctx_, lhs, rhs, CompareOptions(LESS_EQUAL), nullptr, &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 2, 3]"), *out->indices());
+
+  // A conjunction narrows the candidates down
+  std::shared_ptr<SelectionVector> narrowed;
+  ASSERT_OK(Compare(&this->ctx_, lhs, Datum(int32_t(1)), CompareOptions(NOT_EQUAL),
+                    out.get(), &narrowed));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3]"), *narrowed->indices());
+
+  // The result agrees with the boolean output
+  auto random = random::RandomArrayGenerator(0x5416447);
+  auto values = random.Numeric<Int64Type>(1000, 0, 100, 0.1);
+  Datum mask;
+  ASSERT_OK(
+      Compare(&this->ctx_, values, Datum(int64_t(50)), CompareOptions(LESS), &mask));
+  std::shared_ptr<SelectionVector> expected;
+  ASSERT_OK(SelectionVector::FromMask(default_memory_pool(), *mask.make_array(),
+                                      &expected));
+  ASSERT_OK(Compare(&this->ctx_, values, Datum(int64_t(50)), CompareOptions(LESS),
+                    nullptr, &out));
+  ASSERT_TRUE(out->Equals(*expected));
+}
+
+TEST_F(TestCompareKernel, SelectionErrors) {
+  auto lhs = ArrayFromJSON(int32(), "[5, null, 1]");
+  std::shared_ptr<SelectionVector> out;
+
+  ASSERT_OK(Compare(&this->ctx_, lhs, Datum(std::make_shared<Int32Scalar>(3, false)),
+                    CompareOptions(EQUAL), nullptr, &out));
+  ASSERT_EQ(0, out->length());
+
+  SelectionVector other(ArrayFromJSON(int32(), "[0]"), 4);
+  ASSERT_RAISES(Invalid, Compare(&this->ctx_, lhs, Datum(int32_t(3)),
+                                 CompareOptions(EQUAL), &other, &out));
+  ASSERT_RAISES(Invalid, Compare(&this->ctx_, lhs, Datum(int64_t(3)),
+                                 CompareOptions(EQUAL), nullptr, &out));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -24,6 +24,23 @@ namespace arrow {
 
 namespace compute {
 
+Status FilterFunction::Filter(const ArrayData& left, const ArrayData& right,
+                              ArrayData* output) const {
+  return Status::NotImplemented("Filter of two arrays not implemented for this filter");
+}
+
+Status FilterFunction::Select(const ArrayData& input, const Scalar& scalar,
+                              const SelectionVector* candidates,
+                              std::shared_ptr<SelectionVector>* out) const {
+  return Status::NotImplemented("Select not implemented for this filter");
+}
+
+Status FilterFunction::Select(const ArrayData& left, const ArrayData& right,
+                              const SelectionVector* candidates,
+                              std::shared_ptr<SelectionVector>* out) const {
+  return Status::NotImplemented("Select not implemented for this filter");
+}
+
 std::shared_ptr<DataType> FilterBinaryKernel::out_type() const {
   return filter_function_->out_type();
 }
@@ -31,10 +48,12 @@ std::shared_ptr<DataType> FilterBinaryKernel::out_type() const {
 Status FilterBinaryKernel::Call(FunctionContext* ctx, const Datum& left,
                                 const Datum& right, Datum* out) {
   auto array = left.array();
-  auto scalar = right.scalar();
   auto result = out->array();
 
-  return filter_function_->Filter(*array, *scalar, result.get());
+  if (right.kind() == Datum::ARRAY) {
+    return filter_function_->Filter(*array, *right.array(), result.get());
+  }
+  return filter_function_->Filter(*array, *right.scalar(), result.get());
 }
 
 }  // namespace compute
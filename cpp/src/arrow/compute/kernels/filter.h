@@ -30,18 +30,36 @@ class Status;
 namespace compute {
 
 class FunctionContext;
+class SelectionVector;
 struct Datum;
 
 /// FilterFunction is an interface for Filters
 ///
 /// Filters takes an array and emits a selection vector. The selection vector
-/// is given in the form of a bitmask as a BooleanArray result.
+/// is given in the form of a bitmask as a BooleanArray result, or as the
+/// positions of the selected slots with Select.
 class ARROW_EXPORT FilterFunction {
  public:
   /// Filter an array with a scalar argument.
   virtual Status Filter(const ArrayData& input, const Scalar& scalar,
                         ArrayData* output) const = 0;
 
+  /// Filter an array with another array of the same length, element-wise.
+  virtual Status Filter(const ArrayData& left, const ArrayData& right,
+                        ArrayData* output) const;
+
+  /// Emit the positions where the filter of an array with a scalar holds.
+  /// Null slots are never selected. If candidates is not null, only its
+  /// positions are evaluated.
+  virtual Status Select(const ArrayData& input, const Scalar& scalar,
+                        const SelectionVector* candidates,
+                        std::shared_ptr<SelectionVector>* out) const;
+
+  /// Emit the positions where the element-wise filter of two arrays holds.
+  virtual Status Select(const ArrayData& left, const ArrayData& right,
+                        const SelectionVector* candidates,
+                        std::shared_ptr<SelectionVector>* out) const;
+
   /// By default, FilterFunction emits a result bitmap.
   virtual std::shared_ptr<DataType> out_type() const { return boolean(); }
 
@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/groupby.h"
+#include "arrow/compute/test-util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+class TestGroupByKernel : public ComputeFixture, public TestBase {
+ protected:
+  void AssertGroupBy(const std::vector<Datum>& keys, const std::vector<Datum>& values,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     const std::shared_ptr<DataType>& expected_type,
+                     const std::string& expected_json) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(GroupBy(&this->ctx_, keys, values, aggregates, &actual));
+    ASSERT_OK(ValidateArray(*actual));
+    AssertArraysEqual(*ArrayFromJSON(expected_type, expected_json), *actual);
+  }
+};
+
+TEST_F(TestGroupByKernel, SingleStringKey) {
+  auto keys = ArrayFromJSON(utf8(), R"(["a", "b", "a", null, "b", null, "c"])");
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3, 4, null, 6, null]");
+
+  auto expected_type = struct_({field("key_0", utf8()), field("sum_0", int64()),
+                                field("count_0", int64()), field("mean_0", float64()),
+                                field("min_0", int32()), field("max_0", int32())});
+  this->AssertGroupBy({keys}, {values},
+                      {{GroupByAggregate::SUM, 0},
+                       {GroupByAggregate::COUNT, 0},
+                       {GroupByAggregate::MEAN, 0},
+                       {GroupByAggregate::MIN, 0},
+                       {GroupByAggregate::MAX, 0}},
+                      expected_type,
+                      R"([["a", 4, 2, 2.0, 1, 3],
+                          ["b", 2, 1, 2.0, 2, 2],
+                          [null, 10, 2, 5.0, 4, 6],
+                          ["c", null, 0, null, null, null]])");
+}
+
+TEST_F(TestGroupByKernel, MultipleKeys) {
+  auto key0 = ArrayFromJSON(int64(), "[1, 1, 2, 1, null, 2, null]");
+  auto key1 = ArrayFromJSON(utf8(), R"(["x", "y", "x", "x", "x", "x", "x"])");
+  auto values = ArrayFromJSON(float64(), "[1.5, 2.0, 3.0, 4.5, 5.0, 6.0, 7.0]");
+
+  auto expected_type =
+      struct_({field("key_0", int64()), field("key_1", utf8()),
+               field("sum_0", float64()), field("max_0", float64())});
+  this->AssertGroupBy({key0, key1}, {values},
+                      {{GroupByAggregate::SUM, 0}, {GroupByAggregate::MAX, 0}},
+                      expected_type,
+                      R"([[1, "x", 6.0, 4.5],
+                          [1, "y", 2.0, 2.0],
+                          [2, "x", 9.0, 6.0],
+                          [null, "x", 12.0, 7.0]])");
+}
+
+TEST_F(TestGroupByKernel, ChunkedInputs) {
+  auto keys = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(int32(), "[]"),
+                  ArrayFromJSON(int32(), "[1, 3, 2]")});
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(uint8(), "[10]"), ArrayFromJSON(uint8(), "[20, 30, 40]"),
+                  ArrayFromJSON(uint8(), "[50]")});
+
+  auto expected_type = struct_({field("key_0", int32()), field("sum_0", uint64()),
+                                field("min_0", uint8())});
+  this->AssertGroupBy({keys}, {values},
+                      {{GroupByAggregate::SUM, 0}, {GroupByAggregate::MIN, 0}},
+                      expected_type, "[[1, 40, 10], [2, 70, 20], [3, 40, 40]]");
+}
+
+TEST_F(TestGroupByKernel, Merge) {
+  std::vector<std::shared_ptr<DataType>> key_types = {utf8(), boolean()};
+  std::vector<std::shared_ptr<DataType>> value_types = {int16()};
+  std::vector<GroupByAggregate> aggregates = {{GroupByAggregate::COUNT, 0},
+                                              {GroupByAggregate::SUM, 0}};
+
+  std::unique_ptr<GroupByKernel> left, right;
+  ASSERT_OK(GroupByKernel::Make(&this->ctx_, key_types, value_types, aggregates, &left));
+  ASSERT_OK(
+      GroupByKernel::Make(&this->ctx_, key_types, value_types, aggregates, &right));
+
+  ASSERT_OK(left->Consume({ArrayFromJSON(utf8(), R"(["a", "b", "a"])"),
+                           ArrayFromJSON(boolean(), "[true, true, false]")},
+                          {ArrayFromJSON(int16(), "[1, 2, 3]")}));
+  ASSERT_OK(right->Consume({ArrayFromJSON(utf8(), R"(["c", "a", null])"),
+                            ArrayFromJSON(boolean(), "[true, false, null]")},
+                           {ArrayFromJSON(int16(), "[4, null, 6]")}));
+  ASSERT_EQ(3, left->num_groups());
+  ASSERT_EQ(3, right->num_groups());
+
+  ASSERT_OK(left->Merge(*right));
+  ASSERT_EQ(5, left->num_groups());
+
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(left->Finish(&actual));
+  auto expected_type = struct_({field("key_0", utf8()), field("key_1", boolean()),
+                                field("count_0", int64()), field("sum_0", int64())});
+  AssertArraysEqual(*ArrayFromJSON(expected_type, R"([["a", true, 1, 1],
+                                                      ["b", true, 1, 2],
+                                                      ["a", false, 1, 3],
+                                                      ["c", true, 1, 4],
+                                                      [null, null, 1, 6]])"),
+                    *actual);
+}
+
+TEST_F(TestGroupByKernel, Errors) {
+  auto keys = ArrayFromJSON(utf8(), R"(["a", "b"])");
+  auto values = ArrayFromJSON(utf8(), R"(["c", "d"])");
+  std::shared_ptr<Array> out;
+
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, {}, {values},
+                                 {{GroupByAggregate::COUNT, 0}}, &out));
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, {keys}, {values},
+                                 {{GroupByAggregate::COUNT, 1}}, &out));
+  ASSERT_RAISES(NotImplemented, GroupBy(&this->ctx_, {keys}, {values},
+                                        {{GroupByAggregate::SUM, 0}}, &out));
+  ASSERT_RAISES(Invalid,
+                GroupBy(&this->ctx_, {keys}, {ArrayFromJSON(int8(), "[1, 2, 3]")},
+                        {{GroupByAggregate::SUM, 0}}, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,816 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/groupby.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/sum-internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::DictionaryTraits;
+using internal::HashTraits;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Key encoding
+//
+// Each key column maps its values to dense key ids through a memo table. A
+// null key gets its own id, allocated on first sight, so key ids do not
+// coincide with memo indices and both mappings are kept.
+
+class GroupKeyEncoder {
+ public:
+  virtual ~GroupKeyEncoder() = default;
+
+  // Write the key id of each slot of `data` into `out`.
+  virtual Status Encode(const ArrayData& data, int32_t* out) = 0;
+
+  // Materialize the key values of the given key ids.
+  virtual Status Decode(FunctionContext* ctx, const std::vector<int32_t>& ids,
+                        std::shared_ptr<Array>* out) const = 0;
+
+  // The number of distinct keys seen so far.
+  virtual int32_t num_ids() const = 0;
+};
+
+template <typename Type, typename Scalar>
+class GroupKeyEncoderImpl : public GroupKeyEncoder {
+ public:
+  explicit GroupKeyEncoderImpl(const std::shared_ptr<DataType>& type) : type_(type) {}
+
+  Status Encode(const ArrayData& data, int32_t* out) override {
+    out_ = out;
+    return ArrayDataVisitor<Type>::Visit(data, this);
+  }
+
+  Status Decode(FunctionContext* ctx, const std::vector<int32_t>& ids,
+                std::shared_ptr<Array>* out) const override {
+    std::shared_ptr<ArrayData> dict_data;
+    RETURN_NOT_OK(DictionaryTraits<Type>::GetDictionaryArrayData(
+        ctx->memory_pool(), type_, memo_table_, 0 /* start_offset */, &dict_data));
+
+    Int32Builder indices_builder(ctx->memory_pool());
+    RETURN_NOT_OK(indices_builder.Reserve(static_cast<int64_t>(ids.size())));
+    for (int32_t id : ids) {
+      const int32_t memo_index = id_to_memo_[id];
+      if (memo_index < 0) {
+        indices_builder.UnsafeAppendNull();
+      } else {
+        indices_builder.UnsafeAppend(memo_index);
+      }
+    }
+    std::shared_ptr<Array> indices;
+    RETURN_NOT_OK(indices_builder.Finish(&indices));
+
+    return Take(ctx, *MakeArray(dict_data), *indices, TakeOptions(), out);
+  }
+
+  int32_t num_ids() const override { return static_cast<int32_t>(id_to_memo_.size()); }
+
+  Status VisitNull() {
+    if (ARROW_PREDICT_FALSE(null_id_ < 0)) {
+      null_id_ = num_ids();
+      id_to_memo_.push_back(-1);
+    }
+    *out_++ = null_id_;
+    return Status::OK();
+  }
+
+  Status VisitValue(const Scalar& value) {
+    int32_t id;
+    auto on_found = [this, &id](int32_t memo_index) { id = memo_to_id_[memo_index]; };
+    auto on_not_found = [this, &id](int32_t memo_index) {
+      id = num_ids();
+      memo_to_id_.push_back(id);
+      id_to_memo_.push_back(memo_index);
+    };
+    memo_table_.GetOrInsert(value, on_found, on_not_found);
+    *out_++ = id;
+    return Status::OK();
+  }
+
+ private:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  std::shared_ptr<DataType> type_;
+  MemoTable memo_table_;
+  std::vector<int32_t> memo_to_id_;
+  std::vector<int32_t> id_to_memo_;
+  int32_t null_id_ = -1;
+  int32_t* out_ = NULLPTR;
+};
+
+template <typename Type, typename Enable = void>
+struct GroupKeyEncoderTraits {};
+
+template <typename Type>
+struct GroupKeyEncoderTraits<Type, enable_if_has_c_type<Type>> {
+  using EncoderImpl = GroupKeyEncoderImpl<Type, typename Type::c_type>;
+};
+
+template <typename Type>
+struct GroupKeyEncoderTraits<Type, enable_if_boolean<Type>> {
+  using EncoderImpl = GroupKeyEncoderImpl<Type, bool>;
+};
+
+template <typename Type>
+struct GroupKeyEncoderTraits<Type, enable_if_binary<Type>> {
+  using EncoderImpl = GroupKeyEncoderImpl<Type, util::string_view>;
+};
+
+template <typename Type>
+struct GroupKeyEncoderTraits<Type, enable_if_fixed_size_binary<Type>> {
+  using EncoderImpl = GroupKeyEncoderImpl<Type, util::string_view>;
+};
+
+#define PROCESS_SUPPORTED_KEY_TYPES(PROCESS) \
+  PROCESS(BooleanType)                       \
+  PROCESS(UInt8Type)                         \
+  PROCESS(Int8Type)                          \
+  PROCESS(UInt16Type)                        \
+  PROCESS(Int16Type)                         \
+  PROCESS(UInt32Type)                        \
+  PROCESS(Int32Type)                         \
+  PROCESS(UInt64Type)                        \
+  PROCESS(Int64Type)                         \
+  PROCESS(FloatType)                         \
+  PROCESS(DoubleType)                        \
+  PROCESS(Date32Type)                        \
+  PROCESS(Date64Type)                        \
+  PROCESS(Time32Type)                        \
+  PROCESS(Time64Type)                        \
+  PROCESS(TimestampType)                     \
+  PROCESS(BinaryType)                        \
+  PROCESS(StringType)                        \
+  PROCESS(FixedSizeBinaryType)               \
+  PROCESS(Decimal128Type)
+
+Status MakeGroupKeyEncoder(const std::shared_ptr<DataType>& type,
+                           std::unique_ptr<GroupKeyEncoder>* out) {
+  switch (type->id()) {
+#define PROCESS(InType)                                                        \
+  case InType::type_id:                                                        \
+    out->reset(new typename GroupKeyEncoderTraits<InType>::EncoderImpl(type)); \
+    return Status::OK();
+
+    PROCESS_SUPPORTED_KEY_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("GroupBy not implemented for key type ",
+                                type->ToString());
+}
+
+#undef PROCESS_SUPPORTED_KEY_TYPES
+
+// ----------------------------------------------------------------------
+// Per-group aggregate states
+//
+// A state only sees non-null values. The aggregate result of a group is null
+// when its state did not see any value.
+
+template <typename ArrowType,
+          typename SumType = typename FindAccumulatorType<ArrowType>::Type>
+struct GroupedSumState {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using OutType = SumType;
+
+  void Consume(CType value) {
+    sum += value;
+    ++count;
+  }
+
+  GroupedSumState& operator+=(const GroupedSumState& rhs) {
+    sum += rhs.sum;
+    count += rhs.count;
+    return *this;
+  }
+
+  typename OutType::c_type Finalize() const { return sum; }
+
+  static std::shared_ptr<DataType> out_type(const std::shared_ptr<DataType>&) {
+    return TypeTraits<OutType>::type_singleton();
+  }
+
+  int64_t count = 0;
+  typename SumType::c_type sum = 0;
+};
+
+template <typename ArrowType,
+          typename SumType = typename FindAccumulatorType<ArrowType>::Type>
+struct GroupedMeanState {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using OutType = DoubleType;
+
+  void Consume(CType value) {
+    sum += value;
+    ++count;
+  }
+
+  GroupedMeanState& operator+=(const GroupedMeanState& rhs) {
+    sum += rhs.sum;
+    count += rhs.count;
+    return *this;
+  }
+
+  double Finalize() const {
+    return static_cast<double>(sum) / static_cast<double>(count);
+  }
+
+  static std::shared_ptr<DataType> out_type(const std::shared_ptr<DataType>&) {
+    return TypeTraits<OutType>::type_singleton();
+  }
+
+  int64_t count = 0;
+  typename SumType::c_type sum = 0;
+};
+
+template <typename ArrowType>
+struct GroupedMinState {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using OutType = ArrowType;
+
+  void Consume(CType value) {
+    min = std::min(min, value);
+    ++count;
+  }
+
+  GroupedMinState& operator+=(const GroupedMinState& rhs) {
+    min = std::min(min, rhs.min);
+    count += rhs.count;
+    return *this;
+  }
+
+  CType Finalize() const { return min; }
+
+  static std::shared_ptr<DataType> out_type(const std::shared_ptr<DataType>& type) {
+    return type;
+  }
+
+  int64_t count = 0;
+  CType min = MinMaxBounds<CType>::min_identity();
+};
+
+template <typename ArrowType>
+struct GroupedMaxState {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using OutType = ArrowType;
+
+  void Consume(CType value) {
+    max = std::max(max, value);
+    ++count;
+  }
+
+  GroupedMaxState& operator+=(const GroupedMaxState& rhs) {
+    max = std::max(max, rhs.max);
+    count += rhs.count;
+    return *this;
+  }
+
+  CType Finalize() const { return max; }
+
+  static std::shared_ptr<DataType> out_type(const std::shared_ptr<DataType>& type) {
+    return type;
+  }
+
+  int64_t count = 0;
+  CType max = MinMaxBounds<CType>::max_identity();
+};
+
+// ----------------------------------------------------------------------
+// Grouped aggregators
+
+class GroupedAggregator {
+ public:
+  virtual ~GroupedAggregator() = default;
+
+  // Grow the number of states to the current number of groups.
+  virtual void Resize(int64_t num_groups) = 0;
+
+  // Consume values into the states of their respective group.
+  virtual void Consume(const ArrayData& values, const int32_t* group_ids) = 0;
+
+  // Merge the states of `other`, state i being merged into group_id_mapping[i].
+  virtual void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) = 0;
+
+  // Convert the states into one result per group.
+  virtual Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const = 0;
+};
+
+template <typename ArrowType, typename StateType>
+class GroupedAggregatorImpl final : public GroupedAggregator {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using OutType = typename StateType::OutType;
+
+ public:
+  explicit GroupedAggregatorImpl(const std::shared_ptr<DataType>& type) : type_(type) {}
+
+  void Resize(int64_t num_groups) override {
+    states_.resize(static_cast<size_t>(num_groups));
+  }
+
+  void Consume(const ArrayData& values, const int32_t* group_ids) override {
+    const CType* raw_values = values.GetValues<CType>(1);
+    StateType* states = states_.data();
+
+    if (values.null_count == 0) {
+      for (int64_t i = 0; i < values.length; i++) {
+        states[group_ids[i]].Consume(raw_values[i]);
+      }
+    } else {
+      internal::BitmapReader reader(values.buffers[0]->data(), values.offset,
+                                    values.length);
+      for (int64_t i = 0; i < values.length; i++) {
+        if (reader.IsSet()) {
+          states[group_ids[i]].Consume(raw_values[i]);
+        }
+        reader.Next();
+      }
+    }
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) override {
+    const auto& other_states = checked_cast<const GroupedAggregatorImpl&>(other).states_;
+    for (size_t i = 0; i < other_states.size(); i++) {
+      states_[group_id_mapping[i]] += other_states[i];
+    }
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const override {
+    NumericBuilder<OutType> builder(StateType::out_type(type_), pool);
+    RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(states_.size())));
+    for (const auto& state : states_) {
+      if (state.count > 0) {
+        builder.UnsafeAppend(state.Finalize());
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    return builder.Finish(out);
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  std::vector<StateType> states_;
+};
+
+// Count only looks at the validity bitmap, thus supports any value type.
+class GroupedCountAggregator final : public GroupedAggregator {
+ public:
+  void Resize(int64_t num_groups) override {
+    counts_.resize(static_cast<size_t>(num_groups), 0);
+  }
+
+  void Consume(const ArrayData& values, const int32_t* group_ids) override {
+    int64_t* counts = counts_.data();
+
+    if (values.null_count == 0) {
+      for (int64_t i = 0; i < values.length; i++) {
+        counts[group_ids[i]]++;
+      }
+    } else if (values.null_count != values.length) {
+      internal::BitmapReader reader(values.buffers[0]->data(), values.offset,
+                                    values.length);
+      for (int64_t i = 0; i < values.length; i++) {
+        counts[group_ids[i]] += reader.IsSet();
+        reader.Next();
+      }
+    }
+  }
+
+  void Merge(const GroupedAggregator& other, const int32_t* group_id_mapping) override {
+    const auto& other_counts = checked_cast<const GroupedCountAggregator&>(other).counts_;
+    for (size_t i = 0; i < other_counts.size(); i++) {
+      counts_[group_id_mapping[i]] += other_counts[i];
+    }
+  }
+
+  Status Finalize(MemoryPool* pool, std::shared_ptr<Array>* out) const override {
+    Int64Builder builder(pool);
+    RETURN_NOT_OK(builder.AppendValues(counts_));
+    return builder.Finish(out);
+  }
+
+ private:
+  std::vector<int64_t> counts_;
+};
+
+#define GROUPED_AGG_CASE(T, STATE)                            \
+  case T::type_id:                                            \
+    out->reset(new GroupedAggregatorImpl<T, STATE<T>>(type)); \
+    return Status::OK();
+
+#define GROUPED_NUMERIC_AGG_CASES(STATE) \
+  GROUPED_AGG_CASE(UInt8Type, STATE)     \
+  GROUPED_AGG_CASE(Int8Type, STATE)      \
+  GROUPED_AGG_CASE(UInt16Type, STATE)    \
+  GROUPED_AGG_CASE(Int16Type, STATE)     \
+  GROUPED_AGG_CASE(UInt32Type, STATE)    \
+  GROUPED_AGG_CASE(Int32Type, STATE)     \
+  GROUPED_AGG_CASE(UInt64Type, STATE)    \
+  GROUPED_AGG_CASE(Int64Type, STATE)     \
+  GROUPED_AGG_CASE(FloatType, STATE)     \
+  GROUPED_AGG_CASE(DoubleType, STATE)
+
+#define GROUPED_TEMPORAL_AGG_CASES(STATE) \
+  GROUPED_AGG_CASE(Date32Type, STATE)     \
+  GROUPED_AGG_CASE(Date64Type, STATE)     \
+  GROUPED_AGG_CASE(Time32Type, STATE)     \
+  GROUPED_AGG_CASE(Time64Type, STATE)     \
+  GROUPED_AGG_CASE(TimestampType, STATE)
+
+Status MakeGroupedAggregator(const GroupByAggregate& aggregate,
+                             const std::shared_ptr<DataType>& type,
+                             std::unique_ptr<GroupedAggregator>* out) {
+  switch (aggregate.aggregate_kind) {
+    case GroupByAggregate::COUNT:
+      out->reset(new GroupedCountAggregator());
+      return Status::OK();
+    case GroupByAggregate::SUM:
+      switch (type->id()) {
+        GROUPED_NUMERIC_AGG_CASES(GroupedSumState)
+        default:
+          break;
+      }
+      break;
+    case GroupByAggregate::MEAN:
+      switch (type->id()) {
+        GROUPED_NUMERIC_AGG_CASES(GroupedMeanState)
+        default:
+          break;
+      }
+      break;
+    case GroupByAggregate::MIN:
+      switch (type->id()) {
+        GROUPED_NUMERIC_AGG_CASES(GroupedMinState)
+        GROUPED_TEMPORAL_AGG_CASES(GroupedMinState)
+        default:
+          break;
+      }
+      break;
+    case GroupByAggregate::MAX:
+      switch (type->id()) {
+        GROUPED_NUMERIC_AGG_CASES(GroupedMaxState)
+        GROUPED_TEMPORAL_AGG_CASES(GroupedMaxState)
+        default:
+          break;
+      }
+      break;
+    default:
+      return Status::Invalid("Unknown GroupByAggregate encountered");
+  }
+  return Status::NotImplemented("GroupBy aggregate not implemented for value type ",
+                                type->ToString());
+}
+
+#undef GROUPED_TEMPORAL_AGG_CASES
+#undef GROUPED_NUMERIC_AGG_CASES
+#undef GROUPED_AGG_CASE
+
+std::string AggregateFieldName(const GroupByAggregate& aggregate) {
+  static const char* names[] = {"sum", "count", "mean", "min", "max"};
+  return std::string(names[aggregate.aggregate_kind]) + "_" +
+         std::to_string(aggregate.value_index);
+}
+
+// ----------------------------------------------------------------------
+// Kernel implementation
+
+class GroupByKernelImpl final : public GroupByKernel {
+ public:
+  GroupByKernelImpl(FunctionContext* ctx,
+                    const std::vector<std::shared_ptr<DataType>>& key_types,
+                    const std::vector<std::shared_ptr<DataType>>& value_types,
+                    const std::vector<GroupByAggregate>& aggregates)
+      : ctx_(ctx),
+        key_types_(key_types),
+        value_types_(value_types),
+        aggregates_(aggregates) {}
+
+  Status Init() {
+    if (key_types_.empty()) {
+      return Status::Invalid("GroupBy requires at least one key");
+    }
+    for (const auto& type : key_types_) {
+      std::unique_ptr<GroupKeyEncoder> encoder;
+      RETURN_NOT_OK(MakeGroupKeyEncoder(type, &encoder));
+      encoders_.push_back(std::move(encoder));
+    }
+    for (const auto& aggregate : aggregates_) {
+      if (aggregate.value_index < 0 ||
+          aggregate.value_index >= static_cast<int>(value_types_.size())) {
+        return Status::Invalid("GroupBy aggregate references value ",
+                               aggregate.value_index, " out of ",
+                               value_types_.size());
+      }
+      std::unique_ptr<GroupedAggregator> aggregator;
+      RETURN_NOT_OK(MakeGroupedAggregator(aggregate, value_types_[aggregate.value_index],
+                                          &aggregator));
+      aggregators_.push_back(std::move(aggregator));
+    }
+    return Status::OK();
+  }
+
+  Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                 const std::vector<std::shared_ptr<Array>>& values) override {
+    RETURN_NOT_OK(CheckInputs(keys, key_types_, "key"));
+    RETURN_NOT_OK(CheckInputs(values, value_types_, "value"));
+    const int64_t length = keys[0]->length();
+    for (const auto& value : values) {
+      if (value->length() != length) {
+        return Status::Invalid("GroupBy keys and values must have the same length");
+      }
+    }
+
+    RETURN_NOT_OK(AssignGroups(keys, &group_ids_));
+    for (size_t i = 0; i < aggregators_.size(); i++) {
+      aggregators_[i]->Resize(num_groups_);
+      aggregators_[i]->Consume(*values[aggregates_[i].value_index]->data(),
+                               group_ids_.data());
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const GroupByKernel& other) override {
+    const auto& other_impl = checked_cast<const GroupByKernelImpl&>(other);
+    if (other_impl.aggregators_.size() != aggregators_.size()) {
+      return Status::Invalid("Cannot merge GroupBy kernels with different aggregates");
+    }
+    if (other_impl.num_groups_ == 0) {
+      return Status::OK();
+    }
+
+    // Route the distinct keys of `other` through our own encoders, which
+    // yields the mapping from its group ids to ours.
+    std::vector<std::shared_ptr<Array>> other_keys;
+    RETURN_NOT_OK(other_impl.DecodeKeys(&other_keys));
+    RETURN_NOT_OK(CheckInputs(other_keys, key_types_, "key"));
+
+    std::vector<int32_t> group_id_mapping;
+    RETURN_NOT_OK(AssignGroups(other_keys, &group_id_mapping));
+    for (size_t i = 0; i < aggregators_.size(); i++) {
+      aggregators_[i]->Resize(num_groups_);
+      aggregators_[i]->Merge(*other_impl.aggregators_[i], group_id_mapping.data());
+    }
+    return Status::OK();
+  }
+
+  Status Finish(std::shared_ptr<Array>* out) override {
+    std::vector<std::shared_ptr<Array>> columns;
+    RETURN_NOT_OK(DecodeKeys(&columns));
+
+    std::vector<std::shared_ptr<Field>> fields;
+    for (size_t i = 0; i < columns.size(); i++) {
+      fields.push_back(field("key_" + std::to_string(i), columns[i]->type()));
+    }
+
+    for (size_t i = 0; i < aggregators_.size(); i++) {
+      std::shared_ptr<Array> column;
+      aggregators_[i]->Resize(num_groups_);
+      RETURN_NOT_OK(aggregators_[i]->Finalize(ctx_->memory_pool(), &column));
+      fields.push_back(field(AggregateFieldName(aggregates_[i]), column->type()));
+      columns.push_back(std::move(column));
+    }
+
+    *out = std::make_shared<StructArray>(struct_(fields), num_groups_, columns);
+    return Status::OK();
+  }
+
+  int64_t num_groups() const override { return num_groups_; }
+
+ private:
+  static Status CheckInputs(const std::vector<std::shared_ptr<Array>>& arrays,
+                            const std::vector<std::shared_ptr<DataType>>& types,
+                            const char* kind) {
+    if (arrays.size() != types.size()) {
+      return Status::Invalid("GroupBy expected ", types.size(), " ", kind,
+                             " columns, got ", arrays.size());
+    }
+    for (size_t i = 0; i < arrays.size(); i++) {
+      if (!arrays[i]->type()->Equals(*types[i])) {
+        return Status::TypeError("GroupBy ", kind, " column ", i, " has type ",
+                                 arrays[i]->type()->ToString(), ", expected ",
+                                 types[i]->ToString());
+      }
+    }
+    return Status::OK();
+  }
+
+  // Compute the group id of each row, registering new groups as needed.
+  Status AssignGroups(const std::vector<std::shared_ptr<Array>>& keys,
+                      std::vector<int32_t>* group_ids) {
+    const int64_t length = keys[0]->length();
+    for (const auto& key : keys) {
+      if (key->length() != length) {
+        return Status::Invalid("GroupBy keys must have the same length");
+      }
+    }
+    group_ids->resize(static_cast<size_t>(length));
+
+    // With a single key, key ids are group ids.
+    if (encoders_.size() == 1) {
+      RETURN_NOT_OK(encoders_[0]->Encode(*keys[0]->data(), group_ids->data()));
+      num_groups_ = encoders_[0]->num_ids();
+      return Status::OK();
+    }
+
+    // Otherwise, the tuple of key ids of a row is hashed as a binary string.
+    const size_t num_keys = encoders_.size();
+    key_ids_.resize(num_keys * static_cast<size_t>(length));
+    for (size_t k = 0; k < num_keys; k++) {
+      RETURN_NOT_OK(encoders_[k]->Encode(*keys[k]->data(), &key_ids_[k * length]));
+    }
+
+    std::vector<int32_t> row_key(num_keys);
+    const auto row_key_size = static_cast<int32_t>(num_keys * sizeof(int32_t));
+    auto on_found = [](int32_t group_id) {};
+    auto on_not_found = [this, &row_key](int32_t group_id) {
+      group_key_ids_.insert(group_key_ids_.end(), row_key.begin(), row_key.end());
+    };
+    for (int64_t i = 0; i < length; i++) {
+      for (size_t k = 0; k < num_keys; k++) {
+        row_key[k] = key_ids_[k * length + i];
+      }
+      (*group_ids)[i] = group_memo_table_.GetOrInsert(row_key.data(), row_key_size,
+                                                       on_found, on_not_found);
+    }
+    num_groups_ = group_memo_table_.size();
+    return Status::OK();
+  }
+
+  // Materialize one array of distinct key values per key column.
+  Status DecodeKeys(std::vector<std::shared_ptr<Array>>* out) const {
+    const size_t num_keys = encoders_.size();
+    std::vector<int32_t> ids(static_cast<size_t>(num_groups_));
+    out->resize(num_keys);
+    for (size_t k = 0; k < num_keys; k++) {
+      for (size_t g = 0; g < ids.size(); g++) {
+        ids[g] = num_keys == 1 ? static_cast<int32_t>(g)
+                               : group_key_ids_[g * num_keys + k];
+      }
+      RETURN_NOT_OK(encoders_[k]->Decode(ctx_, ids, &(*out)[k]));
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::vector<std::shared_ptr<DataType>> key_types_;
+  std::vector<std::shared_ptr<DataType>> value_types_;
+  std::vector<GroupByAggregate> aggregates_;
+
+  std::vector<std::unique_ptr<GroupKeyEncoder>> encoders_;
+  std::vector<std::unique_ptr<GroupedAggregator>> aggregators_;
+
+  // Only used with multiple keys: group ids of key id tuples, and the key ids
+  // of each group (num_keys per group).
+  internal::BinaryMemoTable group_memo_table_;
+  std::vector<int32_t> group_key_ids_;
+
+  // Scratch space reused across batches.
+  std::vector<int32_t> group_ids_;
+  std::vector<int32_t> key_ids_;
+
+  int64_t num_groups_ = 0;
+};
+
+}  // namespace
+
+Status GroupByKernel::Make(FunctionContext* ctx,
+                           const std::vector<std::shared_ptr<DataType>>& key_types,
+                           const std::vector<std::shared_ptr<DataType>>& value_types,
+                           const std::vector<GroupByAggregate>& aggregates,
+                           std::unique_ptr<GroupByKernel>* out) {
+  std::unique_ptr<GroupByKernelImpl> kernel(
+      new GroupByKernelImpl(ctx, key_types, value_types, aggregates));
+  RETURN_NOT_OK(kernel->Init());
+  *out = std::move(kernel);
+  return Status::OK();
+}
+
+namespace {
+
+std::shared_ptr<ChunkedArray> AsChunkedArray(const Datum& datum) {
+  if (datum.kind() == Datum::CHUNKED_ARRAY) {
+    return datum.chunked_array();
+  }
+  return std::make_shared<ChunkedArray>(ArrayVector{datum.make_array()});
+}
+
+// Feed the kernel with slices of the columns, so that each batch is made of
+// contiguous arrays even when the columns are chunked differently.
+Status ConsumeAligned(const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                      size_t num_keys, GroupByKernel* kernel) {
+  const int64_t length = columns[0]->length();
+  for (const auto& column : columns) {
+    if (column->length() != length) {
+      return Status::Invalid("GroupBy keys and values must have the same length");
+    }
+  }
+
+  const size_t num_columns = columns.size();
+  std::vector<int> chunk_indices(num_columns, 0);
+  std::vector<int64_t> chunk_offsets(num_columns, 0);
+  std::vector<std::shared_ptr<Array>> keys(num_keys);
+  std::vector<std::shared_ptr<Array>> values(num_columns - num_keys);
+
+  for (int64_t position = 0; position < length;) {
+    int64_t slice_length = length - position;
+    for (size_t c = 0; c < num_columns; c++) {
+      // Skip exhausted (or empty) chunks
+      while (chunk_offsets[c] == columns[c]->chunk(chunk_indices[c])->length()) {
+        ++chunk_indices[c];
+        chunk_offsets[c] = 0;
+      }
+      const int64_t chunk_length = columns[c]->chunk(chunk_indices[c])->length();
+      slice_length = std::min(slice_length, chunk_length - chunk_offsets[c]);
+    }
+
+    for (size_t c = 0; c < num_columns; c++) {
+      const auto& chunk = columns[c]->chunk(chunk_indices[c]);
+      auto slice = (chunk_offsets[c] == 0 && slice_length == chunk->length())
+                       ? chunk
+                       : chunk->Slice(chunk_offsets[c], slice_length);
+      chunk_offsets[c] += slice_length;
+      if (c < num_keys) {
+        keys[c] = std::move(slice);
+      } else {
+        values[c - num_keys] = std::move(slice);
+      }
+    }
+
+    RETURN_NOT_OK(kernel->Consume(keys, values));
+    position += slice_length;
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status GroupBy(FunctionContext* ctx, const std::vector<Datum>& keys,
+               const std::vector<Datum>& values,
+               const std::vector<GroupByAggregate>& aggregates,
+               std::shared_ptr<Array>* out) {
+  std::vector<std::shared_ptr<DataType>> key_types, value_types;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (const auto& datum : keys) {
+    if (!datum.is_arraylike()) return Status::Invalid("GroupBy keys must be array-like");
+    key_types.push_back(datum.type());
+    columns.push_back(AsChunkedArray(datum));
+  }
+  for (const auto& datum : values) {
+    if (!datum.is_arraylike()) {
+      return Status::Invalid("GroupBy values must be array-like");
+    }
+    value_types.push_back(datum.type());
+    columns.push_back(AsChunkedArray(datum));
+  }
+
+  std::unique_ptr<GroupByKernel> kernel;
+  RETURN_NOT_OK(GroupByKernel::Make(ctx, key_types, value_types, aggregates, &kernel));
+  RETURN_NOT_OK(ConsumeAligned(columns, keys.size(), kernel.get()));
+  return kernel->Finish(out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \class GroupByAggregate
+///
+/// Describe one aggregate computed per group by the GroupBy kernel.
+struct ARROW_EXPORT GroupByAggregate {
+  enum kind {
+    // Sum of the non-null values, accumulated as in Sum.
+    SUM = 0,
+    // Number of non-null values.
+    COUNT,
+    // Mean of the non-null values as a double.
+    MEAN,
+    // Smallest non-null value.
+    MIN,
+    // Largest non-null value.
+    MAX,
+  };
+
+  GroupByAggregate(enum kind aggregate_kind, int value_index)
+      : aggregate_kind(aggregate_kind), value_index(value_index) {}
+
+  enum kind aggregate_kind;
+  /// Index of the aggregated column in the values passed to GroupBy.
+  int value_index;
+};
+
+/// \brief Stateful hash aggregation kernel
+///
+/// Key columns are assigned dense group ids through the util/hashing.h memo
+/// tables, in order of first appearance. Each aggregate keeps one partial
+/// state per group, updated in place as batches are consumed.
+///
+/// Partial results computed independently (e.g. one kernel per thread) are
+/// combined with Merge, following the AggregateFunction::Merge contract.
+class ARROW_EXPORT GroupByKernel {
+ public:
+  virtual ~GroupByKernel() = default;
+
+  /// \brief Create a kernel for the given key and value types
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] key_types types of the key columns, at least one
+  /// \param[in] value_types types of the value columns
+  /// \param[in] aggregates aggregates to compute, referencing value_types
+  /// \param[out] out the created kernel
+  static Status Make(FunctionContext* ctx,
+                     const std::vector<std::shared_ptr<DataType>>& key_types,
+                     const std::vector<std::shared_ptr<DataType>>& value_types,
+                     const std::vector<GroupByAggregate>& aggregates,
+                     std::unique_ptr<GroupByKernel>* out);
+
+  /// \brief Consume one batch of equal-length key and value arrays
+  virtual Status Consume(const std::vector<std::shared_ptr<Array>>& keys,
+                         const std::vector<std::shared_ptr<Array>>& values) = 0;
+
+  /// \brief Merge the groups and partial states of another kernel
+  ///
+  /// The other kernel must have been created with the same arguments. Groups
+  /// it saw that are unknown to this kernel are appended after this
+  /// kernel's groups.
+  virtual Status Merge(const GroupByKernel& other) = 0;
+
+  /// \brief Emit one row per group
+  ///
+  /// \param[out] out a StructArray with the key columns ("key_0", ...)
+  /// followed by one column per aggregate ("sum_1", "count_0", ...)
+  virtual Status Finish(std::shared_ptr<Array>* out) = 0;
+
+  /// \brief Number of groups seen so far
+  virtual int64_t num_groups() const = 0;
+};
+
+/// \brief Compute aggregates of value columns grouped by key columns.
+///
+/// Null keys form their own group. Groups are emitted in order of first
+/// appearance. All keys and values must be either Arrays or ChunkedArrays of
+/// the same length.
+///
+/// For example given keys = [["a", "b", "a", null]], values = [[1, 2, 3, 4]]
+/// and aggregates = [{SUM, 0}, {COUNT, 0}], the output is
+/// {key_0: ["a", "b", null], sum_0: [4, 2, 4], count_0: [2, 1, 1]}
+///
+/// \param[in] context the FunctionContext
+/// \param[in] keys array-like key columns
+/// \param[in] values array-like value columns
+/// \param[in] aggregates aggregates to compute
+/// \param[out] out resulting StructArray, see GroupByKernel::Finish
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* context, const std::vector<Datum>& keys,
+               const std::vector<Datum>& values,
+               const std::vector<GroupByAggregate>& aggregates,
+               std::shared_ptr<Array>* out);
+
+}  // namespace compute
+}  // namespace arrow
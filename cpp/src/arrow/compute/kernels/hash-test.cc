@@ -36,6 +36,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/thread-pool.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -471,5 +472,210 @@ TEST_F(TestHashKernel, ChunkedArrayInvoke) {
   AssertChunkedEqual(*dict_carr, *encoded_out.chunked_array());
 }
 
+TEST_F(TestHashKernel, UniqueChunkedThreaded) {
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(4, &pool));
+  FunctionContext ctx(default_memory_pool(), pool.get());
+
+  auto carr = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[3, 1, 3]"), ArrayFromJSON(int32(), "[]"),
+                  ArrayFromJSON(int32(), "[2, null, 1]"), ArrayFromJSON(int32(), "[4]")});
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Unique(&ctx, carr, &result));
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(int32(), "[3, 1, 2, 4]"), *result);
+}
+
+TEST_F(TestHashKernel, StreamingDictEncode) {
+  std::unique_ptr<HashKernel> kernel;
+  ASSERT_OK(GetDictionaryEncodeKernel(&this->ctx_, utf8(), &kernel));
+
+  // Indices of each batch refer to the dictionary grown by all the batches.
+  Datum out;
+  std::shared_ptr<ArrayData> delta;
+  ASSERT_OK(kernel->Call(&this->ctx_, ArrayFromJSON(utf8(), R"(["a", "b", "a"])"), &out));
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(int32(), "[0, 1, 0]"), *MakeArray(out.array()));
+  ASSERT_OK(kernel->GetDictionaryDelta(&delta));
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(utf8(), R"(["a", "b"])"), *MakeArray(delta));
+
+  auto sliced = ArrayFromJSON(utf8(), R"(["z", "c", null, "b", "d"])")->Slice(1);
+  ASSERT_OK(kernel->Call(&this->ctx_, sliced, &out));
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(int32(), "[2, null, 1, 3]"),
+                      *MakeArray(out.array()));
+  ASSERT_OK(kernel->GetDictionaryDelta(&delta));
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(utf8(), R"(["c", "d"])"), *MakeArray(delta));
+
+  // No new values, empty delta
+  ASSERT_OK(kernel->Call(&this->ctx_, ArrayFromJSON(utf8(), R"(["d"])"), &out));
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(int32(), "[3]"), *MakeArray(out.array()));
+  ASSERT_OK(kernel->GetDictionaryDelta(&delta));
+  ASSERT_EQ(0, delta->length);
+
+  std::shared_ptr<ArrayData> dictionary;
+  ASSERT_OK(kernel->GetDictionary(&dictionary));
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(utf8(), R"(["a", "b", "c", "d"])"),
+                      *MakeArray(dictionary));
+
+  ASSERT_OK(kernel->Reset());
+  ASSERT_OK(kernel->Call(&this->ctx_, ArrayFromJSON(utf8(), R"(["d"])"), &out));
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(int32(), "[0]"), *MakeArray(out.array()));
+  ASSERT_OK(kernel->GetDictionaryDelta(&delta));
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(utf8(), R"(["d"])"), *MakeArray(delta));
+}
+
+TEST_F(TestHashKernel, StreamingUniqueValueCounts) {
+  std::unique_ptr<HashKernel> unique;
+  std::unique_ptr<HashKernel> counts;
+  ASSERT_OK(GetUniqueKernel(&this->ctx_, int64(), &unique));
+  ASSERT_OK(GetValueCountsKernel(&this->ctx_, int64(), &counts));
+
+  std::shared_ptr<ArrayData> delta;
+  for (const char* batch : {"[5, 3, 5]", "[null, 3, 7]"}) {
+    auto values = ArrayFromJSON(int64(), batch);
+    ASSERT_OK(unique->Append(&this->ctx_, *values->data()));
+    ASSERT_OK(counts->Append(&this->ctx_, *values->data()));
+  }
+  ASSERT_OK(unique->GetDictionaryDelta(&delta));
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(int64(), "[5, 3, 7]"), *MakeArray(delta));
+
+  ASSERT_OK(unique->Append(&this->ctx_, *ArrayFromJSON(int64(), "[1, 7]")->data()));
+  ASSERT_OK(unique->GetDictionaryDelta(&delta));
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(int64(), "[1]"), *MakeArray(delta));
+
+  Datum value_counts;
+  ASSERT_OK(counts->FlushFinal(&value_counts));
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(int64(), "[2, 2, 1]"),
+                      *MakeArray(value_counts.array()));
+
+  ASSERT_RAISES(NotImplemented, GetUniqueKernel(&this->ctx_, list(int8()), &unique));
+}
+
+void CheckSetLookup(FunctionContext* ctx, const Datum& values, const Datum& member_set,
+                    const std::string& expected_is_in,
+                    const std::string& expected_match) {
+  Datum out;
+  ASSERT_OK(IsIn(ctx, values, member_set, &out));
+  ASSERT_EQ(Datum::ARRAY, out.kind());
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(boolean(), expected_is_in), *out.make_array());
+
+  ASSERT_OK(Match(ctx, values, member_set, &out));
+  ASSERT_EQ(Datum::ARRAY, out.kind());
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(int32(), expected_match), *out.make_array());
+}
+
+TEST_F(TestHashKernel, IsInMatchPrimitive) {
+  for (auto type : {int8(), uint32(), int64(), float64(), date32(),
+                    timestamp(TimeUnit::MILLI)}) {
+    CheckSetLookup(&this->ctx_, ArrayFromJSON(type, "[5, null, 1, 3, 5]"),
+                   ArrayFromJSON(type, "[3, 5, 3]"), "[true, null, false, true, true]",
+                   "[1, null, null, 0, 1]");
+    CheckSetLookup(&this->ctx_, ArrayFromJSON(type, "[5, null, 1]"),
+                   ArrayFromJSON(type, "[1, null, 5, null]"), "[true, true, true]",
+                   "[2, 1, 0]");
+    CheckSetLookup(&this->ctx_, ArrayFromJSON(type, "[5, null]"),
+                   ArrayFromJSON(type, "[]"), "[false, null]", "[null, null]");
+    CheckSetLookup(&this->ctx_, ArrayFromJSON(type, "[]"), ArrayFromJSON(type, "[1]"),
+                   "[]", "[]");
+  }
+  CheckSetLookup(&this->ctx_, ArrayFromJSON(boolean(), "[true, false, null]"),
+                 ArrayFromJSON(boolean(), "[false]"), "[false, true, null]",
+                 "[null, 0, null]");
+  CheckSetLookup(&this->ctx_, ArrayFromJSON(null(), "[null, null]"),
+                 ArrayFromJSON(null(), "[null]"), "[true, true]", "[0, 0]");
+  CheckSetLookup(&this->ctx_, ArrayFromJSON(null(), "[null]"),
+                 ArrayFromJSON(null(), "[]"), "[null]", "[null]");
+}
+
+TEST_F(TestHashKernel, IsInMatchBinary) {
+  for (auto type : {utf8(), binary()}) {
+    CheckSetLookup(&this->ctx_, ArrayFromJSON(type, R"(["foo", "", null, "bar"])"),
+                   ArrayFromJSON(type, R"(["bar", "", "bar"])"),
+                   "[false, true, null, true]", "[null, 1, null, 0]");
+  }
+  auto type = fixed_size_binary(2);
+  CheckSetLookup(&this->ctx_, ArrayFromJSON(type, R"(["ab", "cd", null])"),
+                 ArrayFromJSON(type, R"([null, "cd"])"), "[false, true, true]",
+                 "[null, 1, 0]");
+}
+
+TEST_F(TestHashKernel, IsInMatchChunked) {
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(int32(), "[null, 4]")});
+  auto member_set = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[4, 4]"), ArrayFromJSON(int32(), "[1, null]")});
+
+  Datum out;
+  ASSERT_OK(IsIn(&this->ctx_, values, member_set, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  AssertChunkedEqual(ChunkedArray({ArrayFromJSON(boolean(), "[true, false]"),
+                                   ArrayFromJSON(boolean(), "[true, true]")}),
+                     *out.chunked_array());
+
+  ASSERT_OK(Match(&this->ctx_, values, member_set, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  AssertChunkedEqual(ChunkedArray({ArrayFromJSON(int32(), "[2, null]"),
+                                   ArrayFromJSON(int32(), "[3, 0]")}),
+                     *out.chunked_array());
+
+  auto empty = std::make_shared<ChunkedArray>(ArrayVector{}, int32());
+  ASSERT_OK(Match(&this->ctx_, empty, member_set, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  ASSERT_EQ(0, out.chunked_array()->length());
+  ASSERT_TRUE(out.chunked_array()->type()->Equals(int32()));
+}
+
+TEST_F(TestHashKernel, IsInMatchChunkedThreaded) {
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(4, &pool));
+  FunctionContext ctx(default_memory_pool(), pool.get());
+
+  // The chunks share one kernel and are looked up concurrently
+  ArrayVector chunks, is_in_chunks, match_chunks;
+  for (int i = 0; i < 64; ++i) {
+    chunks.push_back(ArrayFromJSON(utf8(), R"(["b", null, "x", "a"])"));
+    is_in_chunks.push_back(ArrayFromJSON(boolean(), "[true, true, false, true]"));
+    match_chunks.push_back(ArrayFromJSON(int32(), "[1, 2, null, 0]"));
+  }
+  auto values = std::make_shared<ChunkedArray>(chunks);
+  auto member_set = ArrayFromJSON(utf8(), R"(["a", "b", null, "a"])");
+
+  Datum out;
+  ASSERT_OK(IsIn(&ctx, values, member_set, &out));
+  AssertChunkedEqual(ChunkedArray(is_in_chunks), *out.chunked_array());
+  ASSERT_OK(Match(&ctx, values, member_set, &out));
+  AssertChunkedEqual(ChunkedArray(match_chunks), *out.chunked_array());
+}
+
+TEST_F(TestHashKernel, IsInMatchDictionary) {
+  auto dict = ArrayFromJSON(utf8(), R"(["a", "b", "c"])");
+  auto dict_type = dictionary(int8(), dict);
+  auto values = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int8(), "[2, null, 0, 0, 1]"));
+
+  CheckSetLookup(&this->ctx_, values, ArrayFromJSON(utf8(), R"(["a", "c"])"),
+                 "[true, null, true, true, false]", "[1, null, 0, 0, null]");
+  CheckSetLookup(&this->ctx_, values, ArrayFromJSON(utf8(), R"(["b", null])"),
+                 "[false, true, false, false, true]", "[null, 1, null, null, 0]");
+
+  // Dictionary-encoded member set
+  auto member_set = std::make_shared<DictionaryArray>(
+      dictionary(int32(), ArrayFromJSON(utf8(), R"(["c", "a"])")),
+      ArrayFromJSON(int32(), "[1, 1, null, 0]"));
+  CheckSetLookup(&this->ctx_, ArrayFromJSON(utf8(), R"(["c", null, "b"])"), member_set,
+                 "[true, true, false]", "[3, 2, null]");
+  CheckSetLookup(&this->ctx_, values, member_set, "[true, true, true, true, false]",
+                 "[3, 2, 0, 0, null]");
+}
+
+TEST_F(TestHashKernel, IsInMatchErrors) {
+  Datum out;
+  ASSERT_RAISES(Invalid, IsIn(&this->ctx_, ArrayFromJSON(int32(), "[1]"),
+                              ArrayFromJSON(int64(), "[1]"), &out));
+  ASSERT_RAISES(Invalid, Match(&this->ctx_, ArrayFromJSON(int32(), "[1]"),
+                               Datum(int32_t(1)), &out));
+  auto list_type = list(int32());
+  ASSERT_RAISES(NotImplemented, Match(&this->ctx_, ArrayFromJSON(list_type, "[[1]]"),
+                                      ArrayFromJSON(list_type, "[[1]]"), &out));
+}
+
 }  // namespace compute
 }  // namespace arrow
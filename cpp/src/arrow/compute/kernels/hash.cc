@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -33,11 +34,14 @@
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/util-internal.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/concatenate.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -206,27 +210,6 @@ class DictEncodeAction : public ActionBase {
   Int32Builder indices_builder_;
 };
 
-/// \brief Invoke hash table kernel on input array, returning any output
-/// values. Implementations should be thread-safe
-///
-/// This interface is implemented below using visitor pattern on "Action"
-/// implementations.  It is not consolidate to keep the contract clearer.
-class HashKernel : public UnaryKernel {
- public:
-  // Reset for another run.
-  virtual Status Reset() = 0;
-  // Prepare the Action for the given input (e.g. reserve appropriately sized
-  // data structures) and visit the given input with Action.
-  virtual Status Append(FunctionContext* ctx, const ArrayData& input) = 0;
-  // Flush out accumulated results from the last invocation of Call.
-  virtual Status Flush(Datum* out) = 0;
-  // Flush out accumulated results across all invocations of Call. The kernel
-  // should not be used until after Reset() is called.
-  virtual Status FlushFinal(Datum* out) = 0;
-  // Get the values (keys) acummulated in the dictionary so far.
-  virtual Status GetDictionary(std::shared_ptr<ArrayData>* out) = 0;
-};
-
 // ----------------------------------------------------------------------
 // Base class for all hash kernel implementations
 
@@ -261,6 +244,7 @@ class RegularHashKernelImpl : public HashKernelImpl {
 
   Status Reset() override {
     memo_table_.reset(new MemoTable(0));
+    dictionary_delta_offset_ = 0;
     return action_.Reset();
   }
 
@@ -278,6 +262,13 @@ class RegularHashKernelImpl : public HashKernelImpl {
                                                           0 /* start_offset */, out);
   }
 
+  Status GetDictionaryDelta(std::shared_ptr<ArrayData>* out) override {
+    RETURN_NOT_OK(DictionaryTraits<Type>::GetDictionaryArrayData(
+        pool_, type_, *memo_table_, dictionary_delta_offset_, out));
+    dictionary_delta_offset_ = memo_table_->size();
+    return Status::OK();
+  }
+
   Status VisitNull() {
     action_.ObserveNull();
     return Status::Status::OK();
@@ -312,6 +303,7 @@ class RegularHashKernelImpl : public HashKernelImpl {
   std::shared_ptr<DataType> type_;
   Action action_;
   std::unique_ptr<MemoTable> memo_table_;
+  int64_t dictionary_delta_offset_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -343,6 +335,10 @@ class NullHashKernelImpl : public HashKernelImpl {
     return Status::OK();
   }
 
+  Status GetDictionaryDelta(std::shared_ptr<ArrayData>* out) override {
+    return GetDictionary(out);
+  }
+
   std::shared_ptr<DataType> out_type() const override { return null(); }
 
  protected:
@@ -386,6 +382,329 @@ struct HashKernelTraits<Type, Action, with_error_status,
       RegularHashKernelImpl<Type, util::string_view, Action, with_error_status>;
 };
 
+// ----------------------------------------------------------------------
+// IsIn / Match implementation
+//
+// The member set is inserted once in a memo table, remembering for each
+// distinct value the position of its first occurrence. Values are then only
+// probed, so that the memo table is never written to while looking up.
+
+class IsInAction : public ActionBase {
+ public:
+  IsInAction(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : ActionBase(type, pool), builder_(pool) {}
+
+  Status Reserve(const int64_t length) { return builder_.Reserve(length); }
+
+  void ObserveNull(int32_t null_position) {
+    if (null_position >= 0) {
+      builder_.UnsafeAppend(true);
+    } else {
+      builder_.UnsafeAppendNull();
+    }
+  }
+
+  void ObserveFound(int32_t position) { builder_.UnsafeAppend(true); }
+
+  void ObserveNotFound() { builder_.UnsafeAppend(false); }
+
+  Status Flush(Datum* out) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder_.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const { return boolean(); }
+
+ private:
+  BooleanBuilder builder_;
+};
+
+class MatchAction : public ActionBase {
+ public:
+  MatchAction(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : ActionBase(type, pool), builder_(pool) {}
+
+  Status Reserve(const int64_t length) { return builder_.Reserve(length); }
+
+  void ObserveNull(int32_t null_position) {
+    if (null_position >= 0) {
+      builder_.UnsafeAppend(null_position);
+    } else {
+      builder_.UnsafeAppendNull();
+    }
+  }
+
+  void ObserveFound(int32_t position) { builder_.UnsafeAppend(position); }
+
+  void ObserveNotFound() { builder_.UnsafeAppendNull(); }
+
+  Status Flush(Datum* out) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder_.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const { return int32(); }
+
+ private:
+  Int32Builder builder_;
+};
+
+template <typename IndexType>
+Status RemapNullIndices(FunctionContext* ctx, const Array& indices, int64_t null_index,
+                        std::shared_ptr<Array>* out) {
+  const auto& typed_indices = checked_cast<const NumericArray<IndexType>&>(indices);
+  Int64Builder builder(ctx->memory_pool());
+  RETURN_NOT_OK(builder.Reserve(indices.length()));
+  for (int64_t i = 0; i < indices.length(); ++i) {
+    builder.UnsafeAppend(typed_indices.IsNull(i)
+                             ? null_index
+                             : static_cast<int64_t>(typed_indices.Value(i)));
+  }
+  return builder.Finish(out);
+}
+
+/// \brief Look up values in a member set, inserted once with SetMembers.
+/// Lookups only read the memo table, so Call() can then run concurrently
+/// without locking.
+class SetLookupKernel : public UnaryKernel {
+ public:
+  /// \brief Insert the chunks of the member set. Only the first call has an
+  /// effect, later ones return its status.
+  Status SetMembers(FunctionContext* ctx, const ArrayVector& members) {
+    std::call_once(members_set_,
+                   [&]() { members_status_ = InsertMembers(ctx, members); });
+    return members_status_;
+  }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+    const ArrayData& arr = *input.array();
+    if (arr.type->id() != Type::DICTIONARY) {
+      return Probe(arr, false /* append_null */, out);
+    }
+
+    // Only probe the dictionary, with an extra trailing slot holding the
+    // result for nulls, then expand it with the indices.
+    const auto& dict_type = checked_cast<const DictionaryType&>(*arr.type);
+    const std::shared_ptr<Array>& dictionary = dict_type.dictionary();
+    Datum probed;
+    RETURN_NOT_OK(Probe(*dictionary->data(), true /* append_null */, &probed));
+
+    auto indices_data = arr.Copy();
+    indices_data->type = dict_type.index_type();
+    std::shared_ptr<Array> indices = MakeArray(indices_data);
+    if (null_position_ >= 0 && indices->null_count() > 0) {
+      switch (indices->type_id()) {
+        case Type::INT8:
+          RETURN_NOT_OK(RemapNullIndices<Int8Type>(ctx, *indices, dictionary->length(),
+                                                   &indices));
+          break;
+        case Type::INT16:
+          RETURN_NOT_OK(RemapNullIndices<Int16Type>(ctx, *indices, dictionary->length(),
+                                                    &indices));
+          break;
+        case Type::INT32:
+          RETURN_NOT_OK(RemapNullIndices<Int32Type>(ctx, *indices, dictionary->length(),
+                                                    &indices));
+          break;
+        case Type::INT64:
+          RETURN_NOT_OK(RemapNullIndices<Int64Type>(ctx, *indices, dictionary->length(),
+                                                    &indices));
+          break;
+        default:
+          return Status::NotImplemented("dictionary index type ",
+                                        indices->type()->ToString());
+      }
+    }
+
+    std::shared_ptr<Array> result;
+    RETURN_NOT_OK(
+        Take(ctx, *MakeArray(probed.array()), *indices, TakeOptions(), &result));
+    out->value = result->data();
+    return Status::OK();
+  }
+
+ protected:
+  // Insert members, the first of which is at the given position of the set.
+  virtual Status Insert(const ArrayData& members, int64_t position) = 0;
+  // Look up each value of arr, then one null if append_null is true.
+  virtual Status Probe(const ArrayData& arr, bool append_null, Datum* out) const = 0;
+
+  // Position of the first null member, or -1
+  int32_t null_position_ = -1;
+
+ private:
+  Status InsertMembers(FunctionContext* ctx, const ArrayVector& members) {
+    int64_t num_members = 0;
+    for (const auto& chunk : members) {
+      if (ARROW_PREDICT_FALSE(num_members + chunk->length() >
+                              std::numeric_limits<int32_t>::max())) {
+        return Status::CapacityError("member set has more than 2^31 - 1 values");
+      }
+      if (chunk->type_id() == Type::DICTIONARY) {
+        // Decode dictionary-encoded members so that positions refer to the
+        // member set
+        const auto& dict_chunk = checked_cast<const DictionaryArray&>(*chunk);
+        std::shared_ptr<Array> decoded;
+        RETURN_NOT_OK(Take(ctx, *dict_chunk.dictionary(), *dict_chunk.indices(),
+                           TakeOptions(), &decoded));
+        RETURN_NOT_OK(Insert(*decoded->data(), num_members));
+      } else {
+        RETURN_NOT_OK(Insert(*chunk->data(), num_members));
+      }
+      num_members += chunk->length();
+    }
+    return Status::OK();
+  }
+
+  std::once_flag members_set_;
+  Status members_status_;
+};
+
+template <typename Type, typename Scalar, typename Action>
+class SetLookupKernelImpl : public SetLookupKernel {
+ public:
+  SetLookupKernelImpl(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool), memo_table_(new MemoTable(0)) {}
+
+  std::shared_ptr<DataType> out_type() const override {
+    return Action(type_, pool_).out_type();
+  }
+
+ protected:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  // Each lookup emits its results with its own action
+  struct ValueProber {
+    Status VisitNull() {
+      action->ObserveNull(self->null_position_);
+      return Status::OK();
+    }
+
+    Status VisitValue(const Scalar& value) {
+      const int32_t memo_index = self->memo_table_->Get(value);
+      if (memo_index < 0) {
+        action->ObserveNotFound();
+      } else {
+        action->ObserveFound(self->positions_[memo_index]);
+      }
+      return Status::OK();
+    }
+
+    const SetLookupKernelImpl* self;
+    Action* action;
+  };
+
+  struct MemberInserter {
+    Status VisitNull() {
+      if (self->null_position_ < 0) {
+        self->null_position_ = static_cast<int32_t>(position);
+      }
+      ++position;
+      return Status::OK();
+    }
+
+    Status VisitValue(const Scalar& value) {
+      auto on_found = [](int32_t memo_index) {};
+      auto on_not_found = [this](int32_t memo_index) {
+        self->positions_.push_back(static_cast<int32_t>(position));
+      };
+      self->memo_table_->GetOrInsert(value, on_found, on_not_found);
+      ++position;
+      return Status::OK();
+    }
+
+    SetLookupKernelImpl* self;
+    int64_t position;
+  };
+
+  Status Insert(const ArrayData& members, int64_t position) override {
+    MemberInserter inserter{this, position};
+    return ArrayDataVisitor<Type>::Visit(members, &inserter);
+  }
+
+  Status Probe(const ArrayData& arr, bool append_null, Datum* out) const override {
+    Action action(type_, pool_);
+    RETURN_NOT_OK(action.Reserve(arr.length + (append_null ? 1 : 0)));
+    ValueProber prober{this, &action};
+    RETURN_NOT_OK(ArrayDataVisitor<Type>::Visit(arr, &prober));
+    if (append_null) {
+      action.ObserveNull(null_position_);
+    }
+    return action.Flush(out);
+  }
+
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  std::unique_ptr<MemoTable> memo_table_;
+  // Position in the member set of the first occurrence of each memo entry
+  std::vector<int32_t> positions_;
+};
+
+template <typename Action>
+class NullSetLookupKernelImpl : public SetLookupKernel {
+ public:
+  NullSetLookupKernelImpl(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool) {}
+
+  std::shared_ptr<DataType> out_type() const override {
+    return Action(type_, pool_).out_type();
+  }
+
+ protected:
+  Status Insert(const ArrayData& members, int64_t position) override {
+    if (null_position_ < 0 && members.length > 0) {
+      null_position_ = static_cast<int32_t>(position);
+    }
+    return Status::OK();
+  }
+
+  Status Probe(const ArrayData& arr, bool append_null, Datum* out) const override {
+    Action action(type_, pool_);
+    const int64_t length = arr.length + (append_null ? 1 : 0);
+    RETURN_NOT_OK(action.Reserve(length));
+    for (int64_t i = 0; i < length; ++i) {
+      action.ObserveNull(null_position_);
+    }
+    return action.Flush(out);
+  }
+
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+};
+
+template <typename Type, typename Action, typename Enable = void>
+struct SetLookupKernelTraits {};
+
+template <typename Type, typename Action>
+struct SetLookupKernelTraits<Type, Action, enable_if_null<Type>> {
+  using KernelImpl = NullSetLookupKernelImpl<Action>;
+};
+
+template <typename Type, typename Action>
+struct SetLookupKernelTraits<Type, Action, enable_if_has_c_type<Type>> {
+  using KernelImpl = SetLookupKernelImpl<Type, typename Type::c_type, Action>;
+};
+
+template <typename Type, typename Action>
+struct SetLookupKernelTraits<Type, Action, enable_if_boolean<Type>> {
+  using KernelImpl = SetLookupKernelImpl<Type, bool, Action>;
+};
+
+template <typename Type, typename Action>
+struct SetLookupKernelTraits<Type, Action, enable_if_binary<Type>> {
+  using KernelImpl = SetLookupKernelImpl<Type, util::string_view, Action>;
+};
+
+template <typename Type, typename Action>
+struct SetLookupKernelTraits<Type, Action, enable_if_fixed_size_binary<Type>> {
+  using KernelImpl = SetLookupKernelImpl<Type, util::string_view, Action>;
+};
+
 }  // namespace
 
 #define PROCESS_SUPPORTED_HASH_TYPES(PROCESS) \
@@ -485,6 +804,29 @@ Status GetValueCountsKernel(FunctionContext* ctx, const std::shared_ptr<DataType
   return Status::OK();
 }
 
+template <typename Action>
+Status GetSetLookupKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                          const char* name, std::unique_ptr<SetLookupKernel>* out) {
+  std::unique_ptr<SetLookupKernel> kernel;
+
+  switch (type->id()) {
+#define PROCESS(InType)                                                           \
+  case InType::type_id:                                                           \
+    kernel.reset(new typename SetLookupKernelTraits<InType, Action>::KernelImpl( \
+        type, ctx->memory_pool()));                                               \
+    break;
+
+    PROCESS_SUPPORTED_HASH_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+
+  CHECK_IMPLEMENTED(kernel, name, type);
+  *out = std::move(kernel);
+  return Status::OK();
+}
+
 namespace {
 
 Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
@@ -498,9 +840,70 @@ Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
   return Status::OK();
 }
 
+std::shared_ptr<DataType> ValueType(const std::shared_ptr<DataType>& type) {
+  if (type->id() == Type::DICTIONARY) {
+    return checked_cast<const DictionaryType&>(*type).dictionary()->type();
+  }
+  return type;
+}
+
+template <typename Action>
+Status SetLookup(FunctionContext* ctx, const Datum& values, const Datum& member_set,
+                 const char* name, Datum* out) {
+  for (const Datum* datum : {&values, &member_set}) {
+    if (datum->kind() != Datum::ARRAY && datum->kind() != Datum::CHUNKED_ARRAY) {
+      return Status::Invalid(name, " expects array-like arguments");
+    }
+  }
+  std::shared_ptr<DataType> value_type = ValueType(values.type());
+  std::shared_ptr<DataType> member_type = ValueType(member_set.type());
+  if (!value_type->Equals(*member_type)) {
+    return Status::Invalid(name, ": values of type ", value_type->ToString(),
+                           " cannot be looked up in a member set of type ",
+                           member_type->ToString());
+  }
+
+  std::unique_ptr<SetLookupKernel> kernel;
+  RETURN_NOT_OK(GetSetLookupKernel<Action>(ctx, value_type, name, &kernel));
+
+  ArrayVector members;
+  if (member_set.kind() == Datum::ARRAY) {
+    members.push_back(member_set.make_array());
+  } else {
+    members = member_set.chunked_array()->chunks();
+  }
+  RETURN_NOT_OK(kernel->SetMembers(ctx, members));
+
+  // Chunks are looked up concurrently if ctx has a thread pool
+  std::vector<Datum> outputs;
+  RETURN_NOT_OK(
+      detail::ParallelInvokeUnaryArrayKernel(ctx, kernel.get(), values, &outputs));
+  if (values.kind() == Datum::CHUNKED_ARRAY && outputs.empty()) {
+    *out = std::make_shared<ChunkedArray>(ArrayVector{}, kernel->out_type());
+  } else {
+    *out = detail::WrapDatumsLike(values, outputs);
+  }
+  return Status::OK();
+}
+
 }  // namespace
 
 Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>* out) {
+  if (ctx->thread_pool() != nullptr && value.kind() == Datum::CHUNKED_ARRAY &&
+      value.chunked_array()->num_chunks() > 1) {
+    // Deduplicate each chunk in parallel, then the concatenation of the
+    // partial results. Values keep the order of their first occurrence.
+    const ChunkedArray& chunked = *value.chunked_array();
+    ArrayVector partials(chunked.num_chunks());
+    RETURN_NOT_OK(detail::ParallelFor(
+        ctx, chunked.num_chunks(), [&](FunctionContext* task_ctx, int i) {
+          return Unique(task_ctx, chunked.chunk(i), &partials[i]);
+        }));
+    std::shared_ptr<Array> concatenated;
+    RETURN_NOT_OK(Concatenate(partials, ctx->memory_pool(), &concatenated));
+    return Unique(ctx, concatenated, out);
+  }
+
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetUniqueKernel(ctx, value.type(), &func));
 
@@ -557,6 +960,17 @@ Status ValueCounts(FunctionContext* ctx, const Datum& value,
       std::vector<std::shared_ptr<Array>>{uniques, MakeArray(value_counts.array())});
   return Status::OK();
 }
+
+Status Match(FunctionContext* ctx, const Datum& values, const Datum& member_set,
+             Datum* out) {
+  return SetLookup<MatchAction>(ctx, values, member_set, "match", out);
+}
+
+Status IsIn(FunctionContext* ctx, const Datum& values, const Datum& member_set,
+            Datum* out) {
+  return SetLookup<IsInAction>(ctx, values, member_set, "is-in", out);
+}
+
 #undef PROCESS_SUPPORTED_HASH_TYPES
 }  // namespace compute
 }  // namespace arrow
@@ -80,24 +80,110 @@ Status ValueCounts(FunctionContext* context, const Datum& value,
 ARROW_EXPORT
 Status DictionaryEncode(FunctionContext* context, const Datum& data, Datum* out);
 
-// TODO(wesm): Define API for incremental dictionary encoding
+/// \class HashKernel
+/// \brief A hash table kernel keeping its state across calls
+///
+/// Unlike the Unique, ValueCounts and DictionaryEncode functions which hash a
+/// whole datum at once, a HashKernel consumes arrays one after another,
+/// e.g. the batches of a stream. The memo table of distinct values grows
+/// across calls, so the dictionary indices of all the batches are consistent
+/// and only the distinct values are kept in memory.
+///
+/// Call(ctx, batch, &out) appends a batch then flushes the results for that
+/// batch: the Int32 dictionary indices for the dictionary-encode kernel,
+/// nothing for the other kernels. GetDictionaryDelta then returns the values
+/// first seen since its previous call, to be emitted as a dictionary delta.
+///
+/// Append is thread-safe, the other methods are not.
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+class ARROW_EXPORT HashKernel : public UnaryKernel {
+ public:
+  /// \brief Reset for another run, clearing the memo table
+  virtual Status Reset() = 0;
+  /// \brief Prepare the action for the given input (e.g. reserve
+  /// appropriately sized data structures) and visit the input with it
+  virtual Status Append(FunctionContext* ctx, const ArrayData& input) = 0;
+  /// \brief Flush out accumulated results from the last invocation of Call
+  virtual Status Flush(Datum* out) = 0;
+  /// \brief Flush out accumulated results across all invocations of Call,
+  /// e.g. the counts of the value-counts kernel. The kernel should not be
+  /// used until after Reset() is called.
+  virtual Status FlushFinal(Datum* out) = 0;
+  /// \brief Get the values (keys) accumulated in the dictionary so far
+  virtual Status GetDictionary(std::shared_ptr<ArrayData>* out) = 0;
+  /// \brief Get the values accumulated in the dictionary since the previous
+  /// call to GetDictionaryDelta, or since Reset(). Their dictionary indices
+  /// follow those of the previous deltas.
+  virtual Status GetDictionaryDelta(std::shared_ptr<ArrayData>* out) = 0;
+};
+
+/// \brief Return a HashKernel collecting the distinct values of its inputs
+ARROW_EXPORT
+Status GetUniqueKernel(FunctionContext* context, const std::shared_ptr<DataType>& type,
+                       std::unique_ptr<HashKernel>* kernel);
+
+/// \brief Return a HashKernel outputting the dictionary indices of its inputs
+ARROW_EXPORT
+Status GetDictionaryEncodeKernel(FunctionContext* context,
+                                 const std::shared_ptr<DataType>& type,
+                                 std::unique_ptr<HashKernel>* kernel);
+
+/// \brief Return a HashKernel counting the occurrences of the distinct values
+/// of its inputs, output by FlushFinal in dictionary order
+ARROW_EXPORT
+Status GetValueCountsKernel(FunctionContext* context,
+                            const std::shared_ptr<DataType>& type,
+                            std::unique_ptr<HashKernel>* kernel);
 
 // TODO(wesm): Define API for regularizing DictionaryArray objects with
 // different dictionaries
 
-//
-// ARROW_EXPORT
-// Status DictionaryEncode(FunctionContext* context, const Datum& data,
-//                         const Array& prior_dictionary, Datum* out);
-
-// TODO(wesm): Implement these next
-// ARROW_EXPORT
-// Status Match(FunctionContext* context, const Datum& values, const Datum& member_set,
-//              Datum* out);
-
-// ARROW_EXPORT
-// Status IsIn(FunctionContext* context, const Datum& values, const Datum& member_set,
-//             Datum* out);
+/// \brief Return the position of each value in a set of members
+///
+/// The hash table of member_set is built once, then values are probed
+/// against it. The result has the same shape as values, each output slot
+/// being the index in member_set of the first occurrence of the value, or
+/// null if the value is absent. A null value matches the first null of
+/// member_set, if any.
+///
+/// Either datum may be dictionary-encoded. For dictionary-encoded values,
+/// only the dictionary is probed and the result is expanded with the indices.
+///
+/// For example given values = [5, null, 1, 3] and member_set = [3, 5, 3],
+/// the output is [1, null, null, 0].
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input to look up
+/// \param[in] member_set array-like set of values of the same type
+/// \param[out] out Int32 array-like result
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Match(FunctionContext* context, const Datum& values, const Datum& member_set,
+             Datum* out);
+
+/// \brief Return whether each value is contained in a set of members
+///
+/// Like Match, but returning true where Match returns a position and false
+/// where it returns null, except that a null value yields null if
+/// member_set does not contain a null.
+///
+/// For example given values = [5, null, 1, 3] and member_set = [3, 5, 3],
+/// the output is [true, null, false, true].
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input to look up
+/// \param[in] member_set array-like set of values of the same type
+/// \param[out] out Boolean array-like result
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status IsIn(FunctionContext* context, const Datum& values, const Datum& member_set,
+            Datum* out);
 
 }  // namespace compute
 }  // namespace arrow
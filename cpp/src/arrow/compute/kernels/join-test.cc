@@ -0,0 +1,223 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/join.h"
+#include "arrow/compute/test-util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestHashJoinKernel : public ComputeFixture, public TestBase {
+ protected:
+  void AssertJoin(const Table& left, const Table& right, const JoinOptions& options,
+                  const Table& expected) {
+    for (int bits : {0, 2}) {
+      JoinOptions partitioned = options;
+      partitioned.partition_bits = bits;
+      std::shared_ptr<Table> actual;
+      ASSERT_OK(HashJoin(&this->ctx_, left, right, partitioned, &actual));
+      ASSERT_OK(actual->Validate());
+      AssertTablesEqual(expected, *actual, false /* same_chunk_layout */);
+    }
+  }
+
+  static std::shared_ptr<Table> MakeTable(
+      const std::vector<std::shared_ptr<Field>>& fields,
+      const std::vector<std::string>& json) {
+    std::vector<std::shared_ptr<Array>> arrays;
+    for (size_t i = 0; i < fields.size(); i++) {
+      arrays.push_back(ArrayFromJSON(fields[i]->type(), json[i]));
+    }
+    return Table::Make(schema(fields), arrays);
+  }
+};
+
+TEST_F(TestHashJoinKernel, SingleKey) {
+  auto left = MakeTable({field("k", int32()), field("a", utf8())},
+                        {"[1, 2, null, 2]", R"(["w", "x", "y", "z"])"});
+  auto right = MakeTable({field("k", int32()), field("b", boolean())},
+                         {"[2, 3, null]", "[true, false, true]"});
+
+  this->AssertJoin(
+      *left, *right, JoinOptions(JoinOptions::LEFT_OUTER, {"k"}, {"k"}),
+      *MakeTable({field("k", int32()), field("a", utf8()), field("k", int32()),
+                  field("b", boolean())},
+                 {"[1, 2, null, 2]", R"(["w", "x", "y", "z"])", "[null, 2, null, 2]",
+                  "[null, true, null, true]"}));
+
+  this->AssertJoin(*left, *right, JoinOptions(JoinOptions::INNER, {"k"}, {"k"}),
+                   *MakeTable({field("k", int32()), field("a", utf8()),
+                               field("k", int32()), field("b", boolean())},
+                              {"[2, 2]", R"(["x", "z"])", "[2, 2]", "[true, true]"}));
+
+  this->AssertJoin(*left, *right, JoinOptions(JoinOptions::LEFT_SEMI, {"k"}, {"k"}),
+                   *MakeTable({field("k", int32()), field("a", utf8())},
+                              {"[2, 2]", R"(["x", "z"])"}));
+
+  this->AssertJoin(*left, *right, JoinOptions(JoinOptions::LEFT_ANTI, {"k"}, {"k"}),
+                   *MakeTable({field("k", int32()), field("a", utf8())},
+                              {"[1, null]", R"(["w", "y"])"}));
+}
+
+TEST_F(TestHashJoinKernel, MultipleKeysAndDuplicates) {
+  // The left table is the smaller one, hence the build side, and output rows
+  // follow the order of the right table.
+  auto left = MakeTable({field("x", int64()), field("y", utf8()), field("a", int8())},
+                        {"[1, 1, 2]", R"(["p", "q", "p"])", "[10, 20, 30]"});
+  auto right = MakeTable({field("y", utf8()), field("x", int64())},
+                         {R"(["p", "q", "p", "p", null])", "[2, 1, 1, 1, 1]"});
+
+  this->AssertJoin(
+      *left, *right, JoinOptions(JoinOptions::INNER, {"x", "y"}, {"x", "y"}),
+      *MakeTable({field("x", int64()), field("y", utf8()), field("a", int8()),
+                  field("y", utf8()), field("x", int64())},
+                 {"[2, 1, 1, 1]", R"(["p", "q", "p", "p"])", "[30, 20, 10, 10]",
+                  R"(["p", "q", "p", "p"])", "[2, 1, 1, 1]"}));
+
+  // Every build row matching a key is output, in build order
+  auto many = MakeTable({field("k", utf8()), field("v", int32())},
+                        {R"(["a", "b", "a", "a"])", "[1, 2, 3, 4]"});
+  auto keys = MakeTable({field("k", utf8())}, {R"(["a", "c", "a", "b", "b"])"});
+  this->AssertJoin(
+      *keys, *many, JoinOptions(JoinOptions::LEFT_OUTER, {"k"}, {"k"}),
+      *MakeTable({field("k", utf8()), field("k", utf8()), field("v", int32())},
+                 {R"(["a", "a", "a", "c", "a", "a", "a", "b", "b"])",
+                  R"(["a", "a", "a", null, "a", "a", "a", "b", "b"])",
+                  "[1, 3, 4, null, 1, 3, 4, 2, 2]"}));
+}
+
+TEST_F(TestHashJoinKernel, EmptyTables) {
+  auto empty = MakeTable({field("k", int32())}, {"[]"});
+  auto values = MakeTable({field("k", int32())}, {"[1, 2]"});
+
+  this->AssertJoin(*empty, *values, JoinOptions(JoinOptions::INNER, {"k"}, {"k"}),
+                   *MakeTable({field("k", int32()), field("k", int32())}, {"[]", "[]"}));
+  this->AssertJoin(*values, *empty, JoinOptions(JoinOptions::LEFT_ANTI, {"k"}, {"k"}),
+                   *values);
+}
+
+TEST_F(TestHashJoinKernel, RandomPartitionedMatchesUnpartitioned) {
+  auto rand = random::RandomArrayGenerator(0x7a3b21);
+  auto MakeRandomTable = [&](int64_t length, const std::string& value_name) {
+    auto keys = rand.Int32(length, 0, 300, 0.05);
+    auto values = rand.Int64(length, 0, 1000, 0.1);
+    ArrayVector key_chunks = {keys->Slice(0, length / 3), keys->Slice(length / 3)};
+    ArrayVector value_chunks = {values->Slice(0, length / 2), values->Slice(length / 2)};
+    auto schema = ::arrow::schema({field("k", int32()), field(value_name, int64())});
+    return Table::Make(schema,
+                       {std::make_shared<Column>(schema->field(0), key_chunks),
+                        std::make_shared<Column>(schema->field(1), value_chunks)});
+  };
+  auto left = MakeRandomTable(2000, "a");
+  auto right = MakeRandomTable(700, "b");
+
+  // Naive nested loop count of the matching pairs.
+  const auto& left_keys = *left->column(0)->data();
+  const auto& right_keys = *right->column(0)->data();
+  std::vector<int64_t> left_matches;
+  int64_t num_pairs = 0;
+  for (const auto& left_chunk : left_keys.chunks()) {
+    const auto& l = checked_cast<const Int32Array&>(*left_chunk);
+    for (int64_t i = 0; i < l.length(); i++) {
+      int64_t matches = 0;
+      for (const auto& right_chunk : right_keys.chunks()) {
+        const auto& r = checked_cast<const Int32Array&>(*right_chunk);
+        for (int64_t j = 0; j < r.length(); j++) {
+          matches += l.IsValid(i) && r.IsValid(j) && l.Value(i) == r.Value(j);
+        }
+      }
+      left_matches.push_back(matches);
+      num_pairs += matches;
+    }
+  }
+  int64_t num_unmatched = 0;
+  for (int64_t matches : left_matches) {
+    num_unmatched += matches == 0;
+  }
+
+  for (auto join_type : {JoinOptions::INNER, JoinOptions::LEFT_OUTER,
+                         JoinOptions::LEFT_SEMI, JoinOptions::LEFT_ANTI}) {
+    JoinOptions options(join_type, {"k"}, {"k"});
+    options.batch_size = 300;
+    std::shared_ptr<Table> expected;
+    ASSERT_OK(HashJoin(&this->ctx_, *left, *right, options, &expected));
+    ASSERT_OK(expected->Validate());
+
+    switch (join_type) {
+      case JoinOptions::INNER:
+        ASSERT_EQ(num_pairs, expected->num_rows());
+        break;
+      case JoinOptions::LEFT_OUTER:
+        ASSERT_EQ(num_pairs + num_unmatched, expected->num_rows());
+        break;
+      case JoinOptions::LEFT_SEMI:
+        ASSERT_EQ(left->num_rows() - num_unmatched, expected->num_rows());
+        break;
+      case JoinOptions::LEFT_ANTI:
+        ASSERT_EQ(num_unmatched, expected->num_rows());
+        break;
+    }
+
+    for (int bits : {1, 5, JoinOptions::kAutoPartitionBits}) {
+      options.partition_bits = bits;
+      std::shared_ptr<Table> actual;
+      ASSERT_OK(HashJoin(&this->ctx_, *left, *right, options, &actual));
+      AssertTablesEqual(*expected, *actual, false /* same_chunk_layout */);
+    }
+  }
+}
+
+TEST_F(TestHashJoinKernel, Errors) {
+  auto left = MakeTable({field("k", int32()), field("s", utf8())}, {"[1]", R"(["a"])"});
+  auto right =
+      MakeTable({field("k", int64()), field("l", list(int8()))}, {"[1]", "[[]]"});
+  std::shared_ptr<Table> out;
+
+  ASSERT_RAISES(Invalid, HashJoin(&this->ctx_, *left, *right,
+                                  JoinOptions(JoinOptions::INNER, {"z"}, {"k"}), &out));
+  ASSERT_RAISES(Invalid, HashJoin(&this->ctx_, *left, *right,
+                                  JoinOptions(JoinOptions::INNER, {"k"}, {}), &out));
+  ASSERT_RAISES(TypeError, HashJoin(&this->ctx_, *left, *right,
+                                    JoinOptions(JoinOptions::INNER, {"k"}, {"k"}), &out));
+  ASSERT_RAISES(NotImplemented,
+                HashJoin(&this->ctx_, *right, *right,
+                         JoinOptions(JoinOptions::INNER, {"l"}, {"l"}), &out));
+
+  JoinOptions options(JoinOptions::INNER, {"k"}, {"k"});
+  options.partition_bits = 17;
+  ASSERT_RAISES(Invalid, HashJoin(&this->ctx_, *left, *left, options, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,672 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/join.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/concatenate.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::HashTraits;
+using internal::ScalarHelper;
+
+namespace compute {
+
+constexpr int JoinOptions::kAutoPartitionBits;
+
+namespace {
+
+using internal::hash_t;
+
+// With automatic partitioning, the number of build rows per partition. The
+// memo table entries of a partition then fit in a typical L2 cache.
+constexpr int64_t kPartitionTargetRows = 1 << 14;
+constexpr int kMaxPartitionBits = 12;
+
+// ----------------------------------------------------------------------
+// Key encoding
+//
+// Each key column of a hash table maps its values to dense key ids through a
+// memo table. The build side inserts its keys while the probe side only looks
+// them up. Null keys never match and get the id -1, as do unknown keys.
+
+class JoinKeyEncoder {
+ public:
+  virtual ~JoinKeyEncoder() = default;
+
+  // Write the key id of each slot of `data` into `out`, adding unseen keys.
+  virtual Status Insert(const ArrayData& data, int32_t* out) = 0;
+
+  // Write the key id of each slot of `data` into `out`, -1 for unseen keys.
+  virtual Status Lookup(const ArrayData& data, int32_t* out) = 0;
+
+  // Mix the hash of each slot of `data` into `hashes`, and flag the null
+  // slots in `nulls`. The hash function differs from the memo table's one.
+  virtual Status Hash(const ArrayData& data, hash_t* hashes, uint8_t* nulls) const = 0;
+
+  // The number of distinct keys seen so far.
+  virtual int32_t num_ids() const = 0;
+};
+
+template <typename Type, typename Scalar>
+class JoinKeyEncoderImpl : public JoinKeyEncoder {
+ public:
+  Status Insert(const ArrayData& data, int32_t* out) override {
+    insert_ = true;
+    out_ = out;
+    return ArrayDataVisitor<Type>::Visit(data, this);
+  }
+
+  Status Lookup(const ArrayData& data, int32_t* out) override {
+    insert_ = false;
+    out_ = out;
+    return ArrayDataVisitor<Type>::Visit(data, this);
+  }
+
+  Status Hash(const ArrayData& data, hash_t* hashes, uint8_t* nulls) const override {
+    KeyHasher hasher{hashes, nulls};
+    return ArrayDataVisitor<Type>::Visit(data, &hasher);
+  }
+
+  int32_t num_ids() const override { return memo_table_.size(); }
+
+  Status VisitNull() {
+    *out_++ = -1;
+    return Status::OK();
+  }
+
+  Status VisitValue(const Scalar& value) {
+    *out_++ = insert_ ? memo_table_.GetOrInsert(value) : memo_table_.Get(value);
+    return Status::OK();
+  }
+
+ private:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  struct KeyHasher {
+    Status VisitNull() {
+      ++hashes;
+      *nulls++ = 1;
+      return Status::OK();
+    }
+
+    Status VisitValue(const Scalar& value) {
+      // The odd multiplier keeps the mixed hash's low bits well distributed.
+      const hash_t h = ScalarHelper<Scalar, 1>::ComputeHash(value);
+      *hashes = (*hashes * 0x9E3779B97F4A7C15ULL) ^ h;
+      ++hashes;
+      ++nulls;
+      return Status::OK();
+    }
+
+    hash_t* hashes;
+    uint8_t* nulls;
+  };
+
+  MemoTable memo_table_;
+  bool insert_ = false;
+  int32_t* out_ = NULLPTR;
+};
+
+template <typename Type, typename Enable = void>
+struct JoinKeyEncoderTraits {};
+
+template <typename Type>
+struct JoinKeyEncoderTraits<Type, enable_if_has_c_type<Type>> {
+  using EncoderImpl = JoinKeyEncoderImpl<Type, typename Type::c_type>;
+};
+
+template <typename Type>
+struct JoinKeyEncoderTraits<Type, enable_if_boolean<Type>> {
+  using EncoderImpl = JoinKeyEncoderImpl<Type, bool>;
+};
+
+template <typename Type>
+struct JoinKeyEncoderTraits<Type, enable_if_binary<Type>> {
+  using EncoderImpl = JoinKeyEncoderImpl<Type, util::string_view>;
+};
+
+template <typename Type>
+struct JoinKeyEncoderTraits<Type, enable_if_fixed_size_binary<Type>> {
+  using EncoderImpl = JoinKeyEncoderImpl<Type, util::string_view>;
+};
+
+#define PROCESS_SUPPORTED_KEY_TYPES(PROCESS) \
+  PROCESS(BooleanType)                       \
+  PROCESS(UInt8Type)                         \
+  PROCESS(Int8Type)                          \
+  PROCESS(UInt16Type)                        \
+  PROCESS(Int16Type)                         \
+  PROCESS(UInt32Type)                        \
+  PROCESS(Int32Type)                         \
+  PROCESS(UInt64Type)                        \
+  PROCESS(Int64Type)                         \
+  PROCESS(FloatType)                         \
+  PROCESS(DoubleType)                        \
+  PROCESS(Date32Type)                        \
+  PROCESS(Date64Type)                        \
+  PROCESS(Time32Type)                        \
+  PROCESS(Time64Type)                        \
+  PROCESS(TimestampType)                     \
+  PROCESS(BinaryType)                        \
+  PROCESS(StringType)                        \
+  PROCESS(FixedSizeBinaryType)               \
+  PROCESS(Decimal128Type)
+
+Status MakeJoinKeyEncoder(const std::shared_ptr<DataType>& type,
+                          std::unique_ptr<JoinKeyEncoder>* out) {
+  switch (type->id()) {
+#define PROCESS(InType)                                                       \
+  case InType::type_id:                                                       \
+    out->reset(new typename JoinKeyEncoderTraits<InType>::EncoderImpl());     \
+    return Status::OK();
+
+    PROCESS_SUPPORTED_KEY_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("HashJoin not implemented for key type ",
+                                type->ToString());
+}
+
+#undef PROCESS_SUPPORTED_KEY_TYPES
+
+// ----------------------------------------------------------------------
+// Hash table over the build rows of one partition
+
+class JoinHashTable {
+ public:
+  Status Init(const std::vector<std::shared_ptr<DataType>>& key_types) {
+    for (const auto& type : key_types) {
+      std::unique_ptr<JoinKeyEncoder> encoder;
+      RETURN_NOT_OK(MakeJoinKeyEncoder(type, &encoder));
+      encoders_.push_back(std::move(encoder));
+    }
+    return Status::OK();
+  }
+
+  // Insert the build rows whose key columns are `keys`. row_ids[i] is the
+  // position of row i in the build side, or i itself if row_ids is null.
+  Status Build(const std::vector<std::shared_ptr<Array>>& keys, const int64_t* row_ids) {
+    const int64_t length = keys[0]->length();
+    std::vector<int32_t> key_ids(static_cast<size_t>(length));
+    RETURN_NOT_OK(EncodeKeys(keys, true /* insert */, key_ids.data()));
+
+    // Group the rows by key id, preserving their order within each key.
+    const int32_t num_ids =
+        encoders_.size() == 1 ? encoders_[0]->num_ids() : tuple_memo_table_.size();
+    offsets_.assign(static_cast<size_t>(num_ids) + 1, 0);
+    for (int32_t key_id : key_ids) {
+      if (key_id >= 0) ++offsets_[key_id + 1];
+    }
+    for (int32_t i = 0; i < num_ids; i++) {
+      offsets_[i + 1] += offsets_[i];
+    }
+    rows_.resize(static_cast<size_t>(offsets_[num_ids]));
+    std::vector<int64_t> positions(offsets_.begin(), offsets_.end() - 1);
+    for (int64_t i = 0; i < length; i++) {
+      const int32_t key_id = key_ids[i];
+      if (key_id >= 0) {
+        rows_[positions[key_id]++] = row_ids == NULLPTR ? i : row_ids[i];
+      }
+    }
+    return Status::OK();
+  }
+
+  // Write the key id of each probe row into `key_ids`, -1 when no build row
+  // has the same key.
+  Status Probe(const std::vector<std::shared_ptr<Array>>& keys, int32_t* key_ids) {
+    return EncodeKeys(keys, false /* insert */, key_ids);
+  }
+
+  // The positions in the build side of the rows with the given key id.
+  const int64_t* matches_begin(int32_t key_id) const {
+    return rows_.data() + offsets_[key_id];
+  }
+  const int64_t* matches_end(int32_t key_id) const {
+    return rows_.data() + offsets_[key_id + 1];
+  }
+
+ private:
+  Status EncodeKeys(const std::vector<std::shared_ptr<Array>>& keys, bool insert,
+                    int32_t* key_ids) {
+    // With a single key, column key ids are key ids.
+    if (encoders_.size() == 1) {
+      return insert ? encoders_[0]->Insert(*keys[0]->data(), key_ids)
+                    : encoders_[0]->Lookup(*keys[0]->data(), key_ids);
+    }
+
+    // Otherwise, the tuple of column key ids of a row is hashed as a binary
+    // string. A row with a null or unknown column key matches nothing.
+    const size_t num_keys = encoders_.size();
+    const int64_t length = keys[0]->length();
+    column_ids_.resize(num_keys * static_cast<size_t>(length));
+    for (size_t k = 0; k < num_keys; k++) {
+      int32_t* out = &column_ids_[k * length];
+      RETURN_NOT_OK(insert ? encoders_[k]->Insert(*keys[k]->data(), out)
+                           : encoders_[k]->Lookup(*keys[k]->data(), out));
+    }
+
+    std::vector<int32_t> row_key(num_keys);
+    const auto row_key_size = static_cast<int32_t>(num_keys * sizeof(int32_t));
+    for (int64_t i = 0; i < length; i++) {
+      bool is_valid = true;
+      for (size_t k = 0; k < num_keys; k++) {
+        row_key[k] = column_ids_[k * length + i];
+        is_valid &= row_key[k] >= 0;
+      }
+      if (!is_valid) {
+        key_ids[i] = -1;
+      } else if (insert) {
+        key_ids[i] = tuple_memo_table_.GetOrInsert(row_key.data(), row_key_size);
+      } else {
+        key_ids[i] = tuple_memo_table_.Get(row_key.data(), row_key_size);
+      }
+    }
+    return Status::OK();
+  }
+
+  std::vector<std::unique_ptr<JoinKeyEncoder>> encoders_;
+  // Only used with multiple keys: key ids of column key id tuples.
+  internal::BinaryMemoTable tuple_memo_table_;
+
+  // The build rows of key id i are rows_[offsets_[i]:offsets_[i + 1]].
+  std::vector<int64_t> offsets_;
+  std::vector<int64_t> rows_;
+
+  // Scratch space reused across probes.
+  std::vector<int32_t> column_ids_;
+};
+
+// ----------------------------------------------------------------------
+// Radix partitioning
+
+int AutoPartitionBits(int64_t num_build_rows) {
+  int bits = 0;
+  while (bits < kMaxPartitionBits && (num_build_rows >> bits) > kPartitionTargetRows) {
+    ++bits;
+  }
+  return bits;
+}
+
+// Rows of key columns reordered so that the rows of each partition are
+// contiguous. Rows with a null key match nothing and are left out.
+struct PartitionedKeys {
+  // Row positions by partition, the rows of partition p are
+  // positions[offsets[p]:offsets[p + 1]].
+  std::vector<int64_t> offsets;
+  std::shared_ptr<Int64Array> positions;
+  // The key columns, taken at positions.
+  std::vector<std::shared_ptr<Array>> keys;
+
+  int num_partitions() const { return static_cast<int>(offsets.size()) - 1; }
+
+  std::vector<std::shared_ptr<Array>> PartitionKeys(int partition) const {
+    std::vector<std::shared_ptr<Array>> out;
+    const int64_t offset = offsets[partition];
+    const int64_t length = offsets[partition + 1] - offset;
+    for (const auto& key : keys) {
+      out.push_back(key->Slice(offset, length));
+    }
+    return out;
+  }
+};
+
+Status PartitionKeyRows(FunctionContext* ctx,
+                        const std::vector<std::unique_ptr<JoinKeyEncoder>>& hashers,
+                        const std::vector<std::shared_ptr<Array>>& keys, int bits,
+                        PartitionedKeys* out) {
+  const int64_t length = keys[0]->length();
+  std::vector<hash_t> hashes(static_cast<size_t>(length), 0);
+  std::vector<uint8_t> nulls(static_cast<size_t>(length), 0);
+  for (size_t k = 0; k < keys.size(); k++) {
+    RETURN_NOT_OK(hashers[k]->Hash(*keys[k]->data(), hashes.data(), nulls.data()));
+  }
+
+  // Counting sort of the non-null rows by the low bits of their hash.
+  const int num_partitions = 1 << bits;
+  const hash_t mask = static_cast<hash_t>(num_partitions - 1);
+  out->offsets.assign(static_cast<size_t>(num_partitions) + 1, 0);
+  for (int64_t i = 0; i < length; i++) {
+    out->offsets[(hashes[i] & mask) + 1] += nulls[i] == 0;
+  }
+  for (int p = 0; p < num_partitions; p++) {
+    out->offsets[p + 1] += out->offsets[p];
+  }
+
+  const int64_t num_rows = out->offsets[num_partitions];
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), num_rows * sizeof(int64_t), &buffer));
+  auto positions = reinterpret_cast<int64_t*>(buffer->mutable_data());
+  std::vector<int64_t> cursors(out->offsets.begin(), out->offsets.end() - 1);
+  for (int64_t i = 0; i < length; i++) {
+    if (nulls[i] == 0) {
+      positions[cursors[hashes[i] & mask]++] = i;
+    }
+  }
+  out->positions = std::make_shared<Int64Array>(num_rows, buffer);
+
+  out->keys.resize(keys.size());
+  for (size_t k = 0; k < keys.size(); k++) {
+    RETURN_NOT_OK(Take(ctx, *keys[k], *out->positions, TakeOptions(), &out->keys[k]));
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Join driver
+
+Status GetKeyIndices(const Schema& schema, const std::vector<std::string>& names,
+                     std::vector<int>* out) {
+  for (const auto& name : names) {
+    const int index = schema.GetFieldIndex(name);
+    if (index < 0) {
+      return Status::Invalid("HashJoin key column '", name, "' not found in ",
+                             schema.ToString());
+    }
+    out->push_back(index);
+  }
+  return Status::OK();
+}
+
+Status ConcatenateColumn(FunctionContext* ctx, const Column& column,
+                         std::shared_ptr<Array>* out) {
+  const ChunkedArray& data = *column.data();
+  if (data.num_chunks() == 1) {
+    *out = data.chunk(0);
+    return Status::OK();
+  }
+  if (data.num_chunks() == 0) {
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), column.type(), &builder));
+    return builder->Finish(out);
+  }
+  return Concatenate(data.chunks(), ctx->memory_pool(), out);
+}
+
+class HashJoiner {
+ public:
+  HashJoiner(FunctionContext* ctx, const JoinOptions& options)
+      : ctx_(ctx), options_(options) {}
+
+  Status Join(const Table& left, const Table& right, std::shared_ptr<Table>* out) {
+    if (options_.left_keys.empty() ||
+        options_.left_keys.size() != options_.right_keys.size()) {
+      return Status::Invalid("HashJoin expects the same non-zero number of left and "
+                             "right keys");
+    }
+    if (options_.batch_size <= 0) {
+      return Status::Invalid("HashJoin batch size must be positive");
+    }
+
+    std::vector<int> left_keys, right_keys;
+    RETURN_NOT_OK(GetKeyIndices(*left.schema(), options_.left_keys, &left_keys));
+    RETURN_NOT_OK(GetKeyIndices(*right.schema(), options_.right_keys, &right_keys));
+    std::vector<std::shared_ptr<DataType>> key_types;
+    for (size_t k = 0; k < left_keys.size(); k++) {
+      const auto& left_type = left.column(left_keys[k])->type();
+      const auto& right_type = right.column(right_keys[k])->type();
+      if (!left_type->Equals(*right_type)) {
+        return Status::TypeError("HashJoin key ", k, " has type ",
+                                 left_type->ToString(), " on the left but ",
+                                 right_type->ToString(), " on the right");
+      }
+      key_types.push_back(left_type);
+    }
+
+    // Inner joins are symmetric, so the smaller table is the build side.
+    build_is_left_ = options_.join_type == JoinOptions::INNER &&
+                     left.num_rows() < right.num_rows();
+    const Table& build = build_is_left_ ? left : right;
+    const Table& probe = build_is_left_ ? right : left;
+
+    RETURN_NOT_OK(MakeOutputSchema(left, right));
+    RETURN_NOT_OK(BuildTables(build, build_is_left_ ? left_keys : right_keys, key_types));
+
+    output_chunks_.resize(output_schema_->num_fields());
+    TableBatchReader reader(probe);
+    reader.set_chunksize(options_.batch_size);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (!batch) break;
+      RETURN_NOT_OK(ProbeBatch(*batch, build_is_left_ ? right_keys : left_keys));
+    }
+
+    std::vector<std::shared_ptr<Column>> columns;
+    for (int i = 0; i < output_schema_->num_fields(); i++) {
+      const auto& field = output_schema_->field(i);
+      columns.push_back(std::make_shared<Column>(
+          field, std::make_shared<ChunkedArray>(output_chunks_[i], field->type())));
+    }
+    *out = Table::Make(output_schema_, columns);
+    return Status::OK();
+  }
+
+ private:
+  bool outputs_right() const {
+    return options_.join_type == JoinOptions::INNER ||
+           options_.join_type == JoinOptions::LEFT_OUTER;
+  }
+
+  Status MakeOutputSchema(const Table& left, const Table& right) {
+    std::vector<std::shared_ptr<Field>> fields = left.schema()->fields();
+    if (outputs_right()) {
+      // Unmatched left rows of an outer join have null right columns.
+      const bool nullable = options_.join_type == JoinOptions::LEFT_OUTER;
+      for (const auto& field : right.schema()->fields()) {
+        fields.push_back(nullable ? std::make_shared<Field>(field->name(), field->type(),
+                                                            true, field->metadata())
+                                  : field);
+      }
+    }
+    output_schema_ = schema(fields);
+    num_left_columns_ = left.num_columns();
+    return Status::OK();
+  }
+
+  Status BuildTables(const Table& build, const std::vector<int>& key_indices,
+                     const std::vector<std::shared_ptr<DataType>>& key_types) {
+    // Output rows are taken from the build side at arbitrary positions,
+    // so each column is made contiguous once.
+    for (int i = 0; i < build.num_columns(); i++) {
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(ConcatenateColumn(ctx_, *build.column(i), &column));
+      build_columns_.push_back(std::move(column));
+    }
+    std::vector<std::shared_ptr<Array>> keys;
+    for (int index : key_indices) {
+      keys.push_back(build_columns_[index]);
+    }
+
+    partition_bits_ = options_.partition_bits == JoinOptions::kAutoPartitionBits
+                          ? AutoPartitionBits(build.num_rows())
+                          : options_.partition_bits;
+    if (partition_bits_ < 0 || partition_bits_ > 16) {
+      return Status::Invalid("HashJoin partition bits must be in [0, 16], got ",
+                             partition_bits_);
+    }
+
+    tables_.resize(static_cast<size_t>(1) << partition_bits_);
+    for (auto& table : tables_) {
+      RETURN_NOT_OK(table.Init(key_types));
+    }
+    if (partition_bits_ == 0) {
+      return tables_[0].Build(keys, NULLPTR);
+    }
+
+    // Encoders of their own hash the rows of both sides.
+    for (const auto& type : key_types) {
+      std::unique_ptr<JoinKeyEncoder> hasher;
+      RETURN_NOT_OK(MakeJoinKeyEncoder(type, &hasher));
+      hashers_.push_back(std::move(hasher));
+    }
+    PartitionedKeys partitioned;
+    RETURN_NOT_OK(PartitionKeyRows(ctx_, hashers_, keys, partition_bits_, &partitioned));
+    const int64_t* positions = partitioned.positions->raw_values();
+    for (int p = 0; p < partitioned.num_partitions(); p++) {
+      RETURN_NOT_OK(tables_[p].Build(partitioned.PartitionKeys(p),
+                                     positions + partitioned.offsets[p]));
+    }
+    return Status::OK();
+  }
+
+  // Compute the partition and key id of each probe row. Rows with a null or
+  // unknown key get the key id -1.
+  Status LookupBatch(const std::vector<std::shared_ptr<Array>>& keys) {
+    const int64_t length = keys[0]->length();
+    if (partition_bits_ == 0) {
+      row_partitions_.assign(static_cast<size_t>(length), 0);
+      row_key_ids_.resize(static_cast<size_t>(length));
+      return tables_[0].Probe(keys, row_key_ids_.data());
+    }
+
+    row_partitions_.resize(static_cast<size_t>(length));
+    row_key_ids_.assign(static_cast<size_t>(length), -1);
+    PartitionedKeys partitioned;
+    RETURN_NOT_OK(PartitionKeyRows(ctx_, hashers_, keys, partition_bits_, &partitioned));
+    const int64_t* positions = partitioned.positions->raw_values();
+    std::vector<int32_t> key_ids;
+    for (int p = 0; p < partitioned.num_partitions(); p++) {
+      const int64_t offset = partitioned.offsets[p];
+      const int64_t num_rows = partitioned.offsets[p + 1] - offset;
+      key_ids.resize(static_cast<size_t>(num_rows));
+      RETURN_NOT_OK(tables_[p].Probe(partitioned.PartitionKeys(p), key_ids.data()));
+      for (int64_t j = 0; j < num_rows; j++) {
+        row_partitions_[positions[offset + j]] = p;
+        row_key_ids_[positions[offset + j]] = key_ids[j];
+      }
+    }
+    return Status::OK();
+  }
+
+  Status ProbeBatch(const RecordBatch& batch, const std::vector<int>& key_indices) {
+    std::vector<std::shared_ptr<Array>> keys;
+    for (int index : key_indices) {
+      keys.push_back(batch.column(index));
+    }
+    RETURN_NOT_OK(LookupBatch(keys));
+
+    // Pair the probe rows with their matching build rows, a null build
+    // position standing for an unmatched outer row.
+    Int64Builder probe_builder(ctx_->memory_pool());
+    Int64Builder build_builder(ctx_->memory_pool());
+    const int64_t length = batch.num_rows();
+    for (int64_t i = 0; i < length; i++) {
+      const int32_t key_id = row_key_ids_[i];
+      const bool matched = key_id >= 0;
+      switch (options_.join_type) {
+        case JoinOptions::INNER:
+        case JoinOptions::LEFT_OUTER: {
+          if (matched) {
+            const JoinHashTable& table = tables_[row_partitions_[i]];
+            const int64_t* end = table.matches_end(key_id);
+            for (const int64_t* it = table.matches_begin(key_id); it != end; ++it) {
+              RETURN_NOT_OK(probe_builder.Append(i));
+              RETURN_NOT_OK(build_builder.Append(*it));
+            }
+          } else if (options_.join_type == JoinOptions::LEFT_OUTER) {
+            RETURN_NOT_OK(probe_builder.Append(i));
+            RETURN_NOT_OK(build_builder.AppendNull());
+          }
+        } break;
+        case JoinOptions::LEFT_SEMI:
+        case JoinOptions::LEFT_ANTI:
+          if (matched == (options_.join_type == JoinOptions::LEFT_SEMI)) {
+            RETURN_NOT_OK(probe_builder.Append(i));
+          }
+          break;
+      }
+    }
+    if (probe_builder.length() == 0) {
+      return Status::OK();
+    }
+
+    std::shared_ptr<Array> probe_indices, build_indices;
+    RETURN_NOT_OK(probe_builder.Finish(&probe_indices));
+    RETURN_NOT_OK(build_builder.Finish(&build_indices));
+
+    // Gather the output columns, which are the left columns followed (when
+    // any) by the right columns.
+    for (int i = 0; i < output_schema_->num_fields(); i++) {
+      const bool from_left = i < num_left_columns_;
+      const int index = from_left ? i : i - num_left_columns_;
+      const bool from_probe = from_left != build_is_left_;
+      std::shared_ptr<Array> column;
+      if (from_probe) {
+        RETURN_NOT_OK(Take(ctx_, *batch.column(index), *probe_indices, TakeOptions(),
+                           &column));
+      } else {
+        RETURN_NOT_OK(Take(ctx_, *build_columns_[index], *build_indices, TakeOptions(),
+                           &column));
+      }
+      output_chunks_[i].push_back(std::move(column));
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  const JoinOptions& options_;
+
+  bool build_is_left_ = false;
+  std::shared_ptr<Schema> output_schema_;
+  int num_left_columns_ = 0;
+
+  // Build side
+  std::vector<std::shared_ptr<Array>> build_columns_;
+  int partition_bits_ = 0;
+  std::vector<JoinHashTable> tables_;
+  std::vector<std::unique_ptr<JoinKeyEncoder>> hashers_;
+
+  // Probe side, reused across batches
+  std::vector<int32_t> row_partitions_;
+  std::vector<int32_t> row_key_ids_;
+
+  std::vector<ArrayVector> output_chunks_;
+};
+
+}  // namespace
+
+Status HashJoin(FunctionContext* ctx, const Table& left, const Table& right,
+                const JoinOptions& options, std::shared_ptr<Table>* out) {
+  HashJoiner joiner(ctx, options);
+  return joiner.Join(left, right, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
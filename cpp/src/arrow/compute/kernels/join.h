@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \class JoinOptions
+///
+/// Describe how the HashJoin kernel matches the rows of two tables.
+struct ARROW_EXPORT JoinOptions {
+  enum type {
+    // Pairs of matching rows.
+    INNER = 0,
+    // Pairs of matching rows, and left rows without a match paired with nulls.
+    LEFT_OUTER,
+    // Left rows with at least one match.
+    LEFT_SEMI,
+    // Left rows without any match.
+    LEFT_ANTI,
+  };
+
+  /// Let HashJoin pick partition_bits so that each partition of the build
+  /// side fits in the CPU cache.
+  static constexpr int kAutoPartitionBits = -1;
+
+  JoinOptions(enum type join_type, std::vector<std::string> left_keys,
+              std::vector<std::string> right_keys)
+      : join_type(join_type),
+        left_keys(std::move(left_keys)),
+        right_keys(std::move(right_keys)) {}
+
+  enum type join_type;
+  /// Names of the key columns of the left table.
+  std::vector<std::string> left_keys;
+  /// Names of the key columns of the right table, matched pairwise with
+  /// left_keys.
+  std::vector<std::string> right_keys;
+  /// Number of probe rows looked up at once, which bounds the length of the
+  /// output chunks (except for inner and left outer joins with duplicate keys).
+  int64_t batch_size = 64 * 1024;
+  /// Radix partition the rows by the hash of their keys into
+  /// 2^partition_bits partitions, each with its own hash table. 0 builds a
+  /// single hash table.
+  int partition_bits = 0;
+};
+
+/// \brief Join two tables on equality of their key columns.
+///
+/// A hash table is built over the keys of one side (the smaller table for an
+/// inner join, the right table otherwise), then probed with record batches of
+/// the other side. Output rows are gathered with the Take kernel and follow
+/// the order of the probe side, hence of the left table for all but inner
+/// joins. Null keys match nothing.
+///
+/// The output has the columns of the left table followed by those of the
+/// right table, except for semi and anti joins which only output the
+/// columns of the left table.
+///
+/// For example given left = {k: [1, 2, null, 2], a: ["w", "x", "y", "z"]},
+/// right = {k: [2, 3], b: [true, false]} and a LEFT_OUTER join on k, the
+/// output is {k: [1, 2, null, 2], a: ["w", "x", "y", "z"],
+/// k: [null, 2, null, 2], b: [null, true, null, true]}
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left the left table
+/// \param[in] right the right table
+/// \param[in] options join type and key columns, see JoinOptions
+/// \param[out] out resulting table
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* context, const Table& left, const Table& right,
+                const JoinOptions& options, std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
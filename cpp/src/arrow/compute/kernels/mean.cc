@@ -111,5 +111,20 @@ Status Mean(FunctionContext* ctx, const Array& array, Datum* out) {
   return Mean(ctx, array.data(), out);
 }
 
+Status Mean(FunctionContext* ctx, const Datum& value, const SelectionVector& selection,
+           Datum* out) {
+  std::shared_ptr<AggregateUnaryKernel> kernel;
+
+  auto data_type = value.type();
+  if (data_type == nullptr)
+    return Status::Invalid("Datum must be array-like");
+  else if (!is_integer(data_type->id()) && !is_floating(data_type->id()))
+    return Status::Invalid("Datum must contain a NumericType");
+
+  RETURN_NOT_OK(GetMeanKernel(ctx, *data_type, kernel));
+
+  return kernel->Call(ctx, value, selection, out);
+}
+
 }  // namespace compute
 }  // namespace arrow
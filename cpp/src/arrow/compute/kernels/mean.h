@@ -35,6 +35,7 @@ namespace compute {
 struct Datum;
 class FunctionContext;
 class AggregateFunction;
+class SelectionVector;
 
 ARROW_EXPORT
 std::shared_ptr<AggregateFunction> MakeMeanAggregateFunction(const DataType& type,
@@ -62,5 +63,18 @@ Status Mean(FunctionContext* context, const Datum& value, Datum* mean);
 ARROW_EXPORT
 Status Mean(FunctionContext* context, const Array& array, Datum* mean);
 
+/// \brief Compute the mean of the selected values of a numeric array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value datum to compute the mean, expecting Array
+/// \param[in] selection positions of the values to average
+/// \param[out] mean datum of the computed mean as a DoubleScalar
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Mean(FunctionContext* context, const Datum& value,
+            const SelectionVector& selection, Datum* mean);
+
 }  // namespace compute
 };  // namespace arrow
@@ -0,0 +1,318 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/minmax.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/selection-vector.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// Only parametric types (e.g. timestamps) take their type as a Scalar
+// constructor argument.
+template <typename ScalarType, typename CType>
+typename std::enable_if<std::is_constructible<ScalarType, CType,
+                                              const std::shared_ptr<DataType>&,
+                                              bool>::value,
+                        std::shared_ptr<Scalar>>::type
+MakeMinMaxScalar(CType value, const std::shared_ptr<DataType>& type, bool is_valid) {
+  return std::make_shared<ScalarType>(value, type, is_valid);
+}
+
+template <typename ScalarType, typename CType>
+typename std::enable_if<!std::is_constructible<ScalarType, CType,
+                                               const std::shared_ptr<DataType>&,
+                                               bool>::value,
+                        std::shared_ptr<Scalar>>::type
+MakeMinMaxScalar(CType value, const std::shared_ptr<DataType>&, bool is_valid) {
+  return std::make_shared<ScalarType>(value, is_valid);
+}
+
+template <typename ArrowType>
+struct MinMaxState {
+  using ThisType = MinMaxState<ArrowType>;
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using Bounds = MinMaxBounds<CType>;
+
+  ThisType& operator+=(const ThisType& rhs) {
+    this->has_nulls |= rhs.has_nulls;
+    this->has_values |= rhs.has_values;
+    this->min = std::min(this->min, rhs.min);
+    this->max = std::max(this->max, rhs.max);
+
+    return *this;
+  }
+
+  CType min = Bounds::min_identity();
+  CType max = Bounds::max_identity();
+  bool has_nulls = false;
+  bool has_values = false;
+};
+
+template <typename ArrowType>
+class MinMaxAggregateFunction final
+    : public AggregateFunctionStaticState<MinMaxState<ArrowType>> {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+  using StateType = MinMaxState<ArrowType>;
+  using Bounds = MinMaxBounds<CType>;
+
+  // Validity bits are consumed one machine word at a time.
+  static constexpr int64_t kWordBits = 64;
+
+ public:
+  MinMaxAggregateFunction(const std::shared_ptr<DataType>& type,
+                          const MinMaxOptions& options)
+      : type_(type), options_(options) {}
+
+  Status Consume(const Array& input, StateType* state) const override {
+    const ArrayType& array = static_cast<const ArrayType&>(input);
+
+    StateType local;
+    if (input.null_count() == 0) {
+      ConsumeDense(array.raw_values(), array.length(), &local);
+    } else {
+      local.has_nulls = true;
+      ConsumeSparse(array, &local);
+    }
+    local.has_values = local.has_values || (array.length() > array.null_count());
+
+    *state += local;
+    return Status::OK();
+  }
+
+  Status ConsumeSelection(const Array& input, const SelectionVector& selection,
+                          StateType* state) const override {
+    const ArrayType& array = static_cast<const ArrayType&>(input);
+    const CType* values = array.raw_values();
+    const int32_t* indices = selection.raw_indices();
+    const int64_t length = selection.length();
+
+    StateType local;
+    CType local_min = local.min;
+    CType local_max = local.max;
+    int64_t valid_count = length;
+    if (input.null_count() == 0) {
+      for (int64_t i = 0; i < length; i++) {
+        local_min = std::min(local_min, values[indices[i]]);
+        local_max = std::max(local_max, values[indices[i]]);
+      }
+    } else {
+      const uint8_t* bitmap = array.null_bitmap_data();
+      const int64_t offset = array.offset();
+      valid_count = 0;
+      for (int64_t i = 0; i < length; i++) {
+        const bool valid = BitUtil::GetBit(bitmap, offset + indices[i]);
+        const CType value = values[indices[i]];
+        local_min = std::min(local_min, valid ? value : Bounds::min_identity());
+        local_max = std::max(local_max, valid ? value : Bounds::max_identity());
+        valid_count += valid;
+      }
+    }
+    local.min = local_min;
+    local.max = local_max;
+    local.has_nulls = valid_count < length;
+    local.has_values = valid_count > 0;
+
+    *state += local;
+    return Status::OK();
+  }
+
+  Status Merge(const StateType& src, StateType* dst) const override {
+    *dst += src;
+    return Status::OK();
+  }
+
+  Status Finalize(const StateType& src, Datum* output) const override {
+    const bool output_null =
+        src.has_nulls && options_.null_handling == MinMaxOptions::OUTPUT_NULL;
+    // An all-NaN input leaves both extrema at their identity.
+    const bool is_empty = src.min > src.max;
+    const bool is_valid = src.has_values && !is_empty && !output_null;
+
+    *output = std::vector<Datum>{MakeMinMaxScalar<ScalarType>(src.min, type_, is_valid),
+                                 MakeMinMaxScalar<ScalarType>(src.max, type_, is_valid)};
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return struct_({field("min", type_), field("max", type_)});
+  }
+
+ private:
+  // The loop carries no dependency other than the two reductions, which lets
+  // the compiler vectorise it with packed min/max instructions.
+  static inline void ConsumeDense(const CType* values, int64_t length, StateType* state) {
+    CType local_min = state->min;
+    CType local_max = state->max;
+    for (int64_t i = 0; i < length; i++) {
+      local_min = std::min(local_min, values[i]);
+      local_max = std::max(local_max, values[i]);
+    }
+    state->min = local_min;
+    state->max = local_max;
+  }
+
+  // Replace null slots by the identity element instead of branching on every
+  // bit, the select compiles to a conditional move (or a blend).
+  static inline void ConsumeMasked(uint64_t bits, const CType* values, int64_t length,
+                                   StateType* state) {
+    CType local_min = state->min;
+    CType local_max = state->max;
+    for (int64_t i = 0; i < length; i++) {
+      const bool valid = (bits >> i) & 1;
+      local_min = std::min(local_min, valid ? values[i] : Bounds::min_identity());
+      local_max = std::max(local_max, valid ? values[i] : Bounds::max_identity());
+    }
+    state->min = local_min;
+    state->max = local_max;
+  }
+
+  // Load the kWordBits validity bits starting at bit `offset`, which needs
+  // not be byte-aligned. All the bytes read overlap the requested bits.
+  static inline uint64_t LoadValidityWord(const uint8_t* bitmap, int64_t offset) {
+    const uint8_t* bytes = bitmap + offset / 8;
+    const int64_t shift = offset % 8;
+
+    uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    word = BitUtil::FromLittleEndian(word);
+    if (shift != 0) {
+      word = (word >> shift) | (static_cast<uint64_t>(bytes[8]) << (kWordBits - shift));
+    }
+    return word;
+  }
+
+  static void ConsumeSparse(const ArrayType& array, StateType* state) {
+    const uint8_t* bitmap = array.null_bitmap_data();
+    const CType* values = array.raw_values();
+    const int64_t offset = array.offset();
+    const int64_t length = array.length();
+
+    int64_t i = 0;
+    for (; i + kWordBits <= length; i += kWordBits) {
+      const uint64_t bits = LoadValidityWord(bitmap, offset + i);
+      if (bits == ~static_cast<uint64_t>(0)) {
+        ConsumeDense(values + i, kWordBits, state);
+      } else if (bits != 0) {
+        ConsumeMasked(bits, values + i, kWordBits, state);
+      }
+    }
+
+    // Trailing values which do not fill a complete word.
+    uint64_t bits = 0;
+    for (int64_t j = 0; i + j < length; j++) {
+      bits |= static_cast<uint64_t>(BitUtil::GetBit(bitmap, offset + i + j)) << j;
+    }
+    ConsumeMasked(bits, values + i, length - i, state);
+  }
+
+  std::shared_ptr<DataType> type_;
+  MinMaxOptions options_;
+};
+
+}  // namespace
+
+#define MINMAX_AGG_FN_CASE(T)                           \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<MinMaxAggregateFunction<T>>(type, options));
+
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunction(
+    const std::shared_ptr<DataType>& type, FunctionContext* ctx,
+    const MinMaxOptions& options) {
+  switch (type->id()) {
+    MINMAX_AGG_FN_CASE(UInt8Type);
+    MINMAX_AGG_FN_CASE(Int8Type);
+    MINMAX_AGG_FN_CASE(UInt16Type);
+    MINMAX_AGG_FN_CASE(Int16Type);
+    MINMAX_AGG_FN_CASE(UInt32Type);
+    MINMAX_AGG_FN_CASE(Int32Type);
+    MINMAX_AGG_FN_CASE(UInt64Type);
+    MINMAX_AGG_FN_CASE(Int64Type);
+    MINMAX_AGG_FN_CASE(FloatType);
+    MINMAX_AGG_FN_CASE(DoubleType);
+    MINMAX_AGG_FN_CASE(Date32Type);
+    MINMAX_AGG_FN_CASE(Date64Type);
+    MINMAX_AGG_FN_CASE(Time32Type);
+    MINMAX_AGG_FN_CASE(Time64Type);
+    MINMAX_AGG_FN_CASE(TimestampType);
+    default:
+      return nullptr;
+  }
+
+#undef MINMAX_AGG_FN_CASE
+}
+
+static Status GetMinMaxKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                              const MinMaxOptions& options,
+                              std::shared_ptr<AggregateUnaryKernel>& kernel) {
+  std::shared_ptr<AggregateFunction> aggregate =
+      MakeMinMaxAggregateFunction(type, ctx, options);
+  if (!aggregate) return Status::Invalid("No min/max for type ", *type);
+
+  kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+
+  return Status::OK();
+}
+
+Status MinMax(FunctionContext* ctx, const MinMaxOptions& options, const Datum& value,
+              Datum* out) {
+  std::shared_ptr<AggregateUnaryKernel> kernel;
+
+  auto data_type = value.type();
+  if (data_type == nullptr) return Status::Invalid("Datum must be array-like");
+
+  RETURN_NOT_OK(GetMinMaxKernel(ctx, data_type, options, kernel));
+
+  return kernel->Call(ctx, value, out);
+}
+
+Status MinMax(FunctionContext* ctx, const MinMaxOptions& options, const Array& array,
+              Datum* out) {
+  return MinMax(ctx, options, array.data(), out);
+}
+
+Status MinMax(FunctionContext* ctx, const MinMaxOptions& options, const Datum& value,
+              const SelectionVector& selection, Datum* out) {
+  std::shared_ptr<AggregateUnaryKernel> kernel;
+
+  auto data_type = value.type();
+  if (data_type == nullptr) return Status::Invalid("Datum must be array-like");
+
+  RETURN_NOT_OK(GetMinMaxKernel(ctx, data_type, options, kernel));
+
+  return kernel->Call(ctx, value, selection, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+class SelectionVector;
+
+/// \class MinMaxOptions
+///
+/// The user control the MinMax kernel behavior with this class. By default,
+/// null values are ignored.
+struct ARROW_EXPORT MinMaxOptions {
+  enum mode {
+    // Ignore null values.
+    SKIP = 0,
+    // Output null if any value is null.
+    OUTPUT_NULL,
+  };
+
+  explicit MinMaxOptions(enum mode null_handling = SKIP) : null_handling(null_handling) {}
+
+  enum mode null_handling = SKIP;
+};
+
+/// \brief Return a MinMax function aggregate for a numeric or temporal type
+///
+/// Returns nullptr if the type is not supported.
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunction(
+    const std::shared_ptr<DataType>& type, FunctionContext* context,
+    const MinMaxOptions& options);
+
+/// \brief Compute the minimum and maximum values of a numeric or temporal array.
+///
+/// Both values are computed in a single pass. NaN values of floating point
+/// arrays are ignored. If the array contains no (non-NaN) valid values, or
+/// contains nulls and options.null_handling is OUTPUT_NULL, both resulting
+/// scalars are null.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options see MinMaxOptions for more information
+/// \param[in] value datum to compute the extrema, expecting Array
+/// \param[out] minmax a collection datum of two scalars of the input type,
+/// the minimum followed by the maximum
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MinMax(FunctionContext* context, const MinMaxOptions& options, const Datum& value,
+              Datum* minmax);
+
+/// \brief Compute the minimum and maximum values of a numeric or temporal array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options see MinMaxOptions for more information
+/// \param[in] array to compute the extrema
+/// \param[out] minmax a collection datum of two scalars of the input type,
+/// the minimum followed by the maximum
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MinMax(FunctionContext* context, const MinMaxOptions& options, const Array& array,
+              Datum* minmax);
+
+/// \brief Compute the minimum and maximum of the selected values of an array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options see MinMaxOptions for more information
+/// \param[in] value datum to compute the extrema, expecting Array
+/// \param[in] selection positions of the values to consider
+/// \param[out] minmax a collection datum of two scalars of the input type,
+/// the minimum followed by the maximum
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MinMax(FunctionContext* context, const MinMaxOptions& options, const Datum& value,
+              const SelectionVector& selection, Datum* minmax);
+
+}  // namespace compute
+}  // namespace arrow
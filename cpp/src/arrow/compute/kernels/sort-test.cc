@@ -0,0 +1,189 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/sort.h"
+#include "arrow/compute/test-util.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestSortKernel : public ComputeFixture, public TestBase {
+ protected:
+  void AssertSortIndices(const std::shared_ptr<DataType>& type, const std::string& values,
+                         SortOptions::order order, const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortIndices(&this->ctx_, *ArrayFromJSON(type, values), SortOptions(order),
+                          &actual));
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+};
+
+TEST_F(TestSortKernel, Integers) {
+  for (auto type : {int8(), uint16(), int32(), uint64(), date32(), time64(TimeUnit::NANO),
+                    timestamp(TimeUnit::MILLI)}) {
+    this->AssertSortIndices(type, "[]", SortOptions::ASCENDING, "[]");
+    this->AssertSortIndices(type, "[5, null, 1, 5, 3]", SortOptions::ASCENDING,
+                            "[2, 4, 0, 3, 1]");
+    this->AssertSortIndices(type, "[5, null, 1, 5, 3]", SortOptions::DESCENDING,
+                            "[0, 3, 4, 2, 1]");
+  }
+  this->AssertSortIndices(int16(), "[-1, 3, -32768, 0, 32767]", SortOptions::ASCENDING,
+                          "[2, 0, 3, 1, 4]");
+}
+
+TEST_F(TestSortKernel, FloatingPoint) {
+  this->AssertSortIndices(float64(), "[2.5, null, NaN, -1.0, 2.5]",
+                          SortOptions::ASCENDING, "[3, 0, 4, 2, 1]");
+  this->AssertSortIndices(float32(), "[2.5, null, NaN, -1.0, 2.5]",
+                          SortOptions::DESCENDING, "[0, 4, 3, 2, 1]");
+}
+
+TEST_F(TestSortKernel, Binary) {
+  for (auto type : {utf8(), binary()}) {
+    this->AssertSortIndices(type, R"(["b", null, "", "ab", "b"])", SortOptions::ASCENDING,
+                            "[2, 3, 0, 4, 1]");
+    this->AssertSortIndices(type, R"(["b", null, "", "ab", "b"])",
+                            SortOptions::DESCENDING, "[0, 4, 3, 2, 1]");
+  }
+  this->AssertSortIndices(boolean(), "[true, null, false, true]", SortOptions::ASCENDING,
+                          "[2, 0, 3, 1]");
+}
+
+template <typename ArrowType>
+class TestSortKernelRandom : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestSortKernelRandom, NumericArrowTypes);
+TYPED_TEST(TestSortKernelRandom, SortMatchesStableSort) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  auto rand = random::RandomArrayGenerator(0x5487656);
+  // Long enough to exercise the radix sort
+  for (int64_t length : {10, 1000}) {
+    for (auto null_probability : {0.0, 0.1, 1.0}) {
+      for (auto order : {SortOptions::ASCENDING, SortOptions::DESCENDING}) {
+        auto array = rand.Numeric<TypeParam>(length, 0, 100, null_probability);
+        const auto& values = checked_cast<const ArrayType&>(*array);
+
+        std::vector<uint64_t> expected(length);
+        std::iota(expected.begin(), expected.end(), 0);
+        std::stable_sort(expected.begin(), expected.end(),
+                         [&](uint64_t left, uint64_t right) {
+                           if (values.IsNull(left) || values.IsNull(right)) {
+                             return values.IsValid(left) && values.IsNull(right);
+                           }
+                           return order == SortOptions::ASCENDING
+                                      ? values.Value(left) < values.Value(right)
+                                      : values.Value(right) < values.Value(left);
+                         });
+
+        std::shared_ptr<Array> actual;
+        ASSERT_OK(SortIndices(&this->ctx_, values, SortOptions(order), &actual));
+        std::shared_ptr<Array> expected_array;
+        ArrayFromVector<UInt64Type, uint64_t>(expected, &expected_array);
+        AssertArraysEqual(*expected_array, *actual);
+      }
+    }
+  }
+}
+
+TYPED_TEST(TestSortKernelRandom, Partition) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  auto rand = random::RandomArrayGenerator(0x5487657);
+  auto array = rand.Numeric<TypeParam>(300, 0, 100, 0.1);
+  const auto& values = checked_cast<const ArrayType&>(*array);
+  const int64_t non_nulls = values.length() - values.null_count();
+
+  for (int64_t n : {int64_t(0), non_nulls / 2, non_nulls - 1, non_nulls + 1}) {
+    std::shared_ptr<Array> out;
+    ASSERT_OK(Partition(&this->ctx_, values, n, SortOptions(), &out));
+    const auto& indices = checked_cast<const UInt64Array&>(*out);
+    ASSERT_EQ(values.length(), indices.length());
+
+    std::vector<uint64_t> seen(indices.raw_values(),
+                               indices.raw_values() + indices.length());
+    std::sort(seen.begin(), seen.end());
+    for (int64_t i = 0; i < values.length(); i++) {
+      ASSERT_EQ(static_cast<uint64_t>(i), seen[i]);
+    }
+
+    for (int64_t i = 0; i < values.length(); i++) {
+      const bool is_null = values.IsNull(indices.Value(i));
+      ASSERT_EQ(i >= non_nulls, is_null);
+      if (n < non_nulls && !is_null) {
+        const auto pivot = values.Value(indices.Value(n));
+        const auto value = values.Value(indices.Value(i));
+        if (i < n) {
+          ASSERT_LE(value, pivot);
+        } else if (i > n) {
+          ASSERT_GE(value, pivot);
+        }
+      }
+    }
+  }
+
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, Partition(&this->ctx_, values, values.length(), SortOptions(),
+                                   &out));
+}
+
+TEST_F(TestSortKernel, Table) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", utf8())});
+  std::vector<std::shared_ptr<Column>> columns = {
+      std::make_shared<Column>(
+          schema->field(0),
+          ArrayVector{ArrayFromJSON(int32(), "[1, 2, null]"),
+                      ArrayFromJSON(int32(), "[1, 2, 1]")}),
+      std::make_shared<Column>(
+          schema->field(1),
+          ArrayVector{ArrayFromJSON(utf8(), R"(["z", "y", "x"])"),
+                      ArrayFromJSON(utf8(), R"(["w", null, "z"])")})};
+  auto table = Table::Make(schema, columns);
+
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(SortIndices(&this->ctx_, *table, {SortKey("a"), SortKey("b")}, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[3, 0, 5, 1, 4, 2]"), *actual);
+
+  ASSERT_OK(SortIndices(&this->ctx_, *table,
+                        {SortKey("a", SortOptions::DESCENDING), SortKey("b")}, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 4, 3, 0, 5, 2]"), *actual);
+
+  ASSERT_RAISES(Invalid, SortIndices(&this->ctx_, *table, {}, &actual));
+  ASSERT_RAISES(Invalid, SortIndices(&this->ctx_, *table, {SortKey("c")}, &actual));
+}
+
+}  // namespace compute
+}  // namespace arrow
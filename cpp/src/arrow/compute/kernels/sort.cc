@@ -0,0 +1,358 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/sort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/concatenate.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Sorters rearrange a range of indices into an array according to the
+// referenced values. Nulls are always moved to the end of the range.
+
+class ArraySorter {
+ public:
+  ArraySorter(const Array& values, SortOptions::order order)
+      : values_(values), order_(order) {}
+
+  virtual ~ArraySorter() = default;
+
+  // Stable sort of the indices in [begin, end)
+  void Sort(uint64_t* begin, uint64_t* end) {
+    uint64_t* nulls_begin = PartitionNulls(begin, end);
+    SortNonNulls(begin, nulls_begin);
+  }
+
+  // Partial sort of the indices in [begin, end) around nth
+  void NthElement(uint64_t* begin, uint64_t* nth, uint64_t* end) {
+    uint64_t* nulls_begin = PartitionNulls(begin, end);
+    if (nth < nulls_begin) {
+      NthElementNonNulls(begin, nth, nulls_begin);
+    }
+  }
+
+ protected:
+  // Move the indices of null values to the end, keeping the relative order
+  // of each partition. Return the end of the non-null indices.
+  virtual uint64_t* PartitionNulls(uint64_t* begin, uint64_t* end) {
+    if (values_.null_count() == 0) {
+      return end;
+    }
+    return std::stable_partition(begin, end,
+                                 [this](uint64_t i) { return values_.IsValid(i); });
+  }
+
+  virtual void SortNonNulls(uint64_t* begin, uint64_t* end) = 0;
+  virtual void NthElementNonNulls(uint64_t* begin, uint64_t* nth, uint64_t* end) = 0;
+
+  const Array& values_;
+  const SortOptions::order order_;
+};
+
+// Comparison based sorter, working for any array with a GetView method.
+template <typename ArrowType>
+class CompareSorter : public ArraySorter {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  CompareSorter(const Array& values, SortOptions::order order)
+      : ArraySorter(values, order), array_(checked_cast<const ArrayType&>(values)) {}
+
+ protected:
+  void SortNonNulls(uint64_t* begin, uint64_t* end) override {
+    // std::stable_sort is a merge sort
+    if (order_ == SortOptions::ASCENDING) {
+      std::stable_sort(begin, end, [this](uint64_t left, uint64_t right) {
+        return array_.GetView(left) < array_.GetView(right);
+      });
+    } else {
+      std::stable_sort(begin, end, [this](uint64_t left, uint64_t right) {
+        return array_.GetView(right) < array_.GetView(left);
+      });
+    }
+  }
+
+  void NthElementNonNulls(uint64_t* begin, uint64_t* nth, uint64_t* end) override {
+    if (order_ == SortOptions::ASCENDING) {
+      std::nth_element(begin, nth, end, [this](uint64_t left, uint64_t right) {
+        return array_.GetView(left) < array_.GetView(right);
+      });
+    } else {
+      std::nth_element(begin, nth, end, [this](uint64_t left, uint64_t right) {
+        return array_.GetView(right) < array_.GetView(left);
+      });
+    }
+  }
+
+  const ArrayType& array_;
+};
+
+// NaNs do not compare, so they are moved between the other values and the
+// nulls before sorting.
+template <typename ArrowType>
+class FloatingPointSorter : public CompareSorter<ArrowType> {
+ public:
+  using CompareSorter<ArrowType>::CompareSorter;
+
+ protected:
+  uint64_t* PartitionNulls(uint64_t* begin, uint64_t* end) override {
+    uint64_t* nulls_begin = CompareSorter<ArrowType>::PartitionNulls(begin, end);
+    return std::stable_partition(begin, nulls_begin, [this](uint64_t i) {
+      return !std::isnan(this->array_.Value(i));
+    });
+  }
+};
+
+// LSD radix sort on fixed-width integers, one byte per pass. Keys are
+// transformed so that their unsigned order matches the requested order,
+// which keeps the sort stable in both directions.
+template <typename ArrowType>
+class RadixSorter : public CompareSorter<ArrowType> {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using KeyType = typename std::make_unsigned<CType>::type;
+
+  // Below this length, the histogram passes cost more than a merge sort.
+  static constexpr int64_t kMinRadixSortLength = 256;
+  static constexpr int kBitsPerPass = 8;
+  static constexpr int kBuckets = 1 << kBitsPerPass;
+
+ public:
+  using CompareSorter<ArrowType>::CompareSorter;
+
+ protected:
+  void SortNonNulls(uint64_t* begin, uint64_t* end) override {
+    const int64_t length = end - begin;
+    if (length < kMinRadixSortLength) {
+      CompareSorter<ArrowType>::SortNonNulls(begin, end);
+      return;
+    }
+
+    constexpr int kKeyBits = static_cast<int>(sizeof(KeyType) * 8);
+    const KeyType sign_flip = std::is_signed<CType>::value
+                                  ? static_cast<KeyType>(KeyType(1) << (kKeyBits - 1))
+                                  : KeyType(0);
+    const KeyType order_flip = this->order_ == SortOptions::ASCENDING
+                                   ? KeyType(0)
+                                   : static_cast<KeyType>(~KeyType(0));
+
+    std::vector<KeyType> keys(length), sorted_keys(length);
+    std::vector<uint64_t> sorted_indices(length);
+
+    const CType* values = this->array_.raw_values();
+    for (int64_t i = 0; i < length; i++) {
+      keys[i] = static_cast<KeyType>(static_cast<KeyType>(values[begin[i]]) ^ sign_flip ^
+                                     order_flip);
+    }
+
+    KeyType* src_keys = keys.data();
+    KeyType* dst_keys = sorted_keys.data();
+    uint64_t* src_indices = begin;
+    uint64_t* dst_indices = sorted_indices.data();
+
+    for (int shift = 0; shift < kKeyBits; shift += kBitsPerPass) {
+      int64_t offsets[kBuckets + 1] = {0};
+      for (int64_t i = 0; i < length; i++) {
+        ++offsets[((src_keys[i] >> shift) & (kBuckets - 1)) + 1];
+      }
+      // Skip passes where all keys share the same digit
+      if (std::any_of(offsets + 1, offsets + kBuckets + 1,
+                      [length](int64_t count) { return count == length; })) {
+        continue;
+      }
+      std::partial_sum(offsets, offsets + kBuckets + 1, offsets);
+
+      for (int64_t i = 0; i < length; i++) {
+        const int64_t pos = offsets[(src_keys[i] >> shift) & (kBuckets - 1)]++;
+        dst_keys[pos] = src_keys[i];
+        dst_indices[pos] = src_indices[i];
+      }
+      std::swap(src_keys, dst_keys);
+      std::swap(src_indices, dst_indices);
+    }
+
+    if (src_indices != begin) {
+      std::copy(src_indices, src_indices + length, begin);
+    }
+  }
+};
+
+#define RADIX_SORTER_CASE(T)                       \
+  case T::type_id:                                 \
+    out->reset(new RadixSorter<T>(values, order)); \
+    return Status::OK();
+
+#define FLOATING_POINT_SORTER_CASE(T)                      \
+  case T::type_id:                                         \
+    out->reset(new FloatingPointSorter<T>(values, order)); \
+    return Status::OK();
+
+#define COMPARE_SORTER_CASE(T)                       \
+  case T::type_id:                                   \
+    out->reset(new CompareSorter<T>(values, order)); \
+    return Status::OK();
+
+Status MakeArraySorter(const Array& values, SortOptions::order order,
+                       std::unique_ptr<ArraySorter>* out) {
+  switch (values.type_id()) {
+    RADIX_SORTER_CASE(UInt8Type)
+    RADIX_SORTER_CASE(Int8Type)
+    RADIX_SORTER_CASE(UInt16Type)
+    RADIX_SORTER_CASE(Int16Type)
+    RADIX_SORTER_CASE(UInt32Type)
+    RADIX_SORTER_CASE(Int32Type)
+    RADIX_SORTER_CASE(UInt64Type)
+    RADIX_SORTER_CASE(Int64Type)
+    RADIX_SORTER_CASE(Date32Type)
+    RADIX_SORTER_CASE(Date64Type)
+    RADIX_SORTER_CASE(Time32Type)
+    RADIX_SORTER_CASE(Time64Type)
+    RADIX_SORTER_CASE(TimestampType)
+    FLOATING_POINT_SORTER_CASE(FloatType)
+    FLOATING_POINT_SORTER_CASE(DoubleType)
+    COMPARE_SORTER_CASE(BooleanType)
+    COMPARE_SORTER_CASE(BinaryType)
+    COMPARE_SORTER_CASE(StringType)
+    COMPARE_SORTER_CASE(FixedSizeBinaryType)
+    default:
+      break;
+  }
+  return Status::NotImplemented("Sorting not implemented for type ",
+                                values.type()->ToString());
+}
+
+#undef RADIX_SORTER_CASE
+#undef FLOATING_POINT_SORTER_CASE
+#undef COMPARE_SORTER_CASE
+
+// Allocate an UInt64Array holding 0, 1, ..., length - 1
+Status MakeIdentityIndices(FunctionContext* ctx, int64_t length,
+                           std::shared_ptr<ArrayData>* out) {
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(),
+                               TypeTraits<UInt64Type>::bytes_required(length), &buffer));
+  auto indices = reinterpret_cast<uint64_t*>(buffer->mutable_data());
+  std::iota(indices, indices + length, 0);
+  *out = ArrayData::Make(uint64(), length, {nullptr, buffer}, 0 /* null_count */);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status SortIndices(FunctionContext* ctx, const Array& values, const SortOptions& options,
+                   std::shared_ptr<Array>* indices) {
+  std::unique_ptr<ArraySorter> sorter;
+  RETURN_NOT_OK(MakeArraySorter(values, options.sort_order, &sorter));
+
+  std::shared_ptr<ArrayData> data;
+  RETURN_NOT_OK(MakeIdentityIndices(ctx, values.length(), &data));
+  auto begin = data->GetMutableValues<uint64_t>(1);
+  sorter->Sort(begin, begin + values.length());
+
+  *indices = MakeArray(data);
+  return Status::OK();
+}
+
+Status SortIndices(FunctionContext* ctx, const Table& table,
+                   const std::vector<SortKey>& keys, std::shared_ptr<Array>* indices) {
+  if (keys.empty()) {
+    return Status::Invalid("Must specify one or more sort keys");
+  }
+
+  std::shared_ptr<ArrayData> data;
+  RETURN_NOT_OK(MakeIdentityIndices(ctx, table.num_rows(), &data));
+  auto begin = data->GetMutableValues<uint64_t>(1);
+
+  // Random access is needed, thus chunked columns are concatenated.
+  std::vector<std::shared_ptr<Array>> columns;
+  for (const auto& key : keys) {
+    const int index = table.schema()->GetFieldIndex(key.name);
+    if (index < 0) {
+      return Status::Invalid("No column named '", key.name, "' to sort by");
+    }
+    if (table.num_rows() == 0) {
+      continue;
+    }
+    const auto& chunks = table.column(index)->data()->chunks();
+    std::shared_ptr<Array> column;
+    if (chunks.size() == 1) {
+      column = chunks[0];
+    } else {
+      RETURN_NOT_OK(Concatenate(chunks, ctx->memory_pool(), &column));
+    }
+    columns.push_back(std::move(column));
+  }
+
+  std::vector<std::unique_ptr<ArraySorter>> sorters(columns.size());
+  for (size_t i = 0; i < columns.size(); i++) {
+    RETURN_NOT_OK(MakeArraySorter(*columns[i], keys[i].sort_order, &sorters[i]));
+  }
+
+  // The sorts being stable, sorting by the least significant key first
+  // yields the lexicographic order.
+  for (auto it = sorters.rbegin(); it != sorters.rend(); ++it) {
+    (*it)->Sort(begin, begin + table.num_rows());
+  }
+
+  *indices = MakeArray(data);
+  return Status::OK();
+}
+
+Status Partition(FunctionContext* ctx, const Array& values, int64_t n,
+                 const SortOptions& options, std::shared_ptr<Array>* indices) {
+  if (values.length() > 0 && (n < 0 || n >= values.length())) {
+    return Status::Invalid("Partition position ", n,
+                           " out of bounds for array of length ", values.length());
+  }
+
+  std::unique_ptr<ArraySorter> sorter;
+  RETURN_NOT_OK(MakeArraySorter(values, options.sort_order, &sorter));
+
+  std::shared_ptr<ArrayData> data;
+  RETURN_NOT_OK(MakeIdentityIndices(ctx, values.length(), &data));
+  auto begin = data->GetMutableValues<uint64_t>(1);
+  sorter->NthElement(begin, begin + n, begin + values.length());
+
+  *indices = MakeArray(data);
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \class SortOptions
+///
+/// Control the order of the SortIndices and Partition kernels. Whatever the
+/// order, nulls are placed at the end, preceded by NaNs for floating point
+/// types.
+struct ARROW_EXPORT SortOptions {
+  enum order {
+    // Smallest values first.
+    ASCENDING = 0,
+    // Largest values first.
+    DESCENDING,
+  };
+
+  explicit SortOptions(enum order sort_order = ASCENDING) : sort_order(sort_order) {}
+
+  enum order sort_order;
+};
+
+/// \class SortKey
+///
+/// A column of a Table to sort by, and its order.
+struct ARROW_EXPORT SortKey {
+  explicit SortKey(const std::string& name,
+                   enum SortOptions::order sort_order = SortOptions::ASCENDING)
+      : name(name), sort_order(sort_order) {}
+
+  std::string name;
+  enum SortOptions::order sort_order;
+};
+
+/// \brief Return the indices that would sort an array
+///
+/// The sort is stable: equal values keep their relative order. Integer and
+/// temporal types are sorted with a radix sort, other types with a merge
+/// sort. The result can be fed to the Take kernel.
+///
+/// For example given values = [5, null, 1, 5, 3] and ascending order, the
+/// output is [2, 4, 0, 3, 1].
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array to sort
+/// \param[in] options sort order
+/// \param[out] indices resulting UInt64Array of the same length as values
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortIndices(FunctionContext* context, const Array& values,
+                   const SortOptions& options, std::shared_ptr<Array>* indices);
+
+/// \brief Return the indices that would sort a table lexicographically
+///
+/// Rows are ordered by the first key, ties broken by the following keys. The
+/// sort is stable and nulls of every key are placed at the end.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] table table to sort
+/// \param[in] keys columns to sort by, at least one
+/// \param[out] indices resulting UInt64Array with one entry per row
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortIndices(FunctionContext* context, const Table& table,
+                   const std::vector<SortKey>& keys, std::shared_ptr<Array>* indices);
+
+/// \brief Return indices partially sorting an array around its n-th element
+///
+/// Like std::nth_element, the output at position n is the index of the value
+/// that would be there if the array were sorted, the indices before it
+/// reference values that do not sort after it, and the indices after it
+/// values that do not sort before it. This is the building block of top-n
+/// selection and is cheaper than a full sort. The partition is not stable.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array to partition
+/// \param[in] n pivot position, in [0, values.length())
+/// \param[in] options sort order
+/// \param[out] indices resulting UInt64Array of the same length as values
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Partition(FunctionContext* context, const Array& values, int64_t n,
+                 const SortOptions& options, std::shared_ptr<Array>* indices);
+
+}  // namespace compute
+}  // namespace arrow
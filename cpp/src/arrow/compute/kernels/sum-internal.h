@@ -22,6 +22,7 @@
 
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/selection-vector.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -83,6 +84,33 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
     return Status::OK();
   }
 
+  Status ConsumeSelection(const Array& input, const SelectionVector& selection,
+                          StateType* state) const override {
+    const ArrayType& array = static_cast<const ArrayType&>(input);
+    const auto values = array.raw_values();
+    const int32_t* indices = selection.raw_indices();
+    const int64_t length = selection.length();
+
+    StateType local;
+    if (input.null_count() == 0) {
+      for (int64_t i = 0; i < length; i++) {
+        local.sum += values[indices[i]];
+      }
+      local.count = length;
+    } else {
+      const uint8_t* bitmap = array.null_bitmap_data();
+      const int64_t offset = array.offset();
+      for (int64_t i = 0; i < length; i++) {
+        const bool valid = BitUtil::GetBit(bitmap, offset + indices[i]);
+        local.sum += MaskedValue(valid, values[indices[i]]);
+        local.count += valid;
+      }
+    }
+
+    *state = local;
+    return Status::OK();
+  }
+
   Status Merge(const StateType& src, StateType* dst) const override {
     *dst += src;
     return Status::OK();
@@ -32,6 +32,7 @@ namespace compute {
 struct Datum;
 class FunctionContext;
 class AggregateFunction;
+class SelectionVector;
 
 /// \brief Return a Sum Kernel
 ///
@@ -66,5 +67,18 @@ Status Sum(FunctionContext* context, const Datum& value, Datum* out);
 ARROW_EXPORT
 Status Sum(FunctionContext* context, const Array& array, Datum* out);
 
+/// \brief Sum the selected values of a numeric array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value datum to sum, expecting Array
+/// \param[in] selection positions of the values to sum
+/// \param[out] out resulting datum
+///
+/// \since 0.14.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Sum(FunctionContext* context, const Datum& value, const SelectionVector& selection,
+           Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
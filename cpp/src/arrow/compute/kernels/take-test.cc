@@ -20,11 +20,14 @@
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/take.h"
+#include "arrow/compute/selection-vector.h"
 #include "arrow/compute/test-util.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace compute {
@@ -162,5 +165,52 @@ TEST_F(TestTakeKernelWithString, TakeDictionary) {
   this->AssertTakeDictionary(dict, "[3, 4, 2]", "[null, 1, 0]", options, "[null, 4, 3]");
 }
 
+TEST_F(TestTakeKernelWithString, TakeChunked) {
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(4, &pool));
+  FunctionContext parallel_ctx(default_memory_pool(), pool.get());
+
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(utf8(), R"(["a", "b"])"),
+                  ArrayFromJSON(utf8(), R"([null, "d"])")});
+  auto indices = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int8(), "[3, 0]"), ArrayFromJSON(int8(), "[]"),
+                  ArrayFromJSON(int8(), "[2, null, 1]")});
+  ChunkedArray expected({ArrayFromJSON(utf8(), R"(["d", "a"])"),
+                         ArrayFromJSON(utf8(), "[]"),
+                         ArrayFromJSON(utf8(), R"([null, null, "b"])")});
+
+  for (FunctionContext* ctx : {&this->ctx_, &parallel_ctx}) {
+    Datum out;
+    ASSERT_OK(arrow::compute::Take(ctx, values, indices, TakeOptions(), &out));
+    ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+    AssertChunkedEqual(expected, *out.chunked_array());
+
+    ASSERT_OK(arrow::compute::Take(ctx, values, ArrayFromJSON(int8(), "[1, 3]"),
+                                   TakeOptions(), &out));
+    ASSERT_EQ(Datum::ARRAY, out.kind());
+    AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["b", "d"])"), *out.make_array());
+
+    ASSERT_RAISES(Invalid, arrow::compute::Take(ctx, values, ArrayFromJSON(int8(), "[4]"),
+                                                TakeOptions(), &out));
+  }
+}
+
+TEST_F(TestTakeKernelWithString, TakeSelection) {
+  auto values = ArrayFromJSON(utf8(), R"(["a", "b", null, "d"])");
+  auto selection =
+      std::make_shared<SelectionVector>(ArrayFromJSON(int32(), "[1, 2, 3]"), 4);
+
+  Datum out;
+  ASSERT_OK(arrow::compute::Take(&this->ctx_, values, selection, TakeOptions(), &out));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["b", null, "d"])"), *out.make_array());
+
+  ASSERT_RAISES(Invalid, arrow::compute::Take(&this->ctx_, values->Slice(1), selection,
+                                              TakeOptions(), &out));
+  ASSERT_RAISES(Invalid,
+                arrow::compute::Take(&this->ctx_, std::make_shared<ChunkedArray>(values),
+                                     selection, TakeOptions(), &out));
+}
+
 }  // namespace compute
 }  // namespace arrow
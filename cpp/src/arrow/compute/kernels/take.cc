@@ -17,10 +17,15 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/selection-vector.h"
+#include "arrow/table.h"
+#include "arrow/util/concatenate.h"
 #include "arrow/util/logging.h"
 #include "arrow/visitor_inline.h"
 
@@ -36,8 +41,74 @@ Status Take(FunctionContext* context, const Array& values, const Array& indices,
   return Status::OK();
 }
 
+namespace {
+
+Status ChunkedTake(FunctionContext* context, const Datum& values, const Datum& indices,
+                   const TakeOptions& options, Datum* out) {
+  // Indices may reference any chunk of the values, so these are contiguous
+  std::shared_ptr<Array> values_array;
+  if (values.kind() == Datum::ARRAY) {
+    values_array = values.make_array();
+  } else if (values.chunked_array()->num_chunks() == 1) {
+    values_array = values.chunked_array()->chunk(0);
+  } else if (values.chunked_array()->num_chunks() == 0) {
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(context->memory_pool(), values.type(), &builder));
+    RETURN_NOT_OK(builder->Finish(&values_array));
+  } else {
+    RETURN_NOT_OK(Concatenate(values.chunked_array()->chunks(), context->memory_pool(),
+                              &values_array));
+  }
+
+  ArrayVector index_chunks;
+  if (indices.kind() == Datum::ARRAY) {
+    index_chunks.push_back(indices.make_array());
+  } else {
+    index_chunks = indices.chunked_array()->chunks();
+  }
+
+  ArrayVector out_chunks(index_chunks.size());
+  RETURN_NOT_OK(detail::ParallelFor(
+      context, static_cast<int>(index_chunks.size()),
+      [&](FunctionContext* task_context, int i) {
+        TakeKernel kernel(values_array->type(), options);
+        Datum out_chunk;
+        RETURN_NOT_OK(
+            kernel.Call(task_context, values_array, index_chunks[i], &out_chunk));
+        out_chunks[i] = out_chunk.make_array();
+        return Status::OK();
+      }));
+
+  if (indices.kind() == Datum::ARRAY) {
+    *out = out_chunks[0];
+  } else {
+    *out = std::make_shared<ChunkedArray>(out_chunks, values_array->type());
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
 Status Take(FunctionContext* context, const Datum& values, const Datum& indices,
             const TakeOptions& options, Datum* out) {
+  if (indices.kind() == Datum::SELECTION_VECTOR) {
+    const auto& selection = *indices.selection_vector();
+    if (values.kind() != Datum::ARRAY) {
+      return Status::Invalid("Take with a selection expects array values");
+    }
+    const int64_t length = values.array()->length;
+    if (selection.array_length() != length) {
+      return Status::Invalid("Selection of length ", selection.array_length(),
+                             " does not apply to an array of length ", length);
+    }
+    return Take(context, values, Datum(selection.indices()), options, out);
+  }
+  if (values.kind() == Datum::CHUNKED_ARRAY || indices.kind() == Datum::CHUNKED_ARRAY) {
+    if (!values.is_arraylike() || !indices.is_arraylike()) {
+      return Status::Invalid("Take expects array-like values and indices");
+    }
+    return ChunkedTake(context, values, indices, options, out);
+  }
   TakeKernel kernel(values.type(), options);
   RETURN_NOT_OK(kernel.Call(context, values, indices, out));
   return Status::OK();
@@ -55,6 +55,14 @@ Status Take(FunctionContext* context, const Array& values, const Array& indices,
 
 /// \brief Take from an array of values at indices in another array
 ///
+/// values and indices may be chunked. Chunked values are concatenated first,
+/// since any index may reference any chunk. The output is chunked like the
+/// indices; when the context has a thread pool the chunks are taken in
+/// parallel.
+///
+/// indices may also be a SelectionVector over the (non-chunked) values, such
+/// as the output of a comparison, which gathers the selected slots.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] values datum from which to take
 /// \param[in] indices which values to take
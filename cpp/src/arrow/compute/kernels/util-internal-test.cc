@@ -14,6 +14,7 @@
 // KIND, either express or implied.  See the License for the
 // specific language governing permissions and limitations
 // under the License.
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -27,6 +28,7 @@
 #include "arrow/buffer.h"
 #include "arrow/compute/kernels/util-internal.h"
 #include "arrow/compute/test-util.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace compute {
@@ -242,6 +244,52 @@ TEST(PrimitiveAllocatingBinaryKernel, NonBoolean) {
   EXPECT_THAT(value_buffer->capacity(), Ge(64));
 }
 
+TEST(ParallelFor, Serial) {
+  FunctionContext ctx(default_memory_pool());
+  std::vector<int> order;
+  ASSERT_OK(ParallelFor(&ctx, 5, [&](FunctionContext* task_ctx, int i) {
+    EXPECT_EQ(&ctx, task_ctx);
+    order.push_back(i);
+    return Status::OK();
+  }));
+  ASSERT_THAT(order, ElementsAre(0, 1, 2, 3, 4));
+}
+
+TEST(ParallelFor, Threaded) {
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(4, &pool));
+  FunctionContext ctx(default_memory_pool(), pool.get());
+
+  std::vector<int> seen(100, 0);
+  std::atomic<int> count(0);
+  ASSERT_OK(ParallelFor(&ctx, 100, [&](FunctionContext* task_ctx, int i) {
+    EXPECT_NE(&ctx, task_ctx);
+    EXPECT_EQ(nullptr, task_ctx->thread_pool());
+    EXPECT_EQ(ctx.memory_pool(), task_ctx->memory_pool());
+    seen[i]++;
+    count++;
+    return Status::OK();
+  }));
+  ASSERT_EQ(100, count.load());
+  ASSERT_THAT(seen, Each(Eq(1)));
+}
+
+TEST(ParallelFor, Errors) {
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(4, &pool));
+  FunctionContext ctx(default_memory_pool(), pool.get());
+
+  ASSERT_RAISES(Invalid, ParallelFor(&ctx, 10, [](FunctionContext*, int i) {
+    return i == 7 ? Status::Invalid("task failed") : Status::OK();
+  }));
+  // Errors set on the task context are returned as well
+  ASSERT_RAISES(IOError, ParallelFor(&ctx, 10, [](FunctionContext* task_ctx, int i) {
+    if (i == 3) task_ctx->SetStatus(Status::IOError("task failed"));
+    return Status::OK();
+  }));
+  ASSERT_FALSE(ctx.HasError());
+}
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
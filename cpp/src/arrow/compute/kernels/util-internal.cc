@@ -29,6 +29,7 @@
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/task-group.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -97,6 +98,44 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
   return Status::OK();
 }
 
+Status ParallelFor(FunctionContext* ctx, int num_tasks,
+                   const std::function<Status(FunctionContext*, int)>& func) {
+  if (ctx->thread_pool() == nullptr || num_tasks <= 1) {
+    for (int i = 0; i < num_tasks; i++) {
+      RETURN_NOT_OK(func(ctx, i));
+    }
+    return Status::OK();
+  }
+
+  auto task_group = internal::TaskGroup::MakeThreaded(ctx->thread_pool());
+  for (int i = 0; i < num_tasks; i++) {
+    task_group->Append([ctx, &func, i]() {
+      FunctionContext task_ctx(ctx->memory_pool());
+      RETURN_NOT_OK(func(&task_ctx, i));
+      return task_ctx.status();
+    });
+  }
+  return task_group->Finish();
+}
+
+Status ParallelInvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
+                                      const Datum& value, std::vector<Datum>* outputs) {
+  if (value.kind() != Datum::CHUNKED_ARRAY) {
+    return InvokeUnaryArrayKernel(ctx, kernel, value, outputs);
+  }
+  const ChunkedArray& array = *value.chunked_array();
+  std::vector<Datum> results(array.num_chunks());
+  RETURN_NOT_OK(
+      ParallelFor(ctx, array.num_chunks(), [&](FunctionContext* task_ctx, int i) {
+        results[i].value = ArrayData::Make(kernel->out_type(), array.chunk(i)->length());
+        return kernel->Call(task_ctx, array.chunk(i), &results[i]);
+      }));
+  for (const Datum& result : results) {
+    outputs->push_back(result);
+  }
+  return Status::OK();
+}
+
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right,
                                std::vector<Datum>* outputs) {
@@ -280,6 +319,27 @@ Status AssignNullIntersection(FunctionContext* ctx, const ArrayData& left,
   return Status::OK();
 }
 
+Status PrepareOutput(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                     int64_t length, bool reuse_output, Datum* out) {
+  std::shared_ptr<Buffer> values;
+  if (reuse_output && out->kind() == Datum::ARRAY) {
+    const ArrayData& previous = *out->array();
+    if (previous.type && previous.type->Equals(*type) && previous.length == length &&
+        previous.offset == 0 && previous.buffers.size() == 2 && previous.buffers[1] &&
+        previous.buffers[1]->is_mutable()) {
+      values = previous.buffers[1];
+    }
+  }
+  if (values == nullptr) {
+    RETURN_NOT_OK(AllocateValueBuffer(ctx, *type, length, &values));
+  }
+
+  // A new ArrayData is made so that Array instances wrapping the previous one
+  // do not see their validity bitmap change.
+  out->value = ArrayData::Make(type, length, {nullptr, values}, 0);
+  return Status::OK();
+}
+
 Status PrimitiveAllocatingUnaryKernel::Call(FunctionContext* ctx, const Datum& input,
                                             Datum* out) {
   std::vector<std::shared_ptr<Buffer>> data_buffers;
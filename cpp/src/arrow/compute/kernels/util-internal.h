@@ -18,7 +18,10 @@
 #ifndef ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 #define ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 
+#include <functional>
+#include <limits>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "arrow/array.h"
@@ -42,6 +45,26 @@ static inline void ZeroCopyData(const ArrayData& input, ArrayData* output) {
   output->child_data = input.child_data;
 }
 
+// Identity elements of the min and max reductions. Floating point types use
+// infinities so that an all-NaN input stays at the identity, which is how
+// NaNs end up ignored: any comparison with NaN is false.
+template <typename CType, typename Enable = void>
+struct MinMaxBounds {
+  static constexpr CType min_identity() { return std::numeric_limits<CType>::max(); }
+  static constexpr CType max_identity() { return std::numeric_limits<CType>::lowest(); }
+};
+
+template <typename CType>
+struct MinMaxBounds<CType,
+                    typename std::enable_if<std::is_floating_point<CType>::value>::type> {
+  static constexpr CType min_identity() {
+    return std::numeric_limits<CType>::infinity();
+  }
+  static constexpr CType max_identity() {
+    return -std::numeric_limits<CType>::infinity();
+  }
+};
+
 namespace detail {
 
 /// \brief Invoke the kernel on value using the ctx and store results in outputs.
@@ -54,6 +77,26 @@ ARROW_EXPORT
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
                               const Datum& value, std::vector<Datum>* outputs);
 
+/// \brief Execute func(task_ctx, i) for each i in [0, num_tasks).
+///
+/// If ctx has a thread pool and there is more than one task, the tasks run
+/// concurrently on it, each with its own FunctionContext sharing the memory
+/// pool of ctx (and without thread pool, so that tasks do not wait on each
+/// other). An error status set on a task context is returned. Otherwise the
+/// tasks run in order on ctx itself.
+ARROW_EXPORT
+Status ParallelFor(FunctionContext* ctx, int num_tasks,
+                   const std::function<Status(FunctionContext*, int)>& func);
+
+/// \brief Like InvokeUnaryArrayKernel, but the chunks of a ChunkedArray are
+/// processed concurrently if ctx has a thread pool.
+///
+/// The kernel must support concurrent invocations of Call. outputs are in
+/// the order of the chunks.
+ARROW_EXPORT
+Status ParallelInvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
+                                      const Datum& value, std::vector<Datum>* outputs);
+
 ARROW_EXPORT
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right,
@@ -98,6 +141,24 @@ Datum WrapArraysLike(const Datum& value,
 ARROW_EXPORT
 Datum WrapDatumsLike(const Datum& value, const std::vector<Datum>& datums);
 
+/// \brief Make out hold an array of the given fixed-width type and length,
+/// with a values buffer ready to be written to and no validity bitmap.
+///
+/// If reuse_output is true and out already holds an array of the same type
+/// and length, with no offset and a mutable values buffer, that buffer is
+/// reused and its content overwritten. This lets chains of kernels avoid
+/// intermediate allocations, when the caller knows nothing else refers to
+/// the buffer. Otherwise a new values buffer is allocated.
+///
+/// \param[in] ctx the kernel FunctionContext
+/// \param[in] type the output type, must be fixed-width
+/// \param[in] length the output length
+/// \param[in] reuse_output whether the values buffer of out may be reused
+/// \param[in,out] out the output datum
+ARROW_EXPORT
+Status PrepareOutput(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                     int64_t length, bool reuse_output, Datum* out);
+
 /// \brief Kernel used to preallocate outputs for primitive types. This
 /// does not include allocations for the validity bitmap (PropagateNulls
 /// should be used for that).
@@ -0,0 +1,46 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/compute/operations/arithmetic.h"
+
+#include <memory>
+#include <utility>
+
+#include "arrow/compute/expression.h"
+#include "arrow/compute/logical_type.h"
+#include "arrow/compute/operations/util-internal.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace compute {
+namespace ops {
+
+Arithmetic::Arithmetic(Operator op, std::shared_ptr<Expr> left,
+                       std::shared_ptr<Expr> right)
+    : op_(op), left_(std::move(left)), right_(std::move(right)) {}
+
+Status Arithmetic::ToExpr(std::shared_ptr<Expr>* out) const {
+  auto args = input_args();
+  RETURN_NOT_OK(detail::CheckSameValueType("Arithmetic", *type::number(), args));
+  const auto& left = static_cast<const ValueExpr&>(*left_);
+  return detail::GetElementwiseExpr(shared_from_this(), left.type(), args, out);
+}
+
+}  // namespace ops
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/operation.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+namespace ops {
+
+/// \brief Element-wise logical connective of two boolean value expressions
+class ARROW_EXPORT Boolean : public Operation {
+ public:
+  enum Operator { AND, OR, XOR };
+
+  Boolean(Operator op, std::shared_ptr<Expr> left, std::shared_ptr<Expr> right);
+  Status ToExpr(std::shared_ptr<Expr>* out) const override;
+  std::vector<std::shared_ptr<Expr>> input_args() const override {
+    return {left_, right_};
+  }
+
+  Operator op() const { return op_; }
+  const std::shared_ptr<Expr>& left() const { return left_; }
+  const std::shared_ptr<Expr>& right() const { return right_; }
+
+ private:
+  Operator op_;
+  std::shared_ptr<Expr> left_;
+  std::shared_ptr<Expr> right_;
+};
+
+/// \brief Element-wise negation of a boolean value expression
+class ARROW_EXPORT Invert : public Operation {
+ public:
+  explicit Invert(std::shared_ptr<Expr> value);
+  Status ToExpr(std::shared_ptr<Expr>* out) const override;
+  std::vector<std::shared_ptr<Expr>> input_args() const override { return {value_}; }
+
+  const std::shared_ptr<Expr>& value() const { return value_; }
+
+ private:
+  std::shared_ptr<Expr> value_;
+};
+
+}  // namespace ops
+}  // namespace compute
+}  // namespace arrow
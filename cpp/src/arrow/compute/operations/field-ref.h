@@ -0,0 +1,48 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/compute/operation.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Field;
+
+namespace compute {
+namespace ops {
+
+/// \brief A reference to a column of the record batches an expression is
+/// evaluated against, looked up by field name
+class ARROW_EXPORT FieldRef : public Operation {
+ public:
+  explicit FieldRef(const std::shared_ptr<Field>& field);
+  Status ToExpr(std::shared_ptr<Expr>* out) const override;
+
+  const std::shared_ptr<Field>& field() const { return field_; }
+
+ private:
+  std::shared_ptr<Field> field_;
+};
+
+}  // namespace ops
+}  // namespace compute
+}  // namespace arrow
@@ -36,6 +36,8 @@ class ARROW_EXPORT Literal : public Operation {
   explicit Literal(const std::shared_ptr<Scalar>& value);
   Status ToExpr(std::shared_ptr<Expr>* out) const override;
 
+  const std::shared_ptr<Scalar>& value() const { return value_; }
+
  private:
   std::shared_ptr<Scalar> value_;
 };
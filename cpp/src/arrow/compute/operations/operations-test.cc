@@ -32,7 +32,11 @@
 #include "arrow/compute/expression.h"
 #include "arrow/compute/logical_type.h"
 #include "arrow/compute/operation.h"
+#include "arrow/compute/operations/arithmetic.h"
+#include "arrow/compute/operations/boolean.h"
 #include "arrow/compute/operations/cast.h"
+#include "arrow/compute/operations/compare.h"
+#include "arrow/compute/operations/field-ref.h"
 #include "arrow/compute/operations/literal.h"
 
 namespace arrow {
@@ -60,5 +64,65 @@ TEST(Cast, Basics) {
   ASSERT_TRUE(InheritsFrom<array::Float64>(*out_expr));
 }
 
+TEST(FieldRef, Basics) {
+  std::shared_ptr<Expr> expr;
+  ASSERT_OK(std::make_shared<ops::FieldRef>(field("f", int16()))->ToExpr(&expr));
+  ASSERT_TRUE(InheritsFrom<array::Int16>(*expr));
+}
+
+TEST(Arithmetic, Basics) {
+  auto dummy_op = std::make_shared<DummyOp>();
+  std::shared_ptr<Expr> out_expr;
+  ASSERT_OK(std::make_shared<ops::Arithmetic>(ops::Arithmetic::ADD,
+                                              array::int32(dummy_op),
+                                              scalar::int32(dummy_op))
+                ->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<array::Int32>(*out_expr));
+
+  ASSERT_OK(std::make_shared<ops::Arithmetic>(ops::Arithmetic::DIVIDE,
+                                              scalar::float64(dummy_op),
+                                              scalar::float64(dummy_op))
+                ->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<scalar::Float64>(*out_expr));
+
+  ASSERT_RAISES(Invalid, std::make_shared<ops::Arithmetic>(ops::Arithmetic::ADD,
+                                                           array::int32(dummy_op),
+                                                           array::int64(dummy_op))
+                             ->ToExpr(&out_expr));
+  ASSERT_RAISES(Invalid, std::make_shared<ops::Arithmetic>(ops::Arithmetic::ADD,
+                                                           array::boolean(dummy_op),
+                                                           array::boolean(dummy_op))
+                             ->ToExpr(&out_expr));
+}
+
+TEST(Compare, Basics) {
+  auto dummy_op = std::make_shared<DummyOp>();
+  std::shared_ptr<Expr> out_expr;
+  ASSERT_OK(std::make_shared<ops::Compare>(CompareOperator::LESS,
+                                           scalar::utf8(dummy_op), array::utf8(dummy_op))
+                ->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<array::Bool>(*out_expr));
+
+  ASSERT_RAISES(Invalid,
+                std::make_shared<ops::Compare>(CompareOperator::EQUAL,
+                                               array::int8(dummy_op),
+                                               array::uint8(dummy_op))
+                    ->ToExpr(&out_expr));
+}
+
+TEST(Boolean, Basics) {
+  auto dummy_op = std::make_shared<DummyOp>();
+  std::shared_ptr<Expr> out_expr;
+  ASSERT_OK(std::make_shared<ops::Boolean>(ops::Boolean::AND, array::boolean(dummy_op),
+                                           array::boolean(dummy_op))
+                ->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<array::Bool>(*out_expr));
+  ASSERT_OK(std::make_shared<ops::Invert>(scalar::boolean(dummy_op))->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<scalar::Bool>(*out_expr));
+
+  ASSERT_RAISES(Invalid,
+                std::make_shared<ops::Invert>(array::int32(dummy_op))->ToExpr(&out_expr));
+}
+
 }  // namespace compute
 }  // namespace arrow
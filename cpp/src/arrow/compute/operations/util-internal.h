@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/expression.h"
+#include "arrow/compute/logical_type.h"
+#include "arrow/compute/operation.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace compute {
+namespace ops {
+namespace detail {
+
+/// \brief Return an array expression if any of the arguments is an array
+/// expression, otherwise a scalar expression
+inline Status GetElementwiseExpr(ConstOpPtr op, LogicalTypePtr ty,
+                                 const std::vector<ExprPtr>& args, ExprPtr* out) {
+  for (const auto& arg : args) {
+    if (static_cast<const ValueExpr&>(*arg).rank() == ValueRank::ARRAY) {
+      return GetArrayExpr(op, ty, out);
+    }
+  }
+  return GetScalarExpr(op, ty, out);
+}
+
+/// \brief Check that all arguments are value expressions of the same concrete
+/// type, an instance of type_class
+inline Status CheckSameValueType(const char* op_name, const LogicalType& type_class,
+                                 const std::vector<ExprPtr>& args) {
+  for (const auto& arg : args) {
+    if (!type_class.IsInstance(*arg)) {
+      return Status::Invalid(op_name, " only applies to ", type_class.ToString(),
+                             " value expressions");
+    }
+  }
+  const auto& first = static_cast<const ValueExpr&>(*args[0]);
+  for (const auto& arg : args) {
+    const auto& value = static_cast<const ValueExpr&>(*arg);
+    if (value.type()->id() != first.type()->id()) {
+      return Status::Invalid(op_name, " operands must have the same type, got ",
+                             first.type()->ToString(), " and ",
+                             value.type()->ToString());
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace detail
+}  // namespace ops
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/selection-vector.h"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+Status MakeSelection(const std::shared_ptr<ResizableBuffer>& buffer, int64_t length,
+                     int64_t array_length, std::shared_ptr<SelectionVector>* out) {
+  RETURN_NOT_OK(buffer->Resize(length * sizeof(int32_t)));
+  auto indices = std::make_shared<Int32Array>(length, buffer);
+  *out = std::make_shared<SelectionVector>(indices, array_length);
+  return Status::OK();
+}
+
+}  // namespace
+
+SelectionVector::SelectionVector(const std::shared_ptr<Array>& indices,
+                                 int64_t array_length)
+    : indices_(indices), array_length_(array_length) {
+  DCHECK_EQ(Type::INT32, indices->type_id());
+  raw_indices_ = checked_cast<const Int32Array&>(*indices).raw_values();
+}
+
+Status SelectionVector::FromMask(MemoryPool* pool, const Array& mask,
+                                 std::shared_ptr<SelectionVector>* out) {
+  if (mask.type_id() != Type::BOOL) {
+    return Status::Invalid("Selection mask must be boolean, got ", *mask.type());
+  }
+  const int64_t length = mask.length();
+  if (length > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Selection mask longer than 2^31 - 1");
+  }
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(pool, length * sizeof(int32_t), &buffer));
+  auto indices = reinterpret_cast<int32_t*>(buffer->mutable_data());
+
+  const auto& booleans = checked_cast<const BooleanArray&>(mask);
+  const uint8_t* values = booleans.values()->data();
+  const uint8_t* validity = booleans.null_bitmap_data();
+  const int64_t offset = booleans.offset();
+
+  // Branchless: always write the position, only advance past selected slots.
+  int64_t selected = 0;
+  if (validity == nullptr || booleans.null_count() == 0) {
+    for (int64_t i = 0; i < length; ++i) {
+      indices[selected] = static_cast<int32_t>(i);
+      selected += BitUtil::GetBit(values, offset + i);
+    }
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      indices[selected] = static_cast<int32_t>(i);
+      selected +=
+          BitUtil::GetBit(values, offset + i) & BitUtil::GetBit(validity, offset + i);
+    }
+  }
+  return MakeSelection(buffer, selected, length, out);
+}
+
+Status SelectionVector::All(MemoryPool* pool, int64_t array_length,
+                            std::shared_ptr<SelectionVector>* out) {
+  if (array_length > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Selection longer than 2^31 - 1");
+  }
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(pool, array_length * sizeof(int32_t), &buffer));
+  auto indices = reinterpret_cast<int32_t*>(buffer->mutable_data());
+  for (int64_t i = 0; i < array_length; ++i) {
+    indices[i] = static_cast<int32_t>(i);
+  }
+  return MakeSelection(buffer, array_length, array_length, out);
+}
+
+Status SelectionVector::ToMask(MemoryPool* pool, std::shared_ptr<Array>* out) const {
+  std::shared_ptr<Buffer> bitmap;
+  RETURN_NOT_OK(AllocateEmptyBitmap(pool, array_length_, &bitmap));
+  uint8_t* bits = bitmap->mutable_data();
+  for (int64_t i = 0; i < length(); ++i) {
+    BitUtil::SetBit(bits, raw_indices_[i]);
+  }
+  *out = std::make_shared<BooleanArray>(array_length_, bitmap);
+  return Status::OK();
+}
+
+Status SelectionVector::Validate() const {
+  if (indices_->null_count() != 0) {
+    return Status::Invalid("Selection positions must not be null");
+  }
+  int64_t previous = -1;
+  for (int64_t i = 0; i < length(); ++i) {
+    const int64_t index = raw_indices_[i];
+    if (index <= previous || index >= array_length_) {
+      return Status::Invalid("Selection position ", index, " at ", i,
+                             " is out of order or out of bounds");
+    }
+    previous = index;
+  }
+  return Status::OK();
+}
+
+bool SelectionVector::Equals(const SelectionVector& other) const {
+  return array_length_ == other.array_length_ && length() == other.length() &&
+         (length() == 0 || std::memcmp(raw_indices_, other.raw_indices_,
+                                       length() * sizeof(int32_t)) == 0);
+}
+
+}  // namespace compute
+}  // namespace arrow
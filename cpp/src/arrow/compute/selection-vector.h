@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/array.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class MemoryPool;
+
+namespace compute {
+
+/// \class SelectionVector
+/// \brief The positions of the selected slots of an array
+///
+/// A SelectionVector is the compact result of a filter: the strictly
+/// increasing, non-null Int32 positions of the selected slots of an array of
+/// a given length. Kernels accepting a SelectionVector only visit these
+/// slots, so that a filter followed by aggregations or projections does not
+/// materialize the filtered columns.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT SelectionVector {
+ public:
+  /// \brief Wrap existing positions
+  ///
+  /// \param[in] indices Int32Array of positions, see Validate()
+  /// \param[in] array_length length of the array the positions refer to
+  SelectionVector(const std::shared_ptr<Array>& indices, int64_t array_length);
+
+  /// \brief Select the slots of a boolean mask which are true and non-null
+  static Status FromMask(MemoryPool* pool, const Array& mask,
+                         std::shared_ptr<SelectionVector>* out);
+
+  /// \brief Select all the slots of an array of the given length
+  static Status All(MemoryPool* pool, int64_t array_length,
+                    std::shared_ptr<SelectionVector>* out);
+
+  /// \brief Expand to a boolean mask of length array_length, without nulls
+  Status ToMask(MemoryPool* pool, std::shared_ptr<Array>* out) const;
+
+  /// \brief Check the positions are non-null, strictly increasing and in
+  /// [0, array_length)
+  Status Validate() const;
+
+  bool Equals(const SelectionVector& other) const;
+
+  /// \brief The number of selected slots
+  int64_t length() const { return indices_->length(); }
+
+  /// \brief The length of the array the positions refer to
+  int64_t array_length() const { return array_length_; }
+
+  /// \brief The positions, as an Int32Array
+  const std::shared_ptr<Array>& indices() const { return indices_; }
+
+  const int32_t* raw_indices() const { return raw_indices_; }
+
+ private:
+  std::shared_ptr<Array> indices_;
+  const int32_t* raw_indices_;
+  int64_t array_length_;
+};
+
+}  // namespace compute
+}  // namespace arrow
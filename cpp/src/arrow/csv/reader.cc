@@ -129,6 +129,13 @@ class BaseTableReader : public csv::TableReader {
     cur_block_ = new_block;
     cur_data_ = new_data;
     cur_size_ = new_size;
+
+    // The previous block can now be reused for reading ahead, unless a
+    // parsing task still holds it
+    if (readahead_block_) {
+      readahead_->Recycle({std::move(readahead_block_), 0, 0});
+    }
+    readahead_block_ = std::move(rh.buffer);
     return Status::OK();
   }
 
@@ -222,6 +229,8 @@ class BaseTableReader : public csv::TableReader {
 
   // Current block and data pointer
   std::shared_ptr<Buffer> cur_block_;
+  // The buffer the current block was read into, to give back to readahead_
+  std::shared_ptr<ResizableBuffer> readahead_block_;
   const uint8_t* cur_data_ = nullptr;
   int64_t cur_size_ = 0;
   // Index of current block inside data stream
@@ -308,11 +317,12 @@ class ThreadedTableReader : public BaseTableReader {
                       const ConvertOptions& convert_options)
       : BaseTableReader(pool, read_options, parse_options, convert_options),
         thread_pool_(thread_pool) {
-    // Readahead one block per worker thread
+    // Readahead one block per worker thread, reading them concurrently if
+    // the input supports it
     int32_t block_queue_size = thread_pool->GetCapacity();
     readahead_ = std::make_shared<ReadaheadSpooler>(
         pool_, input, read_options_.block_size, block_queue_size, kDefaultLeftPadding,
-        kDefaultRightPadding);
+        kDefaultRightPadding, block_queue_size /* max_concurrent_reads */);
   }
 
   ~ThreadedTableReader() {
@@ -19,16 +19,21 @@
 #include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/future.h"
 #include "arrow/util/io-util.h"
 
 #include "benchmark/benchmark.h"
 
 #include <algorithm>
 #include <atomic>
+#include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <random>
+#include <string>
 #include <thread>
 #include <valarray>
+#include <vector>
 
 #ifndef _WIN32
 
@@ -250,6 +255,121 @@ BENCHMARK(BM_BufferedOutputStreamLargeWritesToPipe)
     ->MinTime(1.0)
     ->UseRealTime();
 
+// Benchmark many small random reads from a file in the page cache, as issued
+// by scans reading a few columns of many row groups
+
+constexpr int64_t kRandomReadsFileSize = 64 * 1024 * 1024;
+constexpr int64_t kRandomReadSize = 4096;
+constexpr int kRandomReadsPerIteration = 256;
+
+// A data file removed on destruction
+class RandomReadsFile {
+ public:
+  RandomReadsFile() : path_("arrow-io-file-benchmark-random-reads.bin") {
+    std::shared_ptr<io::FileOutputStream> stream;
+    ABORT_NOT_OK(io::FileOutputStream::Open(path_, &stream));
+    const std::string chunk(1024 * 1024, 'x');
+    for (int64_t i = 0; i < kRandomReadsFileSize; i += chunk.size()) {
+      ABORT_NOT_OK(stream->Write(chunk));
+    }
+    ABORT_NOT_OK(stream->Close());
+
+    std::default_random_engine engine(42);
+    std::uniform_int_distribution<int64_t> dist(0,
+                                                kRandomReadsFileSize - kRandomReadSize);
+    for (int i = 0; i < kRandomReadsPerIteration; ++i) {
+      ranges_.push_back({dist(engine), kRandomReadSize});
+    }
+  }
+
+  ~RandomReadsFile() { ARROW_UNUSED(std::remove(path_.c_str())); }
+
+  const std::string& path() const { return path_; }
+  const std::vector<io::ReadRange>& ranges() const { return ranges_; }
+
+ private:
+  std::string path_;
+  std::vector<io::ReadRange> ranges_;
+};
+
+static void SetRandomReadsProcessed(benchmark::State& state) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          kRandomReadsPerIteration * kRandomReadSize);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          kRandomReadsPerIteration);
+}
+
+static void WaitForReads(const std::vector<Future<std::shared_ptr<Buffer>>>& futures) {
+  std::shared_ptr<Buffer> buffer;
+  for (const auto& future : futures) {
+    ABORT_NOT_OK(future.Get(&buffer));
+  }
+}
+
+// One blocking pread() per read
+static void BM_ReadableFileRandomReads(
+    benchmark::State& state) {  // NOLINT non-const reference
+  RandomReadsFile data_file;
+  std::shared_ptr<io::ReadableFile> file;
+  ABORT_NOT_OK(io::ReadableFile::Open(data_file.path(), &file));
+
+  std::shared_ptr<Buffer> buffer;
+  while (state.KeepRunning()) {
+    for (const auto& range : data_file.ranges()) {
+      ABORT_NOT_OK(file->ReadAt(range.offset, range.length, &buffer));
+    }
+  }
+  SetRandomReadsProcessed(state);
+}
+
+// Concurrent reads on the shared I/O thread pool
+static void BM_ReadableFileRandomReadsAsync(
+    benchmark::State& state) {  // NOLINT non-const reference
+  RandomReadsFile data_file;
+  std::shared_ptr<io::ReadableFile> file;
+  ABORT_NOT_OK(io::ReadableFile::Open(data_file.path(), &file));
+
+  while (state.KeepRunning()) {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    for (const auto& range : data_file.ranges()) {
+      futures.push_back(file->ReadAtAsync(range.offset, range.length));
+    }
+    WaitForReads(futures);
+  }
+  SetRandomReadsProcessed(state);
+}
+
+static void BM_AsyncReadableFileRandomReads(
+    benchmark::State& state,  // NOLINT non-const reference
+    io::AsyncReadBackend::type backend) {
+  RandomReadsFile data_file;
+  auto options = io::AsyncReadOptions::Defaults();
+  options.backend = backend;
+  std::shared_ptr<io::AsyncReadableFile> file;
+  Status st = io::AsyncReadableFile::Open(data_file.path(), options,
+                                          default_memory_pool(), &file);
+  if (!st.ok()) {
+    state.SkipWithError(st.ToString().c_str());
+    return;
+  }
+
+  while (state.KeepRunning()) {
+    WaitForReads(file->SubmitReads(data_file.ranges()));
+  }
+  SetRandomReadsProcessed(state);
+}
+
+BENCHMARK(BM_ReadableFileRandomReads)->MinTime(1.0)->UseRealTime();
+BENCHMARK(BM_ReadableFileRandomReadsAsync)->MinTime(1.0)->UseRealTime();
+BENCHMARK_CAPTURE(BM_AsyncReadableFileRandomReads, ThreadPool,
+                  io::AsyncReadBackend::THREAD_POOL)
+    ->MinTime(1.0)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_AsyncReadableFileRandomReads, IoUring,
+                  io::AsyncReadBackend::IO_URING)
+    ->MinTime(1.0)
+    ->UseRealTime();
+
 #endif  // ifndef _WIN32
 
 }  // namespace arrow
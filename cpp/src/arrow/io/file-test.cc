@@ -20,6 +20,7 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <cstdio>
@@ -40,6 +41,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/future.h"
 #include "arrow/util/io-util.h"
 
 namespace arrow {
@@ -435,6 +437,33 @@ TEST_F(TestReadableFile, ReadAt) {
   ASSERT_TRUE(buffer2->Equals(expected));
 }
 
+TEST_F(TestReadableFile, ReadRanges) {
+  MakeTestFile();
+  OpenFile();
+
+  auto options = ReadRangeOptions::Defaults();
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(file_->ReadRanges({{4, 4}, {0, 4}, {2, 0}, {6, 10}}, options, &buffers));
+  ASSERT_EQ(4, buffers.size());
+  AssertBufferEqual(*buffers[0], "data");
+  AssertBufferEqual(*buffers[1], "test");
+  AssertBufferEqual(*buffers[2], "");
+  // Truncated at the end of the file
+  AssertBufferEqual(*buffers[3], "ta");
+
+  // No coalescing, and ranges split into several concurrent reads
+  options.hole_size_limit = 0;
+  options.range_size_limit = 3;
+  ASSERT_OK(file_->ReadRanges({{1, 7}, {0, 2}, {5, 20}}, options, &buffers));
+  ASSERT_EQ(3, buffers.size());
+  AssertBufferEqual(*buffers[0], "estdata");
+  AssertBufferEqual(*buffers[1], "te");
+  AssertBufferEqual(*buffers[2], "ata");
+
+  ASSERT_RAISES(Invalid, file_->ReadRanges({{-1, 2}}, &buffers));
+  ASSERT_RAISES(Invalid, file_->ReadRanges({{0, -2}}, &buffers));
+}
+
 TEST_F(TestReadableFile, NonExistentFile) {
   std::string path = "0xDEADBEEF.txt";
   Status s = ReadableFile::Open(path, &file_);
@@ -522,6 +551,188 @@ TEST_F(TestReadableFile, ThreadSafety) {
   ASSERT_EQ(niter * 2, correct_count);
 }
 
+// ----------------------------------------------------------------------
+// AsyncReadableFile tests
+
+class TestAsyncReadableFile
+    : public FileTestFixture,
+      public ::testing::WithParamInterface<AsyncReadBackend::type> {
+ public:
+  void MakeTestFile(int64_t size) {
+    data_.resize(size);
+    random_bytes(size, 42, reinterpret_cast<uint8_t*>(&data_[0]));
+    std::ofstream stream(path_.c_str(), std::ios::binary);
+    stream << data_;
+  }
+
+  void OpenFile(int32_t queue_depth = 128) {
+    auto options = AsyncReadOptions::Defaults();
+    options.backend = GetParam();
+    options.queue_depth = queue_depth;
+    Status st = AsyncReadableFile::Open(path_, options, default_memory_pool(), &file_);
+    if (GetParam() == AsyncReadBackend::IO_URING &&
+        (st.IsNotImplemented() || st.IsIOError())) {
+      // Not built with io_uring, or the kernel doesn't allow it
+      skip_ = true;
+      return;
+    }
+    ASSERT_OK(st);
+    ASSERT_EQ(GetParam(), file_->backend());
+  }
+
+  // Check the buffer holds the file contents at the given range
+  void AssertFileRange(const Buffer& buffer, int64_t position, int64_t nbytes) {
+    const int64_t size = static_cast<int64_t>(data_.size());
+    const int64_t expected_size = std::max<int64_t>(0, std::min(nbytes, size - position));
+    ASSERT_EQ(expected_size, buffer.size());
+    Buffer expected(reinterpret_cast<const uint8_t*>(data_.data()) + position,
+                    expected_size);
+    ASSERT_TRUE(buffer.Equals(expected));
+  }
+
+  void AssertReadResult(const Future<std::shared_ptr<Buffer>>& future, int64_t position,
+                        int64_t nbytes) {
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(future.Get(&buffer));
+    AssertFileRange(*buffer, position, nbytes);
+  }
+
+ protected:
+  std::string data_;
+  std::shared_ptr<AsyncReadableFile> file_;
+  bool skip_ = false;
+};
+
+TEST_P(TestAsyncReadableFile, ReadAtAsync) {
+  MakeTestFile(1000);
+  OpenFile();
+  if (skip_) {
+    return;
+  }
+  auto fut1 = file_->ReadAtAsync(10, 100);
+  auto fut2 = file_->ReadAtAsync(0, 1000);
+  // Truncated at the end of the file
+  auto fut3 = file_->ReadAtAsync(950, 100);
+  auto fut4 = file_->ReadAtAsync(2000, 10);
+  auto fut5 = file_->ReadAtAsync(5, 0);
+  AssertReadResult(fut1, 10, 100);
+  AssertReadResult(fut2, 0, 1000);
+  AssertReadResult(fut3, 950, 100);
+  AssertReadResult(fut4, 2000, 10);
+  AssertReadResult(fut5, 5, 0);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_RAISES(Invalid, file_->ReadAtAsync(-1, 10).Get(&buffer));
+  ASSERT_RAISES(Invalid, file_->ReadAtAsync(0, -10).Get(&buffer));
+
+  // Synchronous reads still work
+  ASSERT_OK(file_->ReadAt(100, 50, &buffer));
+  AssertFileRange(*buffer, 100, 50);
+  ASSERT_OK(file_->Read(20, &buffer));
+  AssertFileRange(*buffer, 0, 20);
+}
+
+TEST_P(TestAsyncReadableFile, SubmitReads) {
+  const int64_t size = 1 << 16;
+  MakeTestFile(size);
+  // More reads than the queue depth
+  OpenFile(4);
+  if (skip_) {
+    return;
+  }
+  std::vector<ReadRange> ranges;
+  for (int64_t i = 0; i < 200; ++i) {
+    ranges.push_back({(i * 7919) % size, i * 13});
+  }
+  ranges.push_back({-1, 1});
+  auto futures = file_->SubmitReads(ranges);
+  ASSERT_EQ(ranges.size(), futures.size());
+  for (size_t i = 0; i + 1 < ranges.size(); ++i) {
+    AssertReadResult(futures[i], ranges[i].offset, ranges[i].length);
+  }
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_RAISES(Invalid, futures.back().Get(&buffer));
+
+  // Concurrent submissions
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&]() {
+      auto thread_futures = file_->SubmitReads(
+          std::vector<ReadRange>(ranges.begin(), ranges.end() - 1));
+      for (size_t j = 0; j < thread_futures.size(); ++j) {
+        AssertReadResult(thread_futures[j], ranges[j].offset, ranges[j].length);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+TEST_P(TestAsyncReadableFile, ReadRanges) {
+  MakeTestFile(1000);
+  OpenFile();
+  if (skip_) {
+    return;
+  }
+  auto options = ReadRangeOptions::Defaults();
+  options.hole_size_limit = 0;
+  options.range_size_limit = 64;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(file_->ReadRanges({{500, 300}, {0, 10}, {990, 20}}, options, &buffers));
+  ASSERT_EQ(3, buffers.size());
+  AssertFileRange(*buffers[0], 500, 300);
+  AssertFileRange(*buffers[1], 0, 10);
+  AssertFileRange(*buffers[2], 990, 10);
+}
+
+TEST_P(TestAsyncReadableFile, Close) {
+  MakeTestFile(1 << 16);
+  OpenFile(4);
+  if (skip_) {
+    return;
+  }
+  const int fd = file_->file_descriptor();
+  std::vector<ReadRange> ranges(100, {100, 1000});
+  auto futures = file_->SubmitReads(ranges);
+
+  // Pending reads are finished before closing
+  ASSERT_OK(file_->Close());
+  ASSERT_TRUE(file_->closed());
+  ASSERT_TRUE(FileIsClosed(fd));
+  for (const auto& future : futures) {
+    AssertReadResult(future, 100, 1000);
+  }
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_RAISES(IOError, file_->ReadAtAsync(0, 10).Get(&buffer));
+  // Idempotent
+  ASSERT_OK(file_->Close());
+}
+
+INSTANTIATE_TEST_CASE_P(TestThreadPoolAsyncReadableFile, TestAsyncReadableFile,
+                        ::testing::Values(AsyncReadBackend::THREAD_POOL));
+INSTANTIATE_TEST_CASE_P(TestIoUringAsyncReadableFile, TestAsyncReadableFile,
+                        ::testing::Values(AsyncReadBackend::IO_URING));
+
+TEST_F(FileTestFixture, AsyncReadableFileAutoBackend) {
+  {
+    std::ofstream stream(path_.c_str());
+    stream << "testdata";
+  }
+  std::shared_ptr<AsyncReadableFile> file;
+  ASSERT_OK(AsyncReadableFile::Open(path_, &file));
+  ASSERT_NE(AsyncReadBackend::AUTO, file->backend());
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->ReadAtAsync(4, 4).Get(&buffer));
+  AssertBufferEqual(*buffer, "data");
+
+  auto options = AsyncReadOptions::Defaults();
+  options.queue_depth = 0;
+  ASSERT_RAISES(Invalid,
+                AsyncReadableFile::Open(path_, options, default_memory_pool(), &file));
+}
+
 // ----------------------------------------------------------------------
 // Pipe I/O tests using FileOutputStream
 // (cannot test using ReadableFile as it currently requires seeking)
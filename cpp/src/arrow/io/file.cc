@@ -30,14 +30,27 @@
 #include <unistd.h>  // IWYU pragma: keep
 #endif
 
+#ifdef ARROW_WITH_IO_URING
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
 #include <algorithm>
 #include <cerrno>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 // ----------------------------------------------------------------------
 // Other Arrow includes
@@ -48,8 +61,10 @@
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/io-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace io {
@@ -185,12 +200,10 @@ class OSFile {
 // ----------------------------------------------------------------------
 // ReadableFile implementation
 
-class ReadableFile::ReadableFileImpl : public OSFile {
+// An OS file opened for reading, allocating buffers from a memory pool
+class ReadableOSFile : public OSFile {
  public:
-  explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
-
-  Status Open(const std::string& path) { return OpenReadable(path); }
-  Status Open(int fd) { return OpenReadable(fd); }
+  explicit ReadableOSFile(MemoryPool* pool) : OSFile(), pool_(pool) {}
 
   Status ReadBuffer(int64_t nbytes, std::shared_ptr<Buffer>* out) {
     std::shared_ptr<ResizableBuffer> buffer;
@@ -220,10 +233,18 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return Status::OK();
   }
 
- private:
+ protected:
   MemoryPool* pool_;
 };
 
+class ReadableFile::ReadableFileImpl : public ReadableOSFile {
+ public:
+  explicit ReadableFileImpl(MemoryPool* pool) : ReadableOSFile(pool) {}
+
+  Status Open(const std::string& path) { return OpenReadable(path); }
+  Status Open(int fd) { return OpenReadable(fd); }
+};
+
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
 
 ReadableFile::~ReadableFile() { DCHECK_OK(impl_->Close()); }
@@ -283,6 +304,599 @@ Status ReadableFile::Seek(int64_t pos) { return impl_->Seek(pos); }
 
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
+// ----------------------------------------------------------------------
+// AsyncReadableFile implementation
+
+AsyncReadOptions AsyncReadOptions::Defaults() { return AsyncReadOptions(); }
+
+namespace {
+
+using BufferPtr = std::shared_ptr<Buffer>;
+
+// A pending asynchronous read
+struct AsyncReadRequest {
+  int64_t position;
+  int64_t nbytes;
+  int64_t bytes_read = 0;
+  std::shared_ptr<ResizableBuffer> buffer;
+  Future<BufferPtr> future = Future<BufferPtr>::Make();
+#ifdef ARROW_WITH_IO_URING
+  struct iovec iov;
+#endif
+
+  // Read the bytes not read yet with blocking pread() calls
+  Status ReadRemaining(int fd) {
+    int64_t nbytes_read = 0;
+    RETURN_NOT_OK(internal::FileReadAt(fd, buffer->mutable_data() + bytes_read,
+                                       position + bytes_read, nbytes - bytes_read,
+                                       &nbytes_read));
+    bytes_read += nbytes_read;
+    return Status::OK();
+  }
+
+  void Finish(Status st) {
+    if (st.ok() && bytes_read < nbytes) {
+      st = buffer->Resize(bytes_read);
+      buffer->ZeroPadding();
+    }
+    if (st.ok()) {
+      future.MarkFinished(std::move(st), std::move(buffer));
+    } else {
+      future.MarkFinished(std::move(st));
+    }
+  }
+};
+
+using AsyncReadRequests = std::vector<std::unique_ptr<AsyncReadRequest>>;
+
+Status ClosedFileError() { return Status::IOError("File is closed"); }
+
+// Executes the asynchronous reads of an AsyncReadableFile
+class AsyncReader {
+ public:
+  virtual ~AsyncReader() = default;
+
+  // Start the given reads, their futures are finished on completion
+  virtual void Submit(AsyncReadRequests requests) = 0;
+
+  // Wait for pending reads, later submissions fail
+  virtual Status Stop() = 0;
+};
+
+class ThreadPoolReader : public AsyncReader {
+ public:
+  static Status Make(int fd, int32_t num_threads, std::unique_ptr<AsyncReader>* out) {
+    std::shared_ptr<internal::ThreadPool> pool;
+    RETURN_NOT_OK(internal::ThreadPool::Make(num_threads, &pool));
+    out->reset(new ThreadPoolReader(fd, std::move(pool)));
+    return Status::OK();
+  }
+
+  void Submit(AsyncReadRequests requests) override {
+    const int fd = fd_;
+    for (auto& request : requests) {
+      // std::function must be copyable, so the task owns a raw pointer
+      AsyncReadRequest* raw_request = request.release();
+      Status st = pool_->Spawn([fd, raw_request]() {
+        std::unique_ptr<AsyncReadRequest> owned_request(raw_request);
+        owned_request->Finish(owned_request->ReadRemaining(fd));
+      });
+      if (!st.ok()) {
+        // The pool was shut down by Stop()
+        std::unique_ptr<AsyncReadRequest> owned_request(raw_request);
+        owned_request->Finish(ClosedFileError());
+      }
+    }
+  }
+
+  Status Stop() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      return Status::OK();
+    }
+    stopped_ = true;
+    return pool_->Shutdown();
+  }
+
+ private:
+  ThreadPoolReader(int fd, std::shared_ptr<internal::ThreadPool> pool)
+      : fd_(fd), pool_(std::move(pool)) {}
+
+  const int fd_;
+  std::shared_ptr<internal::ThreadPool> pool_;
+  std::mutex mutex_;
+  bool stopped_ = false;
+};
+
+#ifdef ARROW_WITH_IO_URING
+
+int IoUringSetup(uint32_t entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, uint32_t to_submit, uint32_t min_complete,
+                 uint32_t flags) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+template <typename T>
+T* RingPointer(void* ring, uint32_t offset) {
+  return reinterpret_cast<T*>(reinterpret_cast<uint8_t*>(ring) + offset);
+}
+
+// Reads submitted to an io_uring instance through the raw system calls
+// (liburing isn't required).  A dedicated thread reaps the completions,
+// polling the ring and an eventfd that Stop() signals.
+//
+// The number of reads in flight is bounded by the submission queue size,
+// which is smaller than the completion queue: completions never overflow.
+class IoUringReader : public AsyncReader {
+ public:
+  ~IoUringReader() override {
+    if (reaper_.joinable()) {
+      ARROW_UNUSED(Stop());
+    }
+    if (wake_fd_ >= 0) {
+      ARROW_UNUSED(internal::FileClose(wake_fd_));
+    }
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != nullptr) {
+      munmap(sq_ring_, sq_ring_size_);
+    }
+    if (ring_fd_ >= 0) {
+      ARROW_UNUSED(internal::FileClose(ring_fd_));
+    }
+  }
+
+  static Status Make(int fd, int32_t queue_depth, std::unique_ptr<AsyncReader>* out) {
+    std::unique_ptr<IoUringReader> reader(new IoUringReader(fd));
+    RETURN_NOT_OK(reader->Init(queue_depth));
+    *out = std::move(reader);
+    return Status::OK();
+  }
+
+  void Submit(AsyncReadRequests requests) override {
+    size_t next = 0;
+    while (next < requests.size()) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!stopped_ && in_flight_ == sq_entries_ &&
+          std::this_thread::get_id() == reaper_.get_id()) {
+        // A continuation executed by the reaper thread can't wait for a slot
+        lock.unlock();
+        for (; next < requests.size(); ++next) {
+          requests[next]->Finish(requests[next]->ReadRemaining(fd_));
+        }
+        return;
+      }
+      slot_available_.wait(lock,
+                           [this]() { return stopped_ || in_flight_ < sq_entries_; });
+      if (stopped_) {
+        const Status st = reaper_status_.ok() ? ClosedFileError() : reaper_status_;
+        lock.unlock();
+        for (; next < requests.size(); ++next) {
+          requests[next]->Finish(st);
+        }
+        return;
+      }
+
+      const uint32_t count = static_cast<uint32_t>(
+          std::min<size_t>(requests.size() - next, sq_entries_ - in_flight_));
+      uint32_t tail = *sq_tail_;
+      for (uint32_t i = 0; i < count; ++i) {
+        PrepareRead(tail++ & sq_mask_, requests[next + i].get());
+      }
+      __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+
+      Status st;
+      const uint32_t submitted = EnterUnlocked(count, &st);
+      // The reaper thread now owns the submitted requests
+      for (uint32_t i = 0; i < submitted; ++i) {
+        pending_.insert(requests[next + i].release());
+      }
+      in_flight_ += submitted;
+      next += submitted;
+      if (!st.ok()) {
+        // Withdraw the entries the kernel didn't consume and read them
+        // synchronously instead
+        __atomic_store_n(sq_tail_, tail - (count - submitted), __ATOMIC_RELEASE);
+        lock.unlock();
+        for (uint32_t i = submitted; i < count; ++i, ++next) {
+          requests[next]->Finish(requests[next]->ReadRemaining(fd_));
+        }
+      }
+    }
+  }
+
+  Status Stop() override {
+    Status st;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (stop_requested_) {
+        return Status::OK();
+      }
+      stop_requested_ = stopped_ = true;
+      slot_available_.notify_all();
+      all_done_.wait(lock, [this]() { return in_flight_ == 0; });
+      st = reaper_status_;
+    }
+
+    // Writing to an eventfd only fails if its counter overflows, so the
+    // reaper thread (if it didn't exit on error already) always wakes up
+    const uint64_t one = 1;
+    ssize_t ret;
+    do {
+      ret = write(wake_fd_, &one, sizeof(one));
+    } while (ret < 0 && errno == EINTR);
+    DCHECK_EQ(ret, static_cast<ssize_t>(sizeof(one)));
+    reaper_.join();
+    return st;
+  }
+
+ private:
+  explicit IoUringReader(int fd) : fd_(fd) {}
+
+  // Larger reads are continued synchronously, as short reads
+  static constexpr int64_t kMaxReadSize = 1 << 30;
+
+  Status Init(int32_t queue_depth) {
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd_ = IoUringSetup(static_cast<uint32_t>(queue_depth), &params);
+    if (ring_fd_ < 0) {
+      return Status::IOError("io_uring_setup failed: ", std::strerror(errno));
+    }
+    wake_fd_ = eventfd(0, EFD_CLOEXEC);
+    if (wake_fd_ < 0) {
+      return Status::IOError("eventfd failed: ", std::strerror(errno));
+    }
+    sq_entries_ = params.sq_entries;
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    RETURN_NOT_OK(MapRing(sq_ring_size_, IORING_OFF_SQ_RING, &sq_ring_));
+    if (single_mmap) {
+      cq_ring_ = sq_ring_;
+    } else {
+      RETURN_NOT_OK(MapRing(cq_ring_size_, IORING_OFF_CQ_RING, &cq_ring_));
+    }
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    void* sqes = nullptr;
+    RETURN_NOT_OK(MapRing(sqes_size_, IORING_OFF_SQES, &sqes));
+    sqes_ = reinterpret_cast<struct io_uring_sqe*>(sqes);
+
+    sq_tail_ = RingPointer<uint32_t>(sq_ring_, params.sq_off.tail);
+    sq_mask_ = *RingPointer<uint32_t>(sq_ring_, params.sq_off.ring_mask);
+    sq_array_ = RingPointer<uint32_t>(sq_ring_, params.sq_off.array);
+    cq_head_ = RingPointer<uint32_t>(cq_ring_, params.cq_off.head);
+    cq_tail_ = RingPointer<uint32_t>(cq_ring_, params.cq_off.tail);
+    cq_mask_ = *RingPointer<uint32_t>(cq_ring_, params.cq_off.ring_mask);
+    cqes_ = RingPointer<struct io_uring_cqe>(cq_ring_, params.cq_off.cqes);
+
+    reaper_ = std::thread([this]() { ReapCompletions(); });
+    return Status::OK();
+  }
+
+  Status MapRing(size_t size, off_t offset, void** out) {
+    void* ring = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ring_fd_, offset);
+    if (ring == MAP_FAILED) {
+      return Status::IOError("io_uring mmap failed: ", std::strerror(errno));
+    }
+    *out = ring;
+    return Status::OK();
+  }
+
+  void PrepareRead(uint32_t index, AsyncReadRequest* request) {
+    struct io_uring_sqe* sqe = &sqes_[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    // IORING_OP_READV rather than IORING_OP_READ, for older kernels
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = fd_;
+    sqe->off = static_cast<uint64_t>(request->position);
+    request->iov.iov_base = request->buffer->mutable_data();
+    request->iov.iov_len = static_cast<size_t>(std::min(request->nbytes, kMaxReadSize));
+    sqe->addr = reinterpret_cast<uint64_t>(&request->iov);
+    sqe->len = 1;
+    sqe->user_data = reinterpret_cast<uint64_t>(request);
+    sq_array_[index] = index;
+  }
+
+  // Submit prepared entries, return how many were consumed by the kernel
+  uint32_t EnterUnlocked(uint32_t count, Status* status) {
+    uint32_t submitted = 0;
+    while (submitted < count) {
+      const int ret = IoUringEnter(ring_fd_, count - submitted, 0, 0);
+      if (ret < 0 && errno == EINTR) {
+        continue;
+      }
+      if (ret <= 0) {
+        *status = Status::IOError("io_uring_enter failed: ",
+                                  std::strerror(ret < 0 ? errno : EAGAIN));
+        break;
+      }
+      submitted += static_cast<uint32_t>(ret);
+    }
+    return submitted;
+  }
+
+  void ReapCompletions() {
+    while (true) {
+      // Only this thread writes the completion queue head
+      const uint32_t head = *cq_head_;
+      if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+        struct pollfd fds[2] = {{ring_fd_, POLLIN, 0}, {wake_fd_, POLLIN, 0}};
+        const int ret = poll(fds, 2, -1);
+        if (ret < 0 && errno == EINTR) {
+          continue;
+        }
+        if (ret < 0 || (fds[0].revents & (POLLERR | POLLNVAL)) != 0) {
+          FailPending(Status::IOError("Waiting for io_uring completions failed: ",
+                                      std::strerror(ret < 0 ? errno : EBADF)));
+          return;
+        }
+        if (fds[1].revents != 0) {
+          // Stop() only signals once no reads are in flight
+          return;
+        }
+        continue;
+      }
+      const struct io_uring_cqe cqe = cqes_[head & cq_mask_];
+      __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+      std::unique_ptr<AsyncReadRequest> request(
+          reinterpret_cast<AsyncReadRequest*>(cqe.user_data));
+      // Inline future callbacks run here and delay all other completions,
+      // as documented on AsyncReadableFile
+      request->Finish(CompleteRead(request.get(), cqe.res));
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_.erase(request.get());
+      request.reset();
+      if (--in_flight_ == 0) {
+        all_done_.notify_all();
+      }
+      slot_available_.notify_one();
+    }
+  }
+
+  // Fail the reads in flight and any later submission.  The kernel may still
+  // write into the buffers of failed reads, so they're kept alive until the
+  // ring is closed.
+  void FailPending(const Status& st) {
+    std::vector<AsyncReadRequest*> pending;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+      reaper_status_ = st;
+      pending.assign(pending_.begin(), pending_.end());
+      pending_.clear();
+      in_flight_ = 0;
+      slot_available_.notify_all();
+      all_done_.notify_all();
+    }
+    for (AsyncReadRequest* request : pending) {
+      failed_.emplace_back(request);
+      request->Finish(st);
+    }
+  }
+
+  Status CompleteRead(AsyncReadRequest* request, int32_t result) {
+    if (result < 0 && result != -EINTR && result != -EAGAIN) {
+      return Status::IOError("Error reading bytes from file: ", std::strerror(-result));
+    }
+    if (result == 0) {
+      // EOF
+      return Status::OK();
+    }
+    request->bytes_read += std::max(result, 0);
+    // Short reads before EOF are rare, finish them synchronously
+    if (request->bytes_read < request->nbytes) {
+      return request->ReadRemaining(fd_);
+    }
+    return Status::OK();
+  }
+
+  const int fd_;
+  int ring_fd_ = -1;
+  int wake_fd_ = -1;
+  uint32_t sq_entries_ = 0;
+
+  void* sq_ring_ = nullptr;
+  void* cq_ring_ = nullptr;
+  struct io_uring_sqe* sqes_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  size_t cq_ring_size_ = 0;
+  size_t sqes_size_ = 0;
+
+  uint32_t* sq_tail_ = nullptr;
+  uint32_t sq_mask_ = 0;
+  uint32_t* sq_array_ = nullptr;
+  uint32_t* cq_head_ = nullptr;
+  uint32_t* cq_tail_ = nullptr;
+  uint32_t cq_mask_ = 0;
+  struct io_uring_cqe* cqes_ = nullptr;
+
+  // Serializes submissions and protects the fields below
+  std::mutex mutex_;
+  std::condition_variable slot_available_;
+  std::condition_variable all_done_;
+  uint32_t in_flight_ = 0;
+  std::unordered_set<AsyncReadRequest*> pending_;
+  bool stopped_ = false;
+  bool stop_requested_ = false;
+  Status reaper_status_;
+
+  // Only used by the reaper thread, then destroyed after the ring is closed
+  std::vector<std::unique_ptr<AsyncReadRequest>> failed_;
+
+  std::thread reaper_;
+};
+
+constexpr int64_t IoUringReader::kMaxReadSize;
+
+#endif  // ARROW_WITH_IO_URING
+
+}  // namespace
+
+class AsyncReadableFile::AsyncReadableFileImpl : public ReadableOSFile {
+ public:
+  explicit AsyncReadableFileImpl(MemoryPool* pool) : ReadableOSFile(pool) {}
+
+  Status Open(const std::string& path, const AsyncReadOptions& options) {
+    if (options.queue_depth <= 0 || options.num_threads <= 0) {
+      return Status::Invalid("Invalid AsyncReadOptions");
+    }
+    RETURN_NOT_OK(OpenReadable(path));
+
+    switch (options.backend) {
+      case AsyncReadBackend::AUTO:
+#ifdef ARROW_WITH_IO_URING
+        if (IoUringReader::Make(fd(), options.queue_depth, &reader_).ok()) {
+          backend_ = AsyncReadBackend::IO_URING;
+          return Status::OK();
+        }
+#endif
+        // io_uring is unavailable (e.g. old kernel or seccomp filter)
+        break;
+      case AsyncReadBackend::IO_URING:
+#ifdef ARROW_WITH_IO_URING
+        RETURN_NOT_OK(IoUringReader::Make(fd(), options.queue_depth, &reader_));
+        backend_ = AsyncReadBackend::IO_URING;
+        return Status::OK();
+#else
+        return Status::NotImplemented("Arrow was not built with io_uring support");
+#endif
+      case AsyncReadBackend::THREAD_POOL:
+        break;
+    }
+    RETURN_NOT_OK(ThreadPoolReader::Make(fd(), options.num_threads, &reader_));
+    backend_ = AsyncReadBackend::THREAD_POOL;
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (reader_) {
+      RETURN_NOT_OK(reader_->Stop());
+    }
+    return OSFile::Close();
+  }
+
+  std::vector<Future<BufferPtr>> SubmitReads(const std::vector<ReadRange>& ranges) {
+    std::vector<Future<BufferPtr>> futures;
+    AsyncReadRequests requests;
+    for (const auto& range : ranges) {
+      std::unique_ptr<AsyncReadRequest> request;
+      Status st = MakeRequest(range, &request);
+      if (!st.ok()) {
+        futures.push_back(Future<BufferPtr>::MakeFinished(st));
+        continue;
+      }
+      futures.push_back(request->future);
+      requests.push_back(std::move(request));
+    }
+    if (!requests.empty()) {
+      reader_->Submit(std::move(requests));
+    }
+    return futures;
+  }
+
+  AsyncReadBackend::type backend() const { return backend_; }
+
+ private:
+  Status MakeRequest(const ReadRange& range, std::unique_ptr<AsyncReadRequest>* out) {
+    if (!is_open() || !reader_) {
+      return ClosedFileError();
+    }
+    if (range.offset < 0 || range.length < 0) {
+      return Status::Invalid("Invalid read: position ", range.offset, ", nbytes ",
+                             range.length);
+    }
+    std::unique_ptr<AsyncReadRequest> request(new AsyncReadRequest());
+    request->position = range.offset;
+    request->nbytes = range.length;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, range.length, &request->buffer));
+    *out = std::move(request);
+    return Status::OK();
+  }
+
+  std::unique_ptr<AsyncReader> reader_;
+  AsyncReadBackend::type backend_ = AsyncReadBackend::THREAD_POOL;
+};
+
+AsyncReadableFile::AsyncReadableFile(MemoryPool* pool) {
+  impl_.reset(new AsyncReadableFileImpl(pool));
+}
+
+AsyncReadableFile::~AsyncReadableFile() { DCHECK_OK(impl_->Close()); }
+
+Status AsyncReadableFile::Open(const std::string& path,
+                               std::shared_ptr<AsyncReadableFile>* file) {
+  return Open(path, AsyncReadOptions::Defaults(), default_memory_pool(), file);
+}
+
+Status AsyncReadableFile::Open(const std::string& path, const AsyncReadOptions& options,
+                               MemoryPool* pool,
+                               std::shared_ptr<AsyncReadableFile>* file) {
+  *file = std::shared_ptr<AsyncReadableFile>(new AsyncReadableFile(pool));
+  return (*file)->impl_->Open(path, options);
+}
+
+Status AsyncReadableFile::Close() { return impl_->Close(); }
+
+bool AsyncReadableFile::closed() const { return !impl_->is_open(); }
+
+Status AsyncReadableFile::Tell(int64_t* pos) const { return impl_->Tell(pos); }
+
+Status AsyncReadableFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  std::lock_guard<std::mutex> guard(impl_->lock());
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status AsyncReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  std::lock_guard<std::mutex> guard(impl_->lock());
+  return impl_->ReadBuffer(nbytes, out);
+}
+
+Status AsyncReadableFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                                 void* out) {
+  return impl_->ReadAt(position, nbytes, bytes_read, out);
+}
+
+Status AsyncReadableFile::ReadAt(int64_t position, int64_t nbytes,
+                                 std::shared_ptr<Buffer>* out) {
+  return impl_->ReadBufferAt(position, nbytes, out);
+}
+
+Future<std::shared_ptr<Buffer>> AsyncReadableFile::ReadAtAsync(int64_t position,
+                                                               int64_t nbytes) {
+  return impl_->SubmitReads({{position, nbytes}})[0];
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> AsyncReadableFile::SubmitReads(
+    const std::vector<ReadRange>& ranges) {
+  return impl_->SubmitReads(ranges);
+}
+
+Status AsyncReadableFile::GetSize(int64_t* size) {
+  *size = impl_->size();
+  return Status::OK();
+}
+
+Status AsyncReadableFile::Seek(int64_t pos) { return impl_->Seek(pos); }
+
+AsyncReadBackend::type AsyncReadableFile::backend() const { return impl_->backend(); }
+
+int AsyncReadableFile::file_descriptor() const { return impl_->fd(); }
+
 // ----------------------------------------------------------------------
 // FileOutputStream
 
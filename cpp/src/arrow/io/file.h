@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
@@ -171,6 +172,108 @@ class ARROW_EXPORT ReadableFile : public RandomAccessFile {
   std::unique_ptr<ReadableFileImpl> impl_;
 };
 
+/// \brief How an AsyncReadableFile executes its asynchronous reads
+struct AsyncReadBackend {
+  enum type {
+    /// io_uring if available, otherwise a thread pool
+    AUTO,
+    /// Linux io_uring, fails to open if unavailable
+    IO_URING,
+    /// Blocking pread() calls on a dedicated thread pool
+    THREAD_POOL
+  };
+};
+
+/// \brief Options for AsyncReadableFile
+struct ARROW_EXPORT AsyncReadOptions {
+  AsyncReadBackend::type backend = AsyncReadBackend::AUTO;
+
+  /// Maximum number of reads in flight with io_uring (the submission
+  /// queue size); further submissions wait for a slot
+  int32_t queue_depth = 128;
+
+  /// Number of pread() workers of the thread pool backend
+  int32_t num_threads = 8;
+
+  static AsyncReadOptions Defaults();
+};
+
+/// \brief An operating system file optimized for many concurrent random reads
+///
+/// Synchronous reads behave as in ReadableFile.  Asynchronous reads are
+/// submitted to an io_uring instance on Linux, or executed by a dedicated
+/// pool of pread() workers, instead of the shared I/O thread pool.
+///
+/// The futures of asynchronous reads are finished by the backend's threads.
+/// With io_uring, a single thread reaps all completions of the file, so
+/// callbacks added with Future::AddCallback() and continuations chained
+/// with an inline (null) executor must not block: they would delay every
+/// other pending read.  Continuations chained with Future::Then() on its
+/// default executor don't have this problem.
+class ARROW_EXPORT AsyncReadableFile : public RandomAccessFile {
+ public:
+  ~AsyncReadableFile() override;
+
+  /// \brief Open a local file for reading, with default options
+  /// \param[in] path with UTF8 encoding
+  /// \param[out] file AsyncReadableFile instance
+  static Status Open(const std::string& path, std::shared_ptr<AsyncReadableFile>* file);
+
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] options the asynchronous read options
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \param[out] file AsyncReadableFile instance
+  static Status Open(const std::string& path, const AsyncReadOptions& options,
+                     MemoryPool* pool, std::shared_ptr<AsyncReadableFile>* file);
+
+  /// \brief Close the file, waiting for pending asynchronous reads
+  Status Close() override;
+  bool closed() const override;
+  Status Tell(int64_t* position) const override;
+
+  // Read bytes from the file. Thread-safe
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* buffer) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Thread-safe implementation of ReadAt
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+
+  /// \brief Thread-safe implementation of ReadAt
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Read data from given file position asynchronously
+  ///
+  /// Inline callbacks on the returned future run on a backend thread and
+  /// must not block (see the class documentation).
+  Future<std::shared_ptr<Buffer>> ReadAtAsync(int64_t position, int64_t nbytes) override;
+
+  /// \brief Submit several reads at once
+  ///
+  /// With io_uring, the reads are submitted in as few system calls as the
+  /// queue depth allows.  As with ReadAtAsync(), inline callbacks on the
+  /// returned futures must not block.
+  /// \param[in] ranges the byte ranges to read
+  /// \return a future of the buffer holding the bytes read, for each range
+  std::vector<Future<std::shared_ptr<Buffer>>> SubmitReads(
+      const std::vector<ReadRange>& ranges);
+
+  Status GetSize(int64_t* size) override;
+  Status Seek(int64_t position) override;
+
+  /// \brief The backend actually used, never AUTO
+  AsyncReadBackend::type backend() const;
+
+  int file_descriptor() const;
+
+ private:
+  explicit AsyncReadableFile(MemoryPool* pool);
+
+  class ARROW_NO_EXPORT AsyncReadableFileImpl;
+  std::unique_ptr<AsyncReadableFileImpl> impl_;
+};
+
 // A file interface that uses memory-mapped files for memory interactions,
 // supporting zero copy reads. The same class is used for both reading and
 // writing.
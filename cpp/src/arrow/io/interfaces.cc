@@ -17,16 +17,29 @@
 
 #include "arrow/io/interfaces.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <vector>
 
+#include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace io {
 
+namespace {
+
+// The thread pool executing asynchronous reads
+internal::ThreadPool* GetAsyncReadExecutor() { return internal::GetIOThreadPool(); }
+
+}  // namespace
+
 FileInterface::~FileInterface() = default;
 
 Status InputStream::Advance(int64_t nbytes) {
@@ -40,6 +53,33 @@ util::string_view InputStream::Peek(int64_t ARROW_ARG_UNUSED(nbytes)) const {
 
 bool InputStream::supports_zero_copy() const { return false; }
 
+struct InputStream::InputStreamImpl {
+  std::mutex lock_;
+  // The last asynchronous read, which the next one must execute after
+  Future<std::shared_ptr<Buffer>> last_async_read_;
+};
+
+InputStream::~InputStream() = default;
+
+InputStream::InputStream() : interface_impl_(new InputStream::InputStreamImpl()) {}
+
+Future<std::shared_ptr<Buffer>> InputStream::ReadAsync(int64_t nbytes) {
+  using BufferPtr = std::shared_ptr<Buffer>;
+  std::lock_guard<std::mutex> lock(interface_impl_->lock_);
+  auto& last_async_read = interface_impl_->last_async_read_;
+  if (last_async_read.is_valid() && !last_async_read.is_finished()) {
+    // Chain after the pending read
+    last_async_read = last_async_read.Then<BufferPtr>(
+        [this, nbytes](const BufferPtr&, BufferPtr* out) { return Read(nbytes, out); },
+        GetAsyncReadExecutor());
+  } else {
+    last_async_read =
+        Async<BufferPtr>(GetAsyncReadExecutor(),
+                         [this, nbytes](BufferPtr* out) { return Read(nbytes, out); });
+  }
+  return last_async_read;
+}
+
 struct RandomAccessFile::RandomAccessFileImpl {
   std::mutex lock_;
 };
@@ -63,6 +103,157 @@ Status RandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
   return Read(nbytes, out);
 }
 
+Future<std::shared_ptr<Buffer>> RandomAccessFile::ReadAtAsync(int64_t position,
+                                                              int64_t nbytes) {
+  using BufferPtr = std::shared_ptr<Buffer>;
+  return Async<BufferPtr>(GetAsyncReadExecutor(),
+                          [this, position, nbytes](BufferPtr* out) {
+                            return ReadAt(position, nbytes, out);
+                          });
+}
+
+ReadRangeOptions ReadRangeOptions::Defaults() { return ReadRangeOptions(); }
+
+// Merge byte ranges sorted by offset into the reads covering them
+static std::vector<ReadRange> CoalesceReadRanges(const std::vector<ReadRange>& ranges,
+                                                 int64_t hole_size_limit,
+                                                 int64_t range_size_limit) {
+  std::vector<ReadRange> coalesced;
+  if (ranges.empty()) {
+    return coalesced;
+  }
+  ReadRange current = ranges[0];
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    const ReadRange& next = ranges[i];
+    DCHECK_GE(next.offset, current.offset);
+    const int64_t current_end = current.offset + current.length;
+    const int64_t next_end = next.offset + next.length;
+    if (next_end <= current_end) {
+      // Already covered by the current read, whatever its size
+      continue;
+    }
+    if (next.offset - current_end <= hole_size_limit &&
+        next_end - current.offset <= range_size_limit) {
+      current.length = next_end - current.offset;
+    } else {
+      coalesced.push_back(current);
+      current = next;
+    }
+  }
+  coalesced.push_back(current);
+  return coalesced;
+}
+
+// Read a large region as several concurrent reads into a single buffer
+static Future<std::shared_ptr<Buffer>> ReadSplitAsync(RandomAccessFile* file,
+                                                      int64_t offset, int64_t length,
+                                                      int64_t part_size) {
+  using BufferPtr = std::shared_ptr<Buffer>;
+  std::shared_ptr<ResizableBuffer> buffer;
+  Status st = AllocateResizableBuffer(length, &buffer);
+  if (!st.ok()) {
+    return Future<BufferPtr>::MakeFinished(st);
+  }
+
+  std::vector<Future<int64_t>> parts;
+  for (int64_t position = 0; position < length; position += part_size) {
+    const int64_t nbytes = std::min(part_size, length - position);
+    uint8_t* dest = buffer->mutable_data() + position;
+    parts.push_back(Async<int64_t>(
+        GetAsyncReadExecutor(),
+        [file, offset, position, nbytes, dest](int64_t* bytes_read) {
+          return file->ReadAt(offset + position, nbytes, bytes_read, dest);
+        }));
+  }
+  return AllComplete(parts).Then<BufferPtr>(
+      [buffer, part_size](const std::vector<int64_t>& bytes_read, BufferPtr* out) {
+        // The data ends at the first short read
+        int64_t size = 0;
+        for (int64_t nbytes : bytes_read) {
+          size += nbytes;
+          if (nbytes < part_size) {
+            break;
+          }
+        }
+        RETURN_NOT_OK(buffer->Resize(size, false /* shrink_to_fit */));
+        *out = buffer;
+        return Status::OK();
+      },
+      nullptr /* executor */);
+}
+
+Status RandomAccessFile::ReadRanges(const std::vector<ReadRange>& ranges,
+                                    const ReadRangeOptions& options,
+                                    std::vector<std::shared_ptr<Buffer>>* out) {
+  if (options.hole_size_limit < 0 || options.range_size_limit <= 0) {
+    return Status::Invalid("Invalid ReadRanges options");
+  }
+  std::vector<ReadRange> sorted_ranges;
+  for (const auto& range : ranges) {
+    if (range.offset < 0 || range.length < 0) {
+      return Status::Invalid("Invalid read range: offset ", range.offset, ", length ",
+                             range.length);
+    }
+    if (range.length > 0) {
+      sorted_ranges.push_back(range);
+    }
+  }
+  // For equal offsets, a longer range covers the shorter ones
+  std::sort(sorted_ranges.begin(), sorted_ranges.end(),
+            [](const ReadRange& left, const ReadRange& right) {
+              return left.offset < right.offset ||
+                     (left.offset == right.offset && left.length < right.length);
+            });
+  const std::vector<ReadRange> reads = CoalesceReadRanges(
+      sorted_ranges, options.hole_size_limit, options.range_size_limit);
+
+  std::vector<std::shared_ptr<Buffer>> read_buffers(reads.size());
+  if (supports_zero_copy()) {
+    // Reads are cheap, neither splitting nor concurrency would help
+    for (size_t i = 0; i < reads.size(); ++i) {
+      RETURN_NOT_OK(ReadAt(reads[i].offset, reads[i].length, &read_buffers[i]));
+    }
+  } else {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    for (const auto& read : reads) {
+      if (read.length > options.range_size_limit) {
+        futures.push_back(
+            ReadSplitAsync(this, read.offset, read.length, options.range_size_limit));
+      } else {
+        futures.push_back(ReadAtAsync(read.offset, read.length));
+      }
+    }
+    RETURN_NOT_OK(AllComplete(futures).Get(&read_buffers));
+  }
+
+  // Slice the buffer of the last read starting at or before each range
+  out->resize(ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const ReadRange& range = ranges[i];
+    if (range.length == 0) {
+      (*out)[i] = std::make_shared<Buffer>(nullptr, 0);
+      continue;
+    }
+    auto it = std::upper_bound(reads.begin(), reads.end(), range.offset,
+                               [](int64_t offset, const ReadRange& read) {
+                                 return offset < read.offset;
+                               });
+    DCHECK(it != reads.begin());
+    --it;
+    DCHECK_LE(range.offset + range.length, it->offset + it->length);
+    const auto& buffer = read_buffers[it - reads.begin()];
+    const int64_t start = std::min(range.offset - it->offset, buffer->size());
+    (*out)[i] =
+        SliceBuffer(buffer, start, std::min(range.length, buffer->size() - start));
+  }
+  return Status::OK();
+}
+
+Status RandomAccessFile::ReadRanges(const std::vector<ReadRange>& ranges,
+                                    std::vector<std::shared_ptr<Buffer>>* out) {
+  return ReadRanges(ranges, ReadRangeOptions::Defaults(), out);
+}
+
 Status Writable::Write(const std::string& data) {
   return Write(data.c_str(), static_cast<int64_t>(data.size()));
 }
@@ -32,6 +32,9 @@ namespace arrow {
 class Buffer;
 class Status;
 
+template <typename T>
+class Future;
+
 namespace io {
 
 struct FileMode {
@@ -117,6 +120,9 @@ class ARROW_EXPORT OutputStream : virtual public FileInterface, public Writable
 
 class ARROW_EXPORT InputStream : virtual public FileInterface, virtual public Readable {
  public:
+  /// Necessary because we hold a std::unique_ptr
+  ~InputStream() override;
+
   /// \brief Advance or skip stream indicated number of bytes
   /// \param[in] nbytes the number to move forward
   /// \return Status
@@ -132,8 +138,43 @@ class ARROW_EXPORT InputStream : virtual public FileInterface, virtual public Re
   /// \brief Return true if InputStream is capable of zero copy Buffer reads
   virtual bool supports_zero_copy() const;
 
+  /// \brief Read at most nbytes asynchronously
+  ///
+  /// The default implementation executes Read(...) on the I/O thread pool.
+  /// Successive asynchronous reads, even from different threads, are
+  /// executed in the order they were issued, and should not be mixed with
+  /// synchronous reads.
+  /// The stream must be kept alive until the returned future is finished.
+  ///
+  /// \param[in] nbytes the maximum number of bytes to read
+  /// \return a future of the buffer holding the bytes read
+  virtual Future<std::shared_ptr<Buffer>> ReadAsync(int64_t nbytes);
+
  protected:
-  InputStream() = default;
+  InputStream();
+
+ private:
+  struct ARROW_NO_EXPORT InputStreamImpl;
+  std::unique_ptr<InputStreamImpl> interface_impl_;
+};
+
+/// \brief A byte range in a file
+struct ARROW_EXPORT ReadRange {
+  int64_t offset;
+  int64_t length;
+};
+
+/// \brief Options for RandomAccessFile::ReadRanges
+struct ARROW_EXPORT ReadRangeOptions {
+  /// Ranges at most this many bytes apart are fetched in a single read, at
+  /// the cost of also reading the bytes in between
+  int64_t hole_size_limit = 8192;
+
+  /// Ranges are not coalesced beyond this size, and a larger single range is
+  /// fetched as several concurrent reads
+  int64_t range_size_limit = 32 * 1024 * 1024;
+
+  static ReadRangeOptions Defaults();
 };
 
 class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
@@ -166,6 +207,37 @@ class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
   /// retrieved by calling Buffer::size().
   virtual Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out);
 
+  /// \brief Read nbytes at position asynchronously
+  ///
+  /// The default implementation executes ReadAt(...) on the I/O thread pool.
+  /// Any number of asynchronous reads can be pending at once.  The file must
+  /// be kept alive until the returned future is finished.
+  ///
+  /// \param[in] position Where to read bytes from
+  /// \param[in] nbytes The number of bytes to read
+  /// \return a future of the buffer holding the bytes read
+  virtual Future<std::shared_ptr<Buffer>> ReadAtAsync(int64_t position, int64_t nbytes);
+
+  /// \brief Read several byte ranges at once
+  ///
+  /// The default implementation coalesces nearby ranges into larger reads.
+  /// Unless the file supports zero-copy reads, those are issued concurrently
+  /// on the I/O thread pool, so this shouldn't be called from an I/O pool task.
+  ///
+  /// \param[in] ranges The byte ranges to read, in any order, possibly
+  /// overlapping
+  /// \param[in] options How to coalesce and split the reads
+  /// \param[out] out One buffer per range, in the order of the ranges. Buffers
+  /// are zero-copy slices of the data read and may be shorter than requested
+  /// at the end of the file.
+  virtual Status ReadRanges(const std::vector<ReadRange>& ranges,
+                            const ReadRangeOptions& options,
+                            std::vector<std::shared_ptr<Buffer>>* out);
+
+  /// \brief Read several byte ranges at once, with default options
+  Status ReadRanges(const std::vector<ReadRange>& ranges,
+                    std::vector<std::shared_ptr<Buffer>>* out);
+
  protected:
   RandomAccessFile();
 
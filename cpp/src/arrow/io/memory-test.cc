@@ -15,11 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -30,6 +33,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
 
 namespace arrow {
 
@@ -195,6 +199,126 @@ TEST(TestBufferReader, Peek) {
   ASSERT_EQ(data, view.to_string());
 }
 
+TEST(TestBufferReader, ReadAsync) {
+  std::string data = "data123456";
+  BufferReader reader(data);
+
+  // Asynchronous stream reads execute in order
+  std::vector<Future<std::shared_ptr<Buffer>>> reads;
+  for (int i = 0; i < 5; ++i) {
+    reads.push_back(reader.ReadAsync(2));
+  }
+  std::vector<std::shared_ptr<Buffer>> pieces;
+  ASSERT_OK(AllComplete(reads).Get(&pieces));
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_EQ(data.substr(i * 2, 2), pieces[i]->ToString());
+  }
+
+  // Asynchronous reads at random offsets, with a continuation
+  auto size = reader.ReadAtAsync(4, 6).Then<int64_t>(
+      [](const std::shared_ptr<Buffer>& buffer, int64_t* out) {
+        *out = buffer->size();
+        return Status::OK();
+      });
+  int64_t nbytes;
+  ASSERT_OK(size.Get(&nbytes));
+  ASSERT_EQ(6, nbytes);
+  ASSERT_RAISES(IOError, reader.ReadAtAsync(0, -1).Wait());
+}
+
+TEST(TestBufferReader, ReadAsyncFromThreads) {
+  const int kNumThreads = 4;
+  const int kNumReads = 250;
+  std::string data(kNumThreads * kNumReads, 'x');
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>(i % 127);
+  }
+  BufferReader reader(data);
+
+  // Each read gets a distinct piece of the stream
+  std::vector<std::vector<Future<std::shared_ptr<Buffer>>>> reads(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&reader, &reads, i]() {
+      for (int j = 0; j < kNumReads; ++j) {
+        reads[i].push_back(reader.ReadAsync(1));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  std::string read_data;
+  for (const auto& thread_reads : reads) {
+    std::vector<std::shared_ptr<Buffer>> pieces;
+    ASSERT_OK(AllComplete(thread_reads).Get(&pieces));
+    for (const auto& piece : pieces) {
+      read_data += piece->ToString();
+    }
+  }
+  std::sort(read_data.begin(), read_data.end());
+  std::sort(data.begin(), data.end());
+  ASSERT_EQ(data, read_data);
+}
+
+// A BufferReader counting its ReadAt calls
+class CountingBufferReader : public BufferReader {
+ public:
+  using BufferReader::BufferReader;
+  using BufferReader::ReadAt;
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    ++num_reads;
+    return BufferReader::ReadAt(position, nbytes, out);
+  }
+
+  int num_reads = 0;
+};
+
+TEST(TestBufferReader, ReadRanges) {
+  std::shared_ptr<Buffer> data;
+  ASSERT_OK(Buffer::FromString("0123456789abcdefghij", &data));
+  CountingBufferReader reader(data);
+
+  auto options = ReadRangeOptions::Defaults();
+  options.hole_size_limit = 2;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  // Ranges out of order, overlapping, and past the end of the buffer
+  ASSERT_OK(reader.ReadRanges({{12, 2}, {0, 3}, {5, 2}, {1, 4}, {18, 5}, {15, 0}},
+                              options, &buffers));
+  ASSERT_EQ(6, buffers.size());
+  AssertBufferEqual(*buffers[0], "cd");
+  AssertBufferEqual(*buffers[1], "012");
+  AssertBufferEqual(*buffers[2], "56");
+  AssertBufferEqual(*buffers[3], "1234");
+  AssertBufferEqual(*buffers[4], "ij");
+  AssertBufferEqual(*buffers[5], "");
+  // [0, 7), [12, 14) and [18, 23) are read
+  ASSERT_EQ(3, reader.num_reads);
+  // Zero-copy slices
+  ASSERT_EQ(data->data() + 12, buffers[0]->data());
+  ASSERT_EQ(data->data() + 1, buffers[3]->data());
+
+  // Coalescing is bounded by the range size limit
+  reader.num_reads = 0;
+  options.hole_size_limit = 100;
+  options.range_size_limit = 10;
+  ASSERT_OK(reader.ReadRanges({{0, 4}, {4, 4}, {8, 4}, {12, 8}}, options, &buffers));
+  ASSERT_EQ(3, reader.num_reads);
+  AssertBufferEqual(*buffers[2], "89ab");
+  AssertBufferEqual(*buffers[3], "cdefghij");
+
+  // Ranges inside a read are never read again, even past the size limit
+  reader.num_reads = 0;
+  ASSERT_OK(reader.ReadRanges({{0, 12}, {2, 3}, {10, 2}}, options, &buffers));
+  ASSERT_EQ(1, reader.num_reads);
+  AssertBufferEqual(*buffers[1], "234");
+  AssertBufferEqual(*buffers[2], "ab");
+
+  ASSERT_OK(reader.ReadRanges({}, &buffers));
+  ASSERT_EQ(0, buffers.size());
+}
+
 TEST(TestBufferReader, RetainParentReference) {
   // ARROW-387
   std::string data = "data123456";
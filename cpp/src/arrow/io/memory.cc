@@ -300,7 +300,8 @@ Status BufferReader::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_rea
   if (nbytes < 0) {
     return Status::IOError("Cannot read a negative number of bytes from BufferReader.");
   }
-  *bytes_read = std::min(nbytes, size_ - position);
+  // Reads past the end of the buffer are empty
+  *bytes_read = std::max<int64_t>(0, std::min(nbytes, size_ - position));
   if (*bytes_read) {
     memcpy(buffer, data_ + position, *bytes_read);
   }
@@ -312,7 +313,7 @@ Status BufferReader::ReadAt(int64_t position, int64_t nbytes,
   if (nbytes < 0) {
     return Status::IOError("Cannot read a negative number of bytes from BufferReader.");
   }
-  int64_t size = std::min(nbytes, size_ - position);
+  int64_t size = std::max<int64_t>(0, std::min(nbytes, size_ - position));
 
   if (size > 0 && buffer_ != nullptr) {
     *out = SliceBuffer(buffer_, position, size);
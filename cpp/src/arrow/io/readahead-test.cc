@@ -284,6 +284,126 @@ TEST(ReadaheadSpooler, StressReads) {
   ASSERT_EQ(pos, NBYTES);
 }
 
+TEST(ReadaheadSpooler, RecycleBuffers) {
+  auto data_reader = DataReader("0123456789");
+  ReadaheadSpooler spooler(data_reader, 2, 1);
+  ReadaheadBuffer buf;
+
+  ASSERT_OK(spooler.Read(&buf));
+  AssertReadaheadBuffer(buf, {0}, {0}, "01");
+  const uint8_t* recycled_data = buf.buffer->data();
+  spooler.Recycle(std::move(buf));
+
+  // Depending on timing, the buffer is reused by the next read or the one after
+  ASSERT_OK(spooler.Read(&buf));
+  AssertReadaheadBuffer(buf, {0}, {0}, "23");
+  bool reused = recycled_data == buf.buffer->data();
+  ASSERT_OK(spooler.Read(&buf));
+  AssertReadaheadBuffer(buf, {0}, {0}, "45");
+  reused = reused || recycled_data == buf.buffer->data();
+  ASSERT_TRUE(reused);
+
+  // A buffer still referenced elsewhere isn't reused
+  std::shared_ptr<ResizableBuffer> kept = buf.buffer;
+  spooler.Recycle(std::move(buf));
+  ASSERT_OK(spooler.Read(&buf));
+  AssertReadaheadBuffer(buf, {0}, {0}, "67");
+  ASSERT_NE(kept->data(), buf.buffer->data());
+  ASSERT_OK(spooler.Read(&buf));
+  AssertReadaheadBuffer(buf, {0}, {0}, "89");
+  ASSERT_NE(kept->data(), buf.buffer->data());
+  AssertBufferEqual(*kept, "45");
+
+  ASSERT_OK(spooler.Read(&buf));
+  AssertReadaheadBufferEOF(buf);
+}
+
+TEST(ReadaheadSpooler, RecycleBuffersReleasedByOtherThreads) {
+  auto data_reader = DataReader("0123456789");
+  ReadaheadSpooler spooler(data_reader, 2, 1);
+  ReadaheadBuffer buf;
+
+  for (const std::string expected : {"01", "23", "45", "67", "89"}) {
+    ASSERT_OK(spooler.Read(&buf));
+    AssertReadaheadBuffer(buf, {0}, {0}, expected);
+    // Another thread looks at a slice and drops it, as CSV parsing tasks do
+    std::shared_ptr<Buffer> slice = SliceBuffer(buf.buffer, 0, 2);
+    std::thread thread([&slice, expected]() {
+      AssertBufferEqual(*slice, expected);
+      slice.reset();
+    });
+    thread.join();
+    spooler.Recycle(std::move(buf));
+  }
+  ASSERT_OK(spooler.Read(&buf));
+  AssertReadaheadBufferEOF(buf);
+}
+
+TEST(ReadaheadSpooler, ConcurrentReads) {
+  std::shared_ptr<Buffer> data;
+  ASSERT_OK(Buffer::FromString("0123456789abcdefghij", &data));
+  auto data_reader = std::make_shared<BufferReader>(data);
+  // Reads start at the current position
+  ASSERT_OK(data_reader->Seek(1));
+
+  ReadaheadSpooler spooler(data_reader, 3, 4, 1 /* left_padding */,
+                           2 /* right_padding */, 3 /* max_concurrent_reads */);
+  ReadaheadBuffer buf;
+  for (const std::string expected : {"123", "456", "789", "abc", "def", "ghi", "j"}) {
+    ASSERT_OK(spooler.Read(&buf));
+    AssertReadaheadBuffer(buf, {1}, {2}, expected);
+    spooler.Recycle(std::move(buf));
+  }
+  ASSERT_OK(spooler.Read(&buf));
+  AssertReadaheadBufferEOF(buf);
+  ASSERT_OK(spooler.Read(&buf));
+  AssertReadaheadBufferEOF(buf);
+}
+
+TEST(ReadaheadSpooler, ConcurrentReadsExactEnd) {
+  // The file size is a multiple of the read size
+  std::shared_ptr<Buffer> data;
+  ASSERT_OK(Buffer::FromString("012345", &data));
+  ReadaheadSpooler spooler(std::make_shared<BufferReader>(data), 2, 8, 0, 0, 4);
+  ReadaheadBuffer buf;
+  for (const std::string expected : {"01", "23", "45"}) {
+    ASSERT_OK(spooler.Read(&buf));
+    AssertReadaheadBuffer(buf, {0}, {0}, expected);
+  }
+  ASSERT_OK(spooler.Read(&buf));
+  AssertReadaheadBufferEOF(buf);
+  ASSERT_OK(spooler.Close());
+}
+
+TEST(ReadaheadSpooler, ConcurrentStressReads) {
+#if defined(ARROW_VALGRIND)
+  const int64_t NBYTES = 101;
+#else
+  const int64_t NBYTES = 50001;
+#endif
+  const int64_t READ_SIZE = 7;
+
+  std::shared_ptr<ResizableBuffer> data;
+  ASSERT_OK(MakeRandomByteBuffer(NBYTES, default_memory_pool(), &data));
+  auto data_reader = std::make_shared<BufferReader>(data);
+
+  ReadaheadSpooler spooler(data_reader, READ_SIZE, 16, 0, 0, 8);
+  int64_t pos = 0;
+  while (pos < NBYTES) {
+    ReadaheadBuffer buf;
+    ASSERT_OK(spooler.Read(&buf));
+    ASSERT_NE(buf.buffer.get(), nullptr) << "Got premature EOF at index " << pos;
+    auto expected_data = SliceBuffer(data, pos, std::min(READ_SIZE, NBYTES - pos));
+    AssertReadaheadBuffer(buf, {0}, {0}, *expected_data);
+    pos += expected_data->size();
+    spooler.Recycle(std::move(buf));
+  }
+  ReadaheadBuffer buf;
+  ASSERT_OK(spooler.Read(&buf));
+  AssertReadaheadBufferEOF(buf);
+  ASSERT_EQ(pos, NBYTES);
+}
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
@@ -17,13 +17,17 @@
 
 #include "arrow/io/readahead.h"
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <cstring>
 #include <deque>
+#include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
-#include <thread>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
@@ -31,6 +35,7 @@
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace io {
@@ -42,17 +47,27 @@ namespace internal {
 class ReadaheadSpooler::Impl {
  public:
   Impl(MemoryPool* pool, std::shared_ptr<InputStream> raw, int64_t read_size,
-       int32_t readahead_queue_size, int64_t left_padding, int64_t right_padding)
+       int32_t readahead_queue_size, int64_t left_padding, int64_t right_padding,
+       int32_t max_concurrent_reads)
       : pool_(pool),
         raw_(raw),
         read_size_(read_size),
         readahead_queue_size_(readahead_queue_size),
+        max_concurrent_reads_(max_concurrent_reads),
         left_padding_(left_padding),
         right_padding_(right_padding) {
     DCHECK_NE(raw, nullptr);
     DCHECK_GT(read_size, 0);
     DCHECK_GT(readahead_queue_size, 0);
-    io_worker_ = std::thread([&]() { WorkerLoop(); });
+    DCHECK_GT(max_concurrent_reads, 0);
+    if (max_concurrent_reads_ > 1) {
+      random_access_raw_ = std::dynamic_pointer_cast<RandomAccessFile>(raw_);
+      if (random_access_raw_ != nullptr) {
+        read_status_ = random_access_raw_->Tell(&next_read_position_);
+      }
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    SpawnReadsUnlocked();
   }
 
   ~Impl() { ARROW_UNUSED(Close()); }
@@ -60,13 +75,10 @@ class ReadaheadSpooler::Impl {
   Status Close() {
     std::unique_lock<std::mutex> lock(mutex_);
     please_close_ = true;
-    io_wakeup_.notify_one();
-    // Wait for IO thread to finish
-    if (io_worker_.joinable()) {
-      lock.unlock();
-      io_worker_.join();
-      lock.lock();
-    }
+    // Wait for the current I/O tasks to finish
+    io_progress_.wait(lock, [this]() { return !reading_ && reads_in_flight_ == 0; });
+    // No more reads will happen
+    eof_ = true;
     return raw_->Close();
   }
 
@@ -74,19 +86,17 @@ class ReadaheadSpooler::Impl {
     std::unique_lock<std::mutex> lock(mutex_);
     while (true) {
       // Drain queue before querying other flags
-      if (buffer_queue_.size() > 0) {
-        *out = std::move(buffer_queue_.front());
+      if (PopReadyBufferUnlocked(out)) {
         DCHECK_NE(out->buffer, nullptr);
-        buffer_queue_.pop_front();
         // Need to fill up queue again
-        io_wakeup_.notify_one();
+        SpawnReadsUnlocked();
         return Status::OK();
       }
       if (!read_status_.ok()) {
         // Got a read error, bail out
         return read_status_;
       }
-      if (eof_) {
+      if (eof_ || next_output_sequence_ >= eof_sequence_) {
         out->buffer.reset();
         return Status::OK();
       }
@@ -95,6 +105,21 @@ class ReadaheadSpooler::Impl {
     }
   }
 
+  void Recycle(std::shared_ptr<ResizableBuffer> buffer) {
+    // Don't reuse memory the caller (or a slice) may still be looking at
+    if (buffer == nullptr || buffer.use_count() != 1) {
+      return;
+    }
+    // use_count() is a relaxed load: synchronize with the release of the
+    // other references (e.g. by parsing threads) before writing to the buffer
+    std::atomic_thread_fence(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (free_buffers_.size() <
+        static_cast<size_t>(std::max(readahead_queue_size_, max_concurrent_reads_))) {
+      free_buffers_.push_back(std::move(buffer));
+    }
+  }
+
   int64_t left_padding() {
     std::unique_lock<std::mutex> lock(mutex_);
     return left_padding_;
@@ -116,58 +141,167 @@ class ReadaheadSpooler::Impl {
   }
 
  protected:
-  // The background thread's main function
-  void WorkerLoop() {
+  // Take the next buffer in file order, if it was read already.  Must be
+  // called with the lock held.
+  bool PopReadyBufferUnlocked(ReadaheadBuffer* out) {
+    if (random_access_raw_ != nullptr) {
+      auto it = completed_reads_.find(next_output_sequence_);
+      if (it == completed_reads_.end() || next_output_sequence_ >= eof_sequence_) {
+        return false;
+      }
+      *out = std::move(it->second);
+      completed_reads_.erase(it);
+      ++next_output_sequence_;
+      return true;
+    }
+    if (buffer_queue_.empty()) {
+      return false;
+    }
+    *out = std::move(buffer_queue_.front());
+    buffer_queue_.pop_front();
+    return true;
+  }
+
+  // Spawn I/O tasks filling up the readahead queue, unless no more reads are
+  // needed.  Must be called with the lock held.
+  void SpawnReadsUnlocked() {
+    if (random_access_raw_ != nullptr) {
+      SpawnReadsAtUnlocked();
+      return;
+    }
+    if (reading_ || please_close_ || eof_ || !read_status_.ok() ||
+        buffer_queue_.size() >= static_cast<size_t>(readahead_queue_size_)) {
+      return;
+    }
+    reading_ = true;
+    Status st = ::arrow::internal::GetIOThreadPool()->Spawn([this]() { ReadLoop(); });
+    if (!st.ok()) {
+      reading_ = false;
+      read_status_ = st;
+      io_progress_.notify_all();
+    }
+  }
+
+  // Spawn positional reads of the next blocks, up to max_concurrent_reads_ at
+  // once and readahead_queue_size_ blocks ahead of the consumer.  Must be
+  // called with the lock held.
+  void SpawnReadsAtUnlocked() {
+    while (!please_close_ && !eof_ && read_status_.ok() &&
+           next_read_sequence_ < eof_sequence_ &&
+           reads_in_flight_ < max_concurrent_reads_ &&
+           next_read_sequence_ - next_output_sequence_ < readahead_queue_size_) {
+      const int64_t sequence = next_read_sequence_++;
+      const int64_t position = next_read_position_;
+      next_read_position_ += read_size_;
+      ReadaheadBuffer buf = {PopFreeBufferUnlocked(), left_padding_, right_padding_};
+
+      ++reads_in_flight_;
+      Status st = ::arrow::internal::GetIOThreadPool()->Spawn(
+          [this, sequence, position, buf]() { ReadAtTask(sequence, position, buf); });
+      if (!st.ok()) {
+        --reads_in_flight_;
+        read_status_ = st;
+        io_progress_.notify_all();
+        return;
+      }
+    }
+  }
+
+  // An I/O task reading the given block of a RandomAccessFile
+  void ReadAtTask(int64_t sequence, int64_t position, ReadaheadBuffer buf) {
+    Status st = ReadOneBufferUnlocked(position, &buf);
+
     std::unique_lock<std::mutex> lock(mutex_);
-    Status st;
+    --reads_in_flight_;
+    if (!st.ok()) {
+      if (read_status_.ok()) {
+        read_status_ = st;
+      }
+    } else {
+      const int64_t bytes_read =
+          buf.buffer->size() - buf.left_padding - buf.right_padding;
+      if (bytes_read < read_size_) {
+        // Got a short read, this is the last block
+        eof_sequence_ = std::min(eof_sequence_, bytes_read > 0 ? sequence + 1 : sequence);
+      }
+      if (bytes_read > 0 && sequence < eof_sequence_ && !please_close_) {
+        completed_reads_[sequence] = std::move(buf);
+      }
+      // Drop any block read beyond the end of file
+      completed_reads_.erase(completed_reads_.lower_bound(eof_sequence_),
+                             completed_reads_.end());
+    }
+    SpawnReadsUnlocked();
+    // Make sure any pending Read() or Close() doesn't block indefinitely
+    io_progress_.notify_all();
+  }
 
-    while (true) {
+  // Take a recycled buffer, if any.  Must be called with the lock held.
+  std::shared_ptr<ResizableBuffer> PopFreeBufferUnlocked() {
+    if (free_buffers_.empty()) {
+      return nullptr;
+    }
+    auto buffer = std::move(free_buffers_.back());
+    free_buffers_.pop_back();
+    return buffer;
+  }
+
+  // The I/O task's main function
+  void ReadLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // Fill up readahead queue until desired size
+    while (!please_close_ &&
+           buffer_queue_.size() < static_cast<size_t>(readahead_queue_size_)) {
+      ReadaheadBuffer buf = {PopFreeBufferUnlocked(), left_padding_, right_padding_};
+      lock.unlock();
+      Status st = ReadOneBufferUnlocked(-1, &buf);
+      lock.lock();
+      if (!st.ok()) {
+        read_status_ = st;
+        break;
+      }
+      // Close() could have been called while unlocked above
       if (please_close_) {
-        goto eof;
+        eof_ = true;
+        break;
       }
-      // Fill up readahead queue until desired size
-      while (buffer_queue_.size() < static_cast<size_t>(readahead_queue_size_)) {
-        ReadaheadBuffer buf = {nullptr, left_padding_, right_padding_};
-        lock.unlock();
-        Status st = ReadOneBufferUnlocked(&buf);
-        lock.lock();
-        if (!st.ok()) {
-          read_status_ = st;
-          goto error;
-        }
-        // Close() could have been called while unlocked above
-        if (please_close_) {
-          goto eof;
-        }
-        // Got empty read?
-        if (buf.buffer->size() == buf.left_padding + buf.right_padding) {
-          goto eof;
-        }
-        buffer_queue_.push_back(std::move(buf));
-        io_progress_.notify_one();
+      // Got empty read?
+      if (buf.buffer->size() == buf.left_padding + buf.right_padding) {
+        eof_ = true;
+        break;
       }
-      // Wait for Close() or Read() call
-      io_wakeup_.wait(lock);
+      buffer_queue_.push_back(std::move(buf));
+      io_progress_.notify_all();
     }
-  eof:
-    eof_ = true;
-  error:
-    // Make sure any pending Read() doesn't block indefinitely
-    io_progress_.notify_one();
+    reading_ = false;
+    // Make sure any pending Read() or Close() doesn't block indefinitely
+    io_progress_.notify_all();
   }
 
-  Status ReadOneBufferUnlocked(ReadaheadBuffer* buf) {
+  // Read a block into buf, reusing its buffer if it has one.  The block is
+  // read at the given position, or sequentially if it is negative.
+  Status ReadOneBufferUnlocked(int64_t position, ReadaheadBuffer* buf) {
     // Note that left_padding_ and right_padding_ may be modified while unlocked
-    std::shared_ptr<ResizableBuffer> buffer;
-    int64_t bytes_read;
-    RETURN_NOT_OK(AllocateResizableBuffer(
-        pool_, read_size_ + buf->left_padding + buf->right_padding, &buffer));
+    std::shared_ptr<ResizableBuffer> buffer = std::move(buf->buffer);
+    const int64_t buffer_size = read_size_ + buf->left_padding + buf->right_padding;
+    if (buffer != nullptr) {
+      RETURN_NOT_OK(buffer->Resize(buffer_size, false /* shrink_to_fit */));
+    } else {
+      RETURN_NOT_OK(AllocateResizableBuffer(pool_, buffer_size, &buffer));
+    }
     DCHECK_NE(buffer->mutable_data(), nullptr);
-    RETURN_NOT_OK(
-        raw_->Read(read_size_, &bytes_read, buffer->mutable_data() + buf->left_padding));
+    int64_t bytes_read;
+    uint8_t* data = buffer->mutable_data() + buf->left_padding;
+    if (position >= 0) {
+      RETURN_NOT_OK(random_access_raw_->ReadAt(position, read_size_, &bytes_read, data));
+    } else {
+      RETURN_NOT_OK(raw_->Read(read_size_, &bytes_read, data));
+    }
     if (bytes_read < read_size_) {
       // Got a short read
-      RETURN_NOT_OK(buffer->Resize(bytes_read + buf->left_padding + buf->right_padding));
+      RETURN_NOT_OK(buffer->Resize(bytes_read + buf->left_padding + buf->right_padding,
+                                   false /* shrink_to_fit */));
       DCHECK_NE(buffer->mutable_data(), nullptr);
     }
     // Zero padding areas
@@ -180,32 +314,49 @@ class ReadaheadSpooler::Impl {
 
   MemoryPool* pool_;
   std::shared_ptr<InputStream> raw_;
+  // Non-null if blocks are read concurrently with ReadAt()
+  std::shared_ptr<RandomAccessFile> random_access_raw_;
   int64_t read_size_;
   int32_t readahead_queue_size_;
+  int32_t max_concurrent_reads_;
   int64_t left_padding_ = 0;
   int64_t right_padding_ = 0;
 
   std::mutex mutex_;
-  std::condition_variable io_wakeup_;
   std::condition_variable io_progress_;
-  std::thread io_worker_;
+  // Whether an I/O task is running (sequential reads)
+  bool reading_ = false;
   bool please_close_ = false;
   bool eof_ = false;
   std::deque<ReadaheadBuffer> buffer_queue_;
   Status read_status_;
+  // Buffers given back by the consumer, to be reused by later reads
+  std::vector<std::shared_ptr<ResizableBuffer>> free_buffers_;
+
+  // Concurrent reads: blocks are numbered in file order, and completed
+  // blocks are handed out in that order
+  int32_t reads_in_flight_ = 0;
+  int64_t next_read_position_ = 0;
+  int64_t next_read_sequence_ = 0;
+  int64_t next_output_sequence_ = 0;
+  // The number of the first block past the end of file
+  int64_t eof_sequence_ = std::numeric_limits<int64_t>::max();
+  std::map<int64_t, ReadaheadBuffer> completed_reads_;
 };
 
 ReadaheadSpooler::ReadaheadSpooler(MemoryPool* pool, std::shared_ptr<InputStream> raw,
                                    int64_t read_size, int32_t readahead_queue_size,
-                                   int64_t left_padding, int64_t right_padding)
+                                   int64_t left_padding, int64_t right_padding,
+                                   int32_t max_concurrent_reads)
     : impl_(new ReadaheadSpooler::Impl(pool, raw, read_size, readahead_queue_size,
-                                       left_padding, right_padding)) {}
+                                       left_padding, right_padding,
+                                       max_concurrent_reads)) {}
 
 ReadaheadSpooler::ReadaheadSpooler(std::shared_ptr<InputStream> raw, int64_t read_size,
                                    int32_t readahead_queue_size, int64_t left_padding,
-                                   int64_t right_padding)
+                                   int64_t right_padding, int32_t max_concurrent_reads)
     : ReadaheadSpooler(default_memory_pool(), raw, read_size, readahead_queue_size,
-                       left_padding, right_padding) {}
+                       left_padding, right_padding, max_concurrent_reads) {}
 
 int64_t ReadaheadSpooler::GetLeftPadding() { return impl_->left_padding(); }
 
@@ -219,6 +370,10 @@ Status ReadaheadSpooler::Close() { return impl_->Close(); }
 
 Status ReadaheadSpooler::Read(ReadaheadBuffer* out) { return impl_->Read(out); }
 
+void ReadaheadSpooler::Recycle(ReadaheadBuffer buffer) {
+  impl_->Recycle(std::move(buffer.buffer));
+}
+
 ReadaheadSpooler::~ReadaheadSpooler() {}
 
 }  // namespace internal
@@ -45,18 +45,24 @@ class ARROW_EXPORT ReadaheadSpooler {
  public:
   /// \brief EXPERIMENTAL: Create a readahead spooler wrapping the given input stream.
   ///
-  /// The spooler launches a background thread that reads up to a given number
-  /// of fixed-size blocks in advance from the underlying stream.
+  /// The spooler reads up to a given number of fixed-size blocks in advance
+  /// from the underlying stream, using tasks on the I/O thread pool.
   /// The buffers returned by Read() will be padded at the beginning and the end
   /// with the configured amount of (zeroed) bytes.
+  ///
+  /// If the stream is a RandomAccessFile and max_concurrent_reads is more
+  /// than 1, up to that many blocks are read at once with ReadAt(), starting
+  /// from the current file position.  The file position is then left
+  /// unspecified.  Blocks are still returned in file order.
   ReadaheadSpooler(MemoryPool* pool, std::shared_ptr<InputStream> raw,
                    int64_t read_size = kDefaultReadSize, int32_t readahead_queue_size = 1,
-                   int64_t left_padding = 0, int64_t right_padding = 0);
+                   int64_t left_padding = 0, int64_t right_padding = 0,
+                   int32_t max_concurrent_reads = 1);
 
   explicit ReadaheadSpooler(std::shared_ptr<InputStream> raw,
                             int64_t read_size = kDefaultReadSize,
                             int32_t readahead_queue_size = 1, int64_t left_padding = 0,
-                            int64_t right_padding = 0);
+                            int64_t right_padding = 0, int32_t max_concurrent_reads = 1);
 
   ~ReadaheadSpooler();
 
@@ -80,10 +86,15 @@ class ARROW_EXPORT ReadaheadSpooler {
   /// reached and/or the spooler was explicitly closed.
   /// Otherwise, the buffer will contain at most read_size bytes in addition
   /// to the configured padding (short reads are possible at the end of a file).
-  // How do we allow reusing the buffer in ReadaheadBuffer? perhaps by using
-  // a caching memory pool?
   Status Read(ReadaheadBuffer* out);
 
+  /// \brief Give back a buffer returned by Read(), to be reused by later reads.
+  ///
+  /// The caller must not use the buffer afterwards.  It is only reused if no
+  /// other reference to it (e.g. a slice) remains, and only a bounded number
+  /// of buffers is kept.
+  void Recycle(ReadaheadBuffer buffer);
+
  private:
   static constexpr int64_t kDefaultReadSize = 1 << 20;  // 1 MB
 
@@ -741,15 +741,73 @@ static Status SchemaToFlatbuffer(FBB& fbb, const Schema& schema,
   return Status::OK();
 }
 
+static const char kBodyCompressionKeyName[] = "ARROW:body_compression";
+
+static const struct {
+  Compression::type type;
+  const char* name;
+} kCompressionNames[] = {{Compression::SNAPPY, "snappy"}, {Compression::GZIP, "gzip"},
+                         {Compression::BROTLI, "brotli"}, {Compression::ZSTD, "zstd"},
+                         {Compression::LZ4, "lz4"},       {Compression::LZO, "lzo"},
+                         {Compression::BZ2, "bz2"}};
+
+static Status CompressionToString(Compression::type compression, std::string* out) {
+  for (const auto& entry : kCompressionNames) {
+    if (entry.type == compression) {
+      *out = entry.name;
+      return Status::OK();
+    }
+  }
+  return Status::Invalid("Unsupported body compression: ", static_cast<int>(compression));
+}
+
+static Status CompressionFromString(const std::string& name, Compression::type* out) {
+  for (const auto& entry : kCompressionNames) {
+    if (name == entry.name) {
+      *out = entry.type;
+      return Status::OK();
+    }
+  }
+  return Status::IOError("Unknown body compression in IPC message: ", name);
+}
+
 static Status WriteFBMessage(FBB& fbb, flatbuf::MessageHeader header_type,
                              flatbuffers::Offset<void> header, int64_t body_length,
-                             std::shared_ptr<Buffer>* out) {
+                             std::shared_ptr<Buffer>* out,
+                             Compression::type compression = Compression::UNCOMPRESSED) {
+  flatbuffers::Offset<KVVector> fb_custom_metadata;
+  if (compression != Compression::UNCOMPRESSED) {
+    std::string name;
+    RETURN_NOT_OK(CompressionToString(compression, &name));
+    std::vector<KeyValueOffset> key_values = {
+        AppendKeyValue(fbb, kBodyCompressionKeyName, name)};
+    fb_custom_metadata = fbb.CreateVector(key_values);
+  }
   auto message = flatbuf::CreateMessage(fbb, kCurrentMetadataVersion, header_type, header,
-                                        body_length);
+                                        body_length, fb_custom_metadata);
   fbb.Finish(message);
   return WriteFlatbufferBuilder(fbb, out);
 }
 
+Status GetBodyCompression(const void* opaque_message, Compression::type* out) {
+  auto message = static_cast<const flatbuf::Message*>(opaque_message);
+  *out = Compression::UNCOMPRESSED;
+  auto fb_metadata = message->custom_metadata();
+  if (fb_metadata == nullptr) {
+    return Status::OK();
+  }
+  for (const auto& pair : *fb_metadata) {
+    if (pair->key() == nullptr || pair->value() == nullptr) {
+      return Status::IOError(
+          "Key or value in custom metadata of flatbuffer-encoded Message is null.");
+    }
+    if (pair->key()->str() == kBodyCompressionKeyName) {
+      return CompressionFromString(pair->value()->str(), out);
+    }
+  }
+  return Status::OK();
+}
+
 Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
                           std::shared_ptr<Buffer>* out) {
   FBB fbb;
@@ -808,12 +866,13 @@ static Status MakeRecordBatch(FBB& fbb, int64_t length, int64_t body_length,
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
   return WriteFBMessage(fbb, flatbuf::MessageHeader_RecordBatch, record_batch.Union(),
-                        body_length, out);
+                        body_length, out, compression);
 }
 
 Status WriteTensorMessage(const Tensor& tensor, int64_t buffer_start_offset,
@@ -952,13 +1011,14 @@ Status WriteSparseTensorMessage(const SparseTensor& sparse_tensor, int64_t body_
 Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
   auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
   return WriteFBMessage(fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
-                        body_length, out);
+                        body_length, out, compression);
 }
 
 static flatbuffers::Offset<flatbuffers::Vector<const flatbuf::Block*>>
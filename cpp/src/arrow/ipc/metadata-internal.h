@@ -35,6 +35,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 
@@ -137,9 +138,15 @@ Status WriteMessage(const Buffer& message, int32_t alignment, io::OutputStream*
 Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
                           std::shared_ptr<Buffer>* out);
 
+// Serialize a record batch header as a Message flatbuffer
+//
+// If compression is not UNCOMPRESSED, the codec is recorded in the Message's
+// custom_metadata: each non-empty body buffer is then prefixed by its
+// uncompressed length as a little-endian int64, or -1 if it was stored as-is.
 Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out);
 
 Status WriteTensorMessage(const Tensor& tensor, const int64_t buffer_start_offset,
@@ -157,8 +164,13 @@ Status WriteDictionaryMessage(const int64_t id, const int64_t length,
                               const int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out);
 
+// Retrieve the codec used to compress the body buffers of a record batch or
+// dictionary batch Message, UNCOMPRESSED if none
+Status GetBodyCompression(const void* opaque_message, Compression::type* out);
+
 static inline Status WriteFlatbufferBuilder(flatbuffers::FlatBufferBuilder& fbb,
                                             std::shared_ptr<Buffer>* out) {
   int32_t size = fbb.GetSize();
@@ -16,10 +16,14 @@
 // under the License.
 
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <limits>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include <flatbuffers/flatbuffers.h>
 #include <gtest/gtest.h>
@@ -45,6 +49,8 @@
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 
@@ -809,6 +815,434 @@ TEST_F(TestStreamFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
 TEST_F(TestFileFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
+// ----------------------------------------------------------------------
+// Body buffer compression
+
+class TestBodyCompression
+    : public ::testing::TestWithParam<std::tuple<Compression::type, bool>> {
+ public:
+  void SetUp() {
+    compression_ = std::get<0>(GetParam());
+    read_options_.use_threads = std::get<1>(GetParam());
+    write_options_.compression = compression_;
+    write_options_.allow_non_interoperable_compression = true;
+
+    std::unique_ptr<util::Codec> codec;
+    Status st = util::Codec::Create(compression_, &codec);
+    if (st.IsNotImplemented()) {
+      skip_ = true;
+    } else {
+      ASSERT_OK(st);
+    }
+  }
+
+  Status WriteStream(const BatchVector& batches, std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(0, &buffer));
+    io::BufferOutputStream sink(buffer);
+    std::shared_ptr<RecordBatchWriter> writer;
+    RETURN_NOT_OK(RecordBatchStreamWriter::Open(&sink, batches[0]->schema(),
+                                                write_options_, &writer));
+    for (const auto& batch : batches) {
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer->Close());
+    RETURN_NOT_OK(sink.Close());
+    *out = buffer;
+    return Status::OK();
+  }
+
+  Status WriteFile(const BatchVector& batches, std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(0, &buffer));
+    io::BufferOutputStream sink(buffer);
+    std::shared_ptr<RecordBatchWriter> writer;
+    RETURN_NOT_OK(RecordBatchFileWriter::Open(&sink, batches[0]->schema(),
+                                              write_options_, &writer));
+    for (const auto& batch : batches) {
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer->Close());
+    RETURN_NOT_OK(sink.Close());
+    *out = buffer;
+    return Status::OK();
+  }
+
+  void CheckRoundTrip(const BatchVector& in_batches) {
+    std::shared_ptr<Buffer> buffer;
+
+    // Stream format
+    ASSERT_OK(WriteStream(in_batches, &buffer));
+    std::shared_ptr<RecordBatchReader> stream_reader;
+    ASSERT_OK(RecordBatchStreamReader::Open(std::make_shared<io::BufferReader>(buffer),
+                                            read_options_, &stream_reader));
+    BatchVector out_batches;
+    ASSERT_OK(stream_reader->ReadAll(&out_batches));
+    ASSERT_EQ(out_batches.size(), in_batches.size());
+    for (size_t i = 0; i < in_batches.size(); ++i) {
+      CompareBatch(*in_batches[i], *out_batches[i]);
+    }
+
+    // File format
+    ASSERT_OK(WriteFile(in_batches, &buffer));
+    std::shared_ptr<RecordBatchFileReader> file_reader;
+    ASSERT_OK(RecordBatchFileReader::Open(std::make_shared<io::BufferReader>(buffer),
+                                          read_options_, &file_reader));
+    ASSERT_EQ(file_reader->num_record_batches(), static_cast<int>(in_batches.size()));
+    for (int i = 0; i < file_reader->num_record_batches(); ++i) {
+      std::shared_ptr<RecordBatch> batch;
+      ASSERT_OK(file_reader->ReadRecordBatch(i, &batch));
+      CompareBatch(*in_batches[i], *batch);
+    }
+  }
+
+ protected:
+  Compression::type compression_;
+  IpcWriteOptions write_options_ = IpcWriteOptions::Defaults();
+  IpcReadOptions read_options_ = IpcReadOptions::Defaults();
+  bool skip_ = false;
+};
+
+TEST_P(TestBodyCompression, RoundTrip) {
+  if (skip_) {
+    return;
+  }
+  for (auto make_batch : {&MakeIntRecordBatch, &MakeListRecordBatch, &MakeStruct,
+                          &MakeNonNullRecordBatch, &MakeZeroLengthRecordBatch}) {
+    std::shared_ptr<RecordBatch> batch1, batch2;
+    ASSERT_OK(make_batch(&batch1));
+    ASSERT_OK(make_batch(&batch2));
+    CheckRoundTrip({batch1, batch2});
+  }
+}
+
+TEST_P(TestBodyCompression, DictionaryRoundTrip) {
+  if (skip_) {
+    return;
+  }
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionary(&batch));
+  CheckRoundTrip({batch});
+}
+
+TEST_P(TestBodyCompression, Incompressible) {
+  if (skip_) {
+    return;
+  }
+  // Tiny buffers don't shrink when compressed and are stored as-is
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(3, &batch));
+  CheckRoundTrip({batch});
+}
+
+TEST_P(TestBodyCompression, CompressedSizeIsSmaller) {
+  if (skip_) {
+    return;
+  }
+  auto schema = ::arrow::schema({field("f0", int32())});
+  std::vector<int32_t> values(1 << 16, 42);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int32Type, int32_t>(values, &array);
+  auto batch = RecordBatch::Make(schema, array->length(), {array});
+
+  std::shared_ptr<Buffer> compressed;
+  ASSERT_OK(WriteStream({batch}, &compressed));
+  write_options_.compression = Compression::UNCOMPRESSED;
+  std::shared_ptr<Buffer> uncompressed;
+  ASSERT_OK(WriteStream({batch}, &uncompressed));
+  ASSERT_LT(compressed->size(), uncompressed->size());
+}
+
+TEST_P(TestBodyCompression, ReadMemoryPool) {
+  if (skip_) {
+    return;
+  }
+  auto schema = ::arrow::schema({field("f0", int32())});
+  std::vector<int32_t> values(1 << 16, 42);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int32Type, int32_t>(values, &array);
+  auto batch = RecordBatch::Make(schema, array->length(), {array});
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(WriteStream({batch}, &buffer));
+  ProxyMemoryPool pool(default_memory_pool());
+  read_options_.memory_pool = &pool;
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(std::make_shared<io::BufferReader>(buffer),
+                                          read_options_, &reader));
+  std::shared_ptr<RecordBatch> out_batch;
+  ASSERT_OK(reader->ReadNext(&out_batch));
+  CompareBatch(*batch, *out_batch);
+  // The decompressed values are allocated from the given pool
+  ASSERT_GE(pool.bytes_allocated(),
+            static_cast<int64_t>(values.size() * sizeof(int32_t)));
+}
+
+TEST_P(TestBodyCompression, ReadFromCpuPoolTasks) {
+  if (skip_) {
+    return;
+  }
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeListRecordBatch(&batch));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(WriteStream({batch}, &buffer));
+
+  // Decompressing in parallel must not deadlock when all CPU pool threads
+  // are busy reading
+  auto thread_pool = ::arrow::internal::GetCpuThreadPool();
+  std::vector<std::future<Status>> reads;
+  for (int i = 0; i < thread_pool->GetCapacity(); ++i) {
+    reads.push_back(thread_pool->Submit([&]() -> Status {
+      std::shared_ptr<RecordBatchReader> reader;
+      RETURN_NOT_OK(RecordBatchStreamReader::Open(
+          std::make_shared<io::BufferReader>(buffer), read_options_, &reader));
+      BatchVector out_batches;
+      RETURN_NOT_OK(reader->ReadAll(&out_batches));
+      if (out_batches.size() != 1 || !out_batches[0]->Equals(*batch)) {
+        return Status::Invalid("Unexpected batches read");
+      }
+      return Status::OK();
+    }));
+  }
+  for (auto& read : reads) {
+    ASSERT_OK(read.get());
+  }
+}
+
+TEST_P(TestBodyCompression, RequiresOptIn) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  write_options_.allow_non_interoperable_compression = false;
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_RAISES(Invalid, WriteStream({batch}, &buffer));
+  ASSERT_RAISES(Invalid, WriteFile({batch}, &buffer));
+  internal::IpcPayload payload;
+  ASSERT_RAISES(Invalid, internal::GetRecordBatchPayload(
+                             *batch, write_options_, default_memory_pool(), &payload));
+}
+
+INSTANTIATE_TEST_CASE_P(
+    BodyCompressionTests, TestBodyCompression,
+    ::testing::Combine(::testing::Values(Compression::LZ4, Compression::ZSTD,
+                                         Compression::SNAPPY, Compression::GZIP),
+                       ::testing::Bool()));
+
+// ----------------------------------------------------------------------
+// Field projection
+
+// A BufferReader recording the number of bytes requested through ReadAt
+class TrackedBufferReader : public io::BufferReader {
+ public:
+  explicit TrackedBufferReader(const std::shared_ptr<Buffer>& buffer)
+      : io::BufferReader(buffer) {}
+
+  using io::BufferReader::ReadAt;
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    ++num_reads_;
+    bytes_read_ += nbytes;
+    return io::BufferReader::ReadAt(position, nbytes, out);
+  }
+
+  int64_t num_reads_ = 0;
+  int64_t bytes_read_ = 0;
+};
+
+class TestFieldProjection : public ::testing::Test {
+ public:
+  void SetUp() {
+    const int64_t length = 1000;
+    std::shared_ptr<Array> a0, a1, a2, a3, values;
+    ASSERT_OK(MakeRandomInt32Array(length, true, default_memory_pool(), &a0));
+    ASSERT_OK(MakeRandomStringArray(length, true, default_memory_pool(), &a1));
+    ASSERT_OK(MakeRandomInt32Array(length * 2, true, default_memory_pool(), &values));
+    ASSERT_OK(MakeRandomListArray(values, length, true, default_memory_pool(), &a2));
+    ASSERT_OK(MakeRandomInt32Array(length, false, default_memory_pool(), &a3, 1));
+
+    auto schema =
+        ::arrow::schema({field("f0", a0->type()), field("f1", a1->type()),
+                         field("f2", a2->type()), field("f3", a3->type())},
+                        key_value_metadata({"key"}, {"value"}));
+    batch_ = RecordBatch::Make(schema, length, {a0, a1, a2, a3});
+  }
+
+  Status WriteBatches(bool file_format, const IpcWriteOptions& write_options) {
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(0, &buffer));
+    io::BufferOutputStream sink(buffer);
+    std::shared_ptr<RecordBatchWriter> writer;
+    if (file_format) {
+      RETURN_NOT_OK(
+          RecordBatchFileWriter::Open(&sink, batch_->schema(), write_options, &writer));
+    } else {
+      RETURN_NOT_OK(
+          RecordBatchStreamWriter::Open(&sink, batch_->schema(), write_options, &writer));
+    }
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch_));
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch_));
+    RETURN_NOT_OK(writer->Close());
+    RETURN_NOT_OK(sink.Close());
+    buffer_ = buffer;
+    return Status::OK();
+  }
+
+  void CheckProjection(
+      const std::vector<int>& included_fields, const std::vector<int>& expected_fields,
+      const IpcWriteOptions& write_options = IpcWriteOptions::Defaults()) {
+    auto read_options = IpcReadOptions::Defaults();
+    read_options.included_fields = included_fields;
+
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i : expected_fields) {
+      fields.push_back(batch_->schema()->field(i));
+      columns.push_back(batch_->column(i));
+    }
+    auto expected_schema = ::arrow::schema(fields, batch_->schema()->metadata());
+    auto expected = RecordBatch::Make(expected_schema, batch_->num_rows(), columns);
+
+    // Stream format
+    ASSERT_OK(WriteBatches(false, write_options));
+    std::shared_ptr<RecordBatchReader> stream_reader;
+    ASSERT_OK(RecordBatchStreamReader::Open(std::make_shared<io::BufferReader>(buffer_),
+                                            read_options, &stream_reader));
+    AssertSchemaEqual(*expected_schema, *stream_reader->schema());
+    BatchVector batches;
+    ASSERT_OK(stream_reader->ReadAll(&batches));
+    ASSERT_EQ(batches.size(), 2);
+    for (const auto& batch : batches) {
+      CompareBatch(*expected, *batch);
+    }
+
+    // File format
+    ASSERT_OK(WriteBatches(true, write_options));
+    std::shared_ptr<RecordBatchFileReader> file_reader;
+    ASSERT_OK(RecordBatchFileReader::Open(std::make_shared<io::BufferReader>(buffer_),
+                                          read_options, &file_reader));
+    AssertSchemaEqual(*expected_schema, *file_reader->schema());
+    ASSERT_EQ(file_reader->num_record_batches(), 2);
+    for (int i = 0; i < 2; ++i) {
+      std::shared_ptr<RecordBatch> batch;
+      ASSERT_OK(file_reader->ReadRecordBatch(i, &batch));
+      CompareBatch(*expected, *batch);
+    }
+  }
+
+ protected:
+  std::shared_ptr<RecordBatch> batch_;
+  std::shared_ptr<Buffer> buffer_;
+};
+
+TEST_F(TestFieldProjection, SelectFields) {
+  CheckProjection({}, {0, 1, 2, 3});
+  CheckProjection({2}, {2});
+  CheckProjection({3, 0}, {0, 3});
+  CheckProjection({1, 1, 2}, {1, 2});
+  CheckProjection({0, 1, 2, 3}, {0, 1, 2, 3});
+}
+
+TEST_F(TestFieldProjection, DictionaryFields) {
+  // Dictionary ids and body buffers of skipped fields must not shift the
+  // dictionaries or buffers of selected ones
+  ASSERT_OK(MakeDictionary(&batch_));
+  for (int i = 0; i < batch_->num_columns(); ++i) {
+    CheckProjection({i}, {i});
+  }
+  CheckProjection({4, 0}, {0, 4});
+  CheckProjection({1, 3}, {1, 3});
+}
+
+TEST_F(TestFieldProjection, NestedFields) {
+  std::vector<std::function<Status(std::shared_ptr<RecordBatch>*)>> makers = {
+      &MakeStruct, &MakeUnion, &MakeListRecordBatch, &MakeDeeplyNestedList};
+  for (const auto& make_batch : makers) {
+    ASSERT_OK(make_batch(&batch_));
+    for (int i = 0; i < batch_->num_columns(); ++i) {
+      CheckProjection({i}, {i});
+    }
+    if (batch_->num_columns() > 1) {
+      CheckProjection({batch_->num_columns() - 1, 0}, {0, batch_->num_columns() - 1});
+    }
+  }
+}
+
+TEST_F(TestFieldProjection, DictionaryInsideNestedField) {
+  std::shared_ptr<RecordBatch> dict_batch;
+  ASSERT_OK(MakeDictionary(&dict_batch));
+  const int64_t length = dict_batch->num_rows();
+
+  // struct<dictionary, list<dictionary>, dictionary<list>> between two flat columns
+  std::vector<std::shared_ptr<Field>> struct_fields = {
+      dict_batch->schema()->field(1), dict_batch->schema()->field(3),
+      dict_batch->schema()->field(4)};
+  auto struct_type = struct_(struct_fields);
+  std::shared_ptr<Array> a0, a1, a2;
+  ASSERT_OK(MakeRandomInt32Array(length, true, default_memory_pool(), &a0));
+  a1 = std::make_shared<StructArray>(
+      struct_type, length,
+      ArrayVector{dict_batch->column(1), dict_batch->column(3), dict_batch->column(4)});
+  ASSERT_OK(MakeRandomStringArray(length, true, default_memory_pool(), &a2));
+  auto schema = ::arrow::schema(
+      {field("f0", a0->type()), field("f1", struct_type), field("f2", a2->type())});
+  batch_ = RecordBatch::Make(schema, length, {a0, a1, a2});
+
+  CheckProjection({1}, {1});
+  CheckProjection({2}, {2});
+  CheckProjection({2, 0}, {0, 2});
+  CheckProjection({2, 1}, {1, 2});
+}
+
+TEST_F(TestFieldProjection, Compressed) {
+  auto write_options = IpcWriteOptions::Defaults();
+  write_options.compression = Compression::ZSTD;
+  write_options.allow_non_interoperable_compression = true;
+  std::unique_ptr<util::Codec> codec;
+  if (util::Codec::Create(write_options.compression, &codec).IsNotImplemented()) {
+    return;
+  }
+  CheckProjection({3, 1}, {1, 3}, write_options);
+}
+
+TEST_F(TestFieldProjection, InvalidIndex) {
+  ASSERT_OK(WriteBatches(true, IpcWriteOptions::Defaults()));
+  auto read_options = IpcReadOptions::Defaults();
+  read_options.included_fields = {4};
+  std::shared_ptr<RecordBatchFileReader> file_reader;
+  ASSERT_RAISES(Invalid,
+                RecordBatchFileReader::Open(std::make_shared<io::BufferReader>(buffer_),
+                                            read_options, &file_reader));
+}
+
+TEST_F(TestFieldProjection, FileReadsOnlySelectedBuffers) {
+  ASSERT_OK(WriteBatches(true, IpcWriteOptions::Defaults()));
+
+  auto read_batch = [&](const std::vector<int>& included_fields, int64_t* bytes_read,
+                        int64_t* num_reads) {
+    auto read_options = IpcReadOptions::Defaults();
+    read_options.included_fields = included_fields;
+    auto file = std::make_shared<TrackedBufferReader>(buffer_);
+    std::shared_ptr<RecordBatchFileReader> file_reader;
+    ASSERT_OK(RecordBatchFileReader::Open(file, read_options, &file_reader));
+    const int64_t bytes_before = file->bytes_read_;
+    const int64_t reads_before = file->num_reads_;
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(file_reader->ReadRecordBatch(0, &batch));
+    *bytes_read = file->bytes_read_ - bytes_before;
+    *num_reads = file->num_reads_ - reads_before;
+  };
+
+  int64_t all_bytes, all_reads, one_bytes, one_reads;
+  read_batch({}, &all_bytes, &all_reads);
+  read_batch({3}, &one_bytes, &one_reads);
+
+  // Metadata plus the int32 values of f3 (no nulls, so no validity bitmap)
+  ASSERT_LT(one_bytes, all_bytes / 4);
+  ASSERT_GE(one_bytes, batch_->num_rows() * 4);
+  // Metadata, then a single coalesced read for the body buffers
+  ASSERT_EQ(one_reads, 2);
+}
+
 class TestTensorRoundTrip : public ::testing::Test, public IpcTestFixture {
  public:
   void SetUp() { pool_ = default_memory_pool(); }
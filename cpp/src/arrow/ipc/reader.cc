@@ -17,6 +17,7 @@
 
 #include "arrow/ipc/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <sstream>
@@ -37,12 +38,17 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata-internal.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
 #include "arrow/visitor_inline.h"
 
 using arrow::internal::checked_pointer_cast;
@@ -88,16 +94,129 @@ Status InvalidMessageType(Message::Type expected, Message::Type actual) {
 
 }  // namespace
 
+IpcReadOptions IpcReadOptions::Defaults() { return IpcReadOptions(); }
+
 // ----------------------------------------------------------------------
 // Record batch read path
 
+// Undo the body buffer compression applied by the writer: a non-empty buffer
+// is prefixed by its uncompressed length, or -1 if it was stored as-is
+static Status DecompressBuffer(util::Codec* codec, MemoryPool* pool,
+                               std::shared_ptr<Buffer>* buffer) {
+  if (*buffer == nullptr || (*buffer)->size() == 0) {
+    return Status::OK();
+  }
+  const int64_t prefix_length = sizeof(int64_t);
+  const int64_t compressed_length = (*buffer)->size() - prefix_length;
+  if (compressed_length < 0) {
+    return Status::IOError("Compressed IPC body buffer is too short");
+  }
+
+  int64_t uncompressed_length;
+  std::memcpy(&uncompressed_length, (*buffer)->data(), prefix_length);
+  uncompressed_length = BitUtil::FromLittleEndian(uncompressed_length);
+  if (uncompressed_length == -1) {
+    *buffer = SliceBuffer(*buffer, prefix_length, compressed_length);
+    return Status::OK();
+  }
+  if (uncompressed_length < 0) {
+    return Status::IOError("Invalid uncompressed length in IPC body buffer: ",
+                           uncompressed_length);
+  }
+
+  std::shared_ptr<Buffer> result;
+  RETURN_NOT_OK(AllocateBuffer(pool, uncompressed_length, &result));
+  int64_t actual_length = 0;
+  RETURN_NOT_OK(codec->Decompress(compressed_length, (*buffer)->data() + prefix_length,
+                                  uncompressed_length, result->mutable_data(),
+                                  &actual_length));
+  if (actual_length != uncompressed_length) {
+    return Status::IOError("IPC body buffer decompressed to ", actual_length,
+                           " bytes, expected ", uncompressed_length);
+  }
+  *buffer = result;
+  return Status::OK();
+}
+
 /// Accessor class for flatbuffers metadata
+///
+/// Buffer offsets in the metadata are relative to the start of the message
+/// body, which is found at body_offset in the file
 class IpcComponentSource {
  public:
-  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
-      : metadata_(metadata), file_(file) {}
+  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file,
+                     int64_t body_offset = 0)
+      : metadata_(metadata), file_(file), body_offset_(body_offset) {}
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
+    if (!buffers_.empty()) {
+      *out = buffers_[buffer_index];
+      return Status::OK();
+    }
+    return ReadBuffer(buffer_index, out);
+  }
+
+  /// Read the given body buffers ahead of loading, in a single
+  /// RandomAccessFile::ReadRanges call so that nearby buffers are coalesced.
+  /// Buffers not listed are never read.
+  Status ReadBuffers(const std::vector<int>& buffer_indices) {
+    auto fb_buffers = metadata_->buffers();
+    buffers_.assign(fb_buffers->size(), nullptr);
+
+    std::vector<int> read_indices;
+    std::vector<io::ReadRange> ranges;
+    for (int i : buffer_indices) {
+      const flatbuf::Buffer* buffer = fb_buffers->Get(i);
+      if (buffer->length() > 0) {
+        read_indices.push_back(i);
+        ranges.push_back({body_offset_ + buffer->offset(), buffer->length()});
+      }
+    }
+
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    RETURN_NOT_OK(file_->ReadRanges(ranges, &buffers));
+    for (size_t i = 0; i < read_indices.size(); ++i) {
+      if (buffers[i]->size() < ranges[i].length) {
+        return Status::IOError("Expected to be able to read ", ranges[i].length,
+                               " bytes for body buffer ", read_indices[i], ", got ",
+                               buffers[i]->size());
+      }
+      buffers_[read_indices[i]] = std::move(buffers[i]);
+    }
+    return Status::OK();
+  }
+
+  /// Read and decompress the given body buffers up front, optionally spreading
+  /// the decompression over the CPU thread pool
+  Status DecompressBuffers(Compression::type compression, const IpcReadOptions& options,
+                           const std::vector<int>& buffer_indices) {
+    RETURN_NOT_OK(ReadBuffers(buffer_indices));
+
+    if (!options.use_threads) {
+      std::unique_ptr<util::Codec> codec;
+      RETURN_NOT_OK(util::Codec::Create(compression, &codec));
+      for (int i : buffer_indices) {
+        RETURN_NOT_OK(DecompressBuffer(codec.get(), options.memory_pool, &buffers_[i]));
+      }
+      return Status::OK();
+    }
+    // A task group rather than ParallelFor(), as its Finish() runs pending
+    // tasks itself, so reading from a CPU pool task doesn't deadlock
+    auto task_group =
+        ::arrow::internal::TaskGroup::MakeThreaded(::arrow::internal::GetCpuThreadPool());
+    MemoryPool* pool = options.memory_pool;
+    for (int i : buffer_indices) {
+      task_group->Append([this, compression, pool, i]() -> Status {
+        // Codecs are not necessarily thread-safe, use one per task
+        std::unique_ptr<util::Codec> codec;
+        RETURN_NOT_OK(util::Codec::Create(compression, &codec));
+        return DecompressBuffer(codec.get(), pool, &buffers_[i]);
+      });
+    }
+    return task_group->Finish();
+  }
+
+  Status ReadBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
     const flatbuf::Buffer* buffer = metadata_->buffers()->Get(buffer_index);
 
     if (buffer->length() == 0) {
@@ -107,7 +226,7 @@ class IpcComponentSource {
       DCHECK(BitUtil::IsMultipleOf8(buffer->offset()))
           << "Buffer " << buffer_index
           << " did not start on 8-byte aligned offset: " << buffer->offset();
-      return file_->ReadAt(buffer->offset(), buffer->length(), out);
+      return file_->ReadAt(body_offset_ + buffer->offset(), buffer->length(), out);
     }
   }
 
@@ -128,6 +247,10 @@ class IpcComponentSource {
  private:
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  int64_t body_offset_;
+
+  // Non-empty if the body buffers were read ahead of loading
+  std::vector<std::shared_ptr<Buffer>> buffers_;
 };
 
 /// Bookkeeping struct for loading array objects from their constituent pieces of raw data
@@ -140,6 +263,8 @@ struct ArrayLoaderContext {
   int buffer_index;
   int field_index;
   int max_recursion_depth;
+  // If true, only advance the indices without fetching any buffers
+  bool skip_buffers;
 };
 
 static Status LoadArray(const std::shared_ptr<DataType>& type,
@@ -163,6 +288,10 @@ class ArrayLoader {
   }
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
+    if (context_->skip_buffers) {
+      out->reset();
+      return Status::OK();
+    }
     return context_->source->GetBuffer(buffer_index, out);
   }
 
@@ -328,8 +457,49 @@ Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& sc
 // ----------------------------------------------------------------------
 // Array loading
 
+// Sorted, deduplicated indices of the top-level fields selected by the options
+static Status GetIncludedFields(const Schema& schema, const IpcReadOptions& options,
+                                std::vector<int>* out) {
+  out->clear();
+  if (options.included_fields.empty()) {
+    for (int i = 0; i < schema.num_fields(); ++i) {
+      out->push_back(i);
+    }
+    return Status::OK();
+  }
+  for (int i : options.included_fields) {
+    if (i < 0 || i >= schema.num_fields()) {
+      return Status::Invalid("Out of bounds field index: ", i, " for schema with ",
+                             schema.num_fields(), " fields");
+    }
+    out->push_back(i);
+  }
+  std::sort(out->begin(), out->end());
+  out->erase(std::unique(out->begin(), out->end()), out->end());
+  return Status::OK();
+}
+
+static Status GetProjectedSchema(const std::shared_ptr<Schema>& schema,
+                                 const IpcReadOptions& options,
+                                 std::shared_ptr<Schema>* out) {
+  if (options.included_fields.empty()) {
+    *out = schema;
+    return Status::OK();
+  }
+  std::vector<int> included_fields;
+  RETURN_NOT_OK(GetIncludedFields(*schema, options, &included_fields));
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int i : included_fields) {
+    fields.push_back(schema->field(i));
+  }
+  *out = ::arrow::schema(std::move(fields), schema->metadata());
+  return Status::OK();
+}
+
 static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
                                         int64_t num_rows, int max_recursion_depth,
+                                        Compression::type compression,
+                                        const IpcReadOptions& options,
                                         IpcComponentSource* source,
                                         std::shared_ptr<RecordBatch>* out) {
   ArrayLoaderContext context;
@@ -337,31 +507,83 @@ static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
   context.field_index = 0;
   context.buffer_index = 0;
   context.max_recursion_depth = max_recursion_depth;
+  context.skip_buffers = false;
+
+  const bool project = !options.included_fields.empty();
+  const bool compressed = compression != Compression::UNCOMPRESSED;
+
+  std::vector<int> included_fields;
+  RETURN_NOT_OK(GetIncludedFields(*schema, options, &included_fields));
+
+  // Where each top-level field starts in the field nodes and body buffers
+  std::vector<int> field_starts(schema->num_fields() + 1);
+  std::vector<int> buffer_starts(schema->num_fields() + 1);
+
+  if (project || compressed) {
+    // Walk all the fields without I/O to find the buffers to fetch ahead
+    context.skip_buffers = true;
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      field_starts[i] = context.field_index;
+      buffer_starts[i] = context.buffer_index;
+      ArrayData dummy;
+      RETURN_NOT_OK(LoadArray(schema->field(i)->type(), &context, &dummy));
+    }
+    field_starts[schema->num_fields()] = context.field_index;
+    buffer_starts[schema->num_fields()] = context.buffer_index;
+    context.skip_buffers = false;
+
+    std::vector<int> buffer_indices;
+    for (int i : included_fields) {
+      for (int j = buffer_starts[i]; j < buffer_starts[i + 1]; ++j) {
+        buffer_indices.push_back(j);
+      }
+    }
+    if (compressed) {
+      RETURN_NOT_OK(
+          source->DecompressBuffers(compression, options, buffer_indices));
+    } else {
+      RETURN_NOT_OK(source->ReadBuffers(buffer_indices));
+    }
+    context.field_index = 0;
+    context.buffer_index = 0;
+  }
 
-  std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
-  for (int i = 0; i < schema->num_fields(); ++i) {
+  std::vector<std::shared_ptr<ArrayData>> arrays;
+  arrays.reserve(included_fields.size());
+  for (int i : included_fields) {
+    if (project) {
+      context.field_index = field_starts[i];
+      context.buffer_index = buffer_starts[i];
+    }
     auto arr = std::make_shared<ArrayData>();
     RETURN_NOT_OK(LoadArray(schema->field(i)->type(), &context, arr.get()));
     DCHECK_EQ(num_rows, arr->length) << "Array length did not match record batch length";
-    arrays[i] = std::move(arr);
+    arrays.push_back(std::move(arr));
   }
 
-  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  std::shared_ptr<Schema> out_schema;
+  RETURN_NOT_OK(GetProjectedSchema(schema, options, &out_schema));
+  *out = RecordBatch::Make(out_schema, num_rows, std::move(arrays));
   return Status::OK();
 }
 
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
-                                     int max_recursion_depth, io::RandomAccessFile* file,
+                                     int max_recursion_depth,
+                                     Compression::type compression,
+                                     const IpcReadOptions& options,
+                                     io::RandomAccessFile* file, int64_t body_offset,
                                      std::shared_ptr<RecordBatch>* out) {
-  IpcComponentSource source(metadata, file);
+  IpcComponentSource source(metadata, file, body_offset);
   return LoadRecordBatchFromSource(schema, metadata->length(), max_recursion_depth,
-                                   &source, out);
+                                   compression, options, &source, out);
 }
 
-Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
-                       int max_recursion_depth, io::RandomAccessFile* file,
-                       std::shared_ptr<RecordBatch>* out) {
+static Status ReadRecordBatch(const Buffer& metadata,
+                              const std::shared_ptr<Schema>& schema,
+                              int max_recursion_depth, const IpcReadOptions& options,
+                              io::RandomAccessFile* file, int64_t body_offset,
+                              std::shared_ptr<RecordBatch>* out) {
   auto message = flatbuf::GetMessage(metadata.data());
   if (message->header_type() != flatbuf::MessageHeader_RecordBatch) {
     DCHECK_EQ(message->header_type(), flatbuf::MessageHeader_RecordBatch);
@@ -369,16 +591,34 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
   if (message->header() == nullptr) {
     return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
   }
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetBodyCompression(message, &compression));
   auto batch = reinterpret_cast<const flatbuf::RecordBatch*>(message->header());
-  return ReadRecordBatch(batch, schema, max_recursion_depth, file, out);
+  return ReadRecordBatch(batch, schema, max_recursion_depth, compression, options, file,
+                         body_offset, out);
+}
+
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       int max_recursion_depth, io::RandomAccessFile* file,
+                       std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatch(metadata, schema, max_recursion_depth,
+                         IpcReadOptions::Defaults(), file, 0, out);
+}
+
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       const IpcReadOptions& options, io::RandomAccessFile* file,
+                       std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatch(metadata, schema, kMaxNestingDepth, options, file, 0, out);
 }
 
 Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionary_types,
-                      io::RandomAccessFile* file, int64_t* dictionary_id,
-                      std::shared_ptr<Array>* out) {
+                      const IpcReadOptions& options, io::RandomAccessFile* file,
+                      int64_t* dictionary_id, std::shared_ptr<Array>* out) {
   auto message = flatbuf::GetMessage(metadata.data());
   auto dictionary_batch =
       reinterpret_cast<const flatbuf::DictionaryBatch*>(message->header());
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetBodyCompression(message, &compression));
 
   int64_t id = *dictionary_id = dictionary_batch->id();
   auto it = dictionary_types.find(id);
@@ -391,12 +631,16 @@ Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionar
   // We need a schema for the record batch
   auto dummy_schema = std::make_shared<Schema>(fields);
 
+  // Field projection applies to record batches, not to dictionaries
+  IpcReadOptions dictionary_options = options;
+  dictionary_options.included_fields.clear();
+
   // The dictionary is embedded in a record batch with a single column
   std::shared_ptr<RecordBatch> batch;
   auto batch_meta =
       reinterpret_cast<const flatbuf::RecordBatch*>(dictionary_batch->data());
-  RETURN_NOT_OK(
-      ReadRecordBatch(batch_meta, dummy_schema, kMaxNestingDepth, file, &batch));
+  RETURN_NOT_OK(ReadRecordBatch(batch_meta, dummy_schema, kMaxNestingDepth, compression,
+                                dictionary_options, file, 0, &batch));
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
@@ -435,9 +679,12 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
   RecordBatchStreamReaderImpl() {}
   ~RecordBatchStreamReaderImpl() {}
 
-  Status Open(std::unique_ptr<MessageReader> message_reader) {
+  Status Open(std::unique_ptr<MessageReader> message_reader,
+              const IpcReadOptions& options) {
     message_reader_ = std::move(message_reader);
-    return ReadSchema();
+    options_ = options;
+    RETURN_NOT_OK(ReadSchema());
+    return GetProjectedSchema(schema_, options_, &projected_schema_);
   }
 
   Status ReadNextDictionary() {
@@ -455,8 +702,8 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
 
     std::shared_ptr<Array> dictionary;
     int64_t id;
-    RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_types_, &reader, &id,
-                                 &dictionary));
+    RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_types_, options_,
+                                 &reader, &id, &dictionary));
     return dictionary_memo_.AddDictionary(id, dictionary);
   }
 
@@ -497,18 +744,22 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
 
     CHECK_HAS_BODY(*message);
     io::BufferReader reader(message->body());
-    return ReadRecordBatch(*message->metadata(), schema_, &reader, batch);
+    // Unselected fields are skipped without touching their buffers
+    return ReadRecordBatch(*message->metadata(), schema_, options_, &reader, batch);
   }
 
-  std::shared_ptr<Schema> schema() const { return schema_; }
+  std::shared_ptr<Schema> schema() const { return projected_schema_; }
 
  private:
   std::unique_ptr<MessageReader> message_reader_;
+  IpcReadOptions options_;
 
   // dictionary_id -> type
   DictionaryTypeMap dictionary_types_;
   DictionaryMemo dictionary_memo_;
   std::shared_ptr<Schema> schema_;
+  // The schema of the batches returned, after field projection
+  std::shared_ptr<Schema> projected_schema_;
 };
 
 RecordBatchStreamReader::RecordBatchStreamReader() {
@@ -519,9 +770,15 @@ RecordBatchStreamReader::~RecordBatchStreamReader() {}
 
 Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
                                      std::shared_ptr<RecordBatchReader>* reader) {
+  return Open(std::move(message_reader), IpcReadOptions::Defaults(), reader);
+}
+
+Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
+                                     const IpcReadOptions& options,
+                                     std::shared_ptr<RecordBatchReader>* reader) {
   // Private ctor
   auto result = std::shared_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
-  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader), options));
   *reader = result;
   return Status::OK();
 }
@@ -530,7 +787,8 @@ Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_read
                                      std::unique_ptr<RecordBatchReader>* reader) {
   // Private ctor
   auto result = std::unique_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
-  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
+  RETURN_NOT_OK(
+      result->impl_->Open(std::move(message_reader), IpcReadOptions::Defaults()));
   *reader = std::move(result);
   return Status::OK();
 }
@@ -545,6 +803,12 @@ Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& str
   return Open(MessageReader::Open(stream), out);
 }
 
+Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& stream,
+                                     const IpcReadOptions& options,
+                                     std::shared_ptr<RecordBatchReader>* out) {
+  return Open(MessageReader::Open(stream), options, out);
+}
+
 std::shared_ptr<Schema> RecordBatchStreamReader::schema() const {
   return impl_->schema();
 }
@@ -623,6 +887,15 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     DCHECK(BitUtil::IsMultipleOf8(block.metadata_length));
     DCHECK(BitUtil::IsMultipleOf8(block.body_length));
 
+    if (!options_.included_fields.empty()) {
+      // Only read the selected buffers of the body, straight from the file
+      std::shared_ptr<Buffer> metadata;
+      RETURN_NOT_OK(ReadMessageMetadata(block, &metadata));
+      return ::arrow::ipc::ReadRecordBatch(*metadata, schema_, kMaxNestingDepth, options_,
+                                           file_, block.offset + block.metadata_length,
+                                           batch);
+    }
+
     std::unique_ptr<Message> message;
     RETURN_NOT_OK(ReadMessage(block.offset, block.metadata_length, file_, &message));
 
@@ -630,7 +903,31 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     // DCHECK_EQ(message->body_length(), block.body_length);
 
     io::BufferReader reader(message->body());
-    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &reader, batch);
+    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, options_, &reader,
+                                         batch);
+  }
+
+  // Read the flatbuffer metadata of a message, but not its body
+  Status ReadMessageMetadata(const FileBlock& block, std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(file_->ReadAt(block.offset, block.metadata_length, &buffer));
+    if (buffer->size() < block.metadata_length) {
+      return Status::Invalid("Expected to read ", block.metadata_length,
+                             " metadata bytes but got ", buffer->size());
+    }
+    int32_t flatbuffer_size = *reinterpret_cast<const int32_t*>(buffer->data());
+    if (flatbuffer_size + static_cast<int>(sizeof(int32_t)) > block.metadata_length) {
+      return Status::Invalid("flatbuffer size ", flatbuffer_size,
+                             " invalid. File offset: ", block.offset,
+                             ", metadata length: ", block.metadata_length);
+    }
+    auto metadata = SliceBuffer(buffer, 4, buffer->size() - 4);
+
+    std::unique_ptr<Message> message;
+    RETURN_NOT_OK(Message::Open(metadata, nullptr, &message));
+    CHECK_MESSAGE_TYPE(Message::RECORD_BATCH, message->type());
+    *out = metadata;
+    return Status::OK();
   }
 
   Status ReadSchema() {
@@ -654,34 +951,40 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
       std::shared_ptr<Array> dictionary;
       int64_t dictionary_id;
-      RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_fields_, &reader,
-                                   &dictionary_id, &dictionary));
+      RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_fields_, options_,
+                                   &reader, &dictionary_id, &dictionary));
       RETURN_NOT_OK(dictionary_memo_->AddDictionary(dictionary_id, dictionary));
     }
 
     // Get the schema
-    return internal::GetSchema(footer_->schema(), *dictionary_memo_, &schema_);
+    RETURN_NOT_OK(internal::GetSchema(footer_->schema(), *dictionary_memo_, &schema_));
+    return GetProjectedSchema(schema_, options_, &projected_schema_);
   }
 
-  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset) {
+  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
+              const IpcReadOptions& options) {
     owned_file_ = file;
-    return Open(file.get(), footer_offset);
+    return Open(file.get(), footer_offset, options);
   }
 
-  Status Open(io::RandomAccessFile* file, int64_t footer_offset) {
+  Status Open(io::RandomAccessFile* file, int64_t footer_offset,
+              const IpcReadOptions& options) {
     file_ = file;
     footer_offset_ = footer_offset;
+    options_ = options;
     RETURN_NOT_OK(ReadFooter());
     return ReadSchema();
   }
 
-  std::shared_ptr<Schema> schema() const { return schema_; }
+  std::shared_ptr<Schema> schema() const { return projected_schema_; }
 
  private:
   io::RandomAccessFile* file_;
 
   std::shared_ptr<io::RandomAccessFile> owned_file_;
 
+  IpcReadOptions options_;
+
   // The location where the Arrow file layout ends. May be the end of the file
   // or some other location if embedded in a larger file.
   int64_t footer_offset_;
@@ -695,6 +998,8 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
+  // The schema of the batches returned, after field projection
+  std::shared_ptr<Schema> projected_schema_;
 };
 
 RecordBatchFileReader::RecordBatchFileReader() {
@@ -713,7 +1018,7 @@ Status RecordBatchFileReader::Open(io::RandomAccessFile* file,
 Status RecordBatchFileReader::Open(io::RandomAccessFile* file, int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
   *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return (*reader)->impl_->Open(file, footer_offset, IpcReadOptions::Defaults());
 }
 
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
@@ -727,7 +1032,16 @@ Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>&
                                    int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
   *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return (*reader)->impl_->Open(file, footer_offset, IpcReadOptions::Defaults());
+}
+
+Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                                   const IpcReadOptions& options,
+                                   std::shared_ptr<RecordBatchFileReader>* reader) {
+  int64_t footer_offset;
+  RETURN_NOT_OK(file->GetSize(&footer_offset));
+  *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
+  return (*reader)->impl_->Open(file, footer_offset, options);
 }
 
 std::shared_ptr<Schema> RecordBatchFileReader::schema() const { return impl_->schema(); }
@@ -22,8 +22,10 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/ipc/message.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/util/visibility.h"
 
@@ -46,6 +48,23 @@ namespace ipc {
 
 using RecordBatchReader = ::arrow::RecordBatchReader;
 
+/// \brief Options for reading record batches from IPC messages
+struct ARROW_EXPORT IpcReadOptions {
+  /// Decompress the body buffers of compressed record batches in parallel on
+  /// the global CPU thread pool, rather than on the calling thread
+  bool use_threads = false;
+
+  /// Memory pool for allocating the decompressed body buffers
+  MemoryPool* memory_pool = default_memory_pool();
+
+  /// Indices of the top-level schema fields to read. If empty, all fields are
+  /// read. Record batches and reader schemas only contain the selected fields,
+  /// in schema order, and the file reader only reads their buffers.
+  std::vector<int> included_fields;
+
+  static IpcReadOptions Defaults();
+};
+
 /// \class RecordBatchStreamReader
 /// \brief Synchronous batch stream reader that reads from io::InputStream
 ///
@@ -67,6 +86,17 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(std::unique_ptr<MessageReader> message_reader,
                      std::unique_ptr<RecordBatchReader>* out);
 
+  /// Create batch reader from generic MessageReader and read options.
+  /// This will take ownership of the given MessageReader.
+  ///
+  /// \param[in] message_reader a MessageReader implementation
+  /// \param[in] options options for reading the record batches
+  /// \param[out] out the created RecordBatchReader object
+  /// \return Status
+  static Status Open(std::unique_ptr<MessageReader> message_reader,
+                     const IpcReadOptions& options,
+                     std::shared_ptr<RecordBatchReader>* out);
+
   /// \brief Record batch stream reader from InputStream
   ///
   /// \param[in] stream an input stream instance. Must stay alive throughout
@@ -82,6 +112,15 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(const std::shared_ptr<io::InputStream>& stream,
                      std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Open stream with read options and retain ownership of stream object
+  /// \param[in] stream the input stream
+  /// \param[in] options options for reading the record batches
+  /// \param[out] out the batch reader
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::InputStream>& stream,
+                     const IpcReadOptions& options,
+                     std::shared_ptr<RecordBatchReader>* out);
+
   /// \brief Returns the schema read from the stream
   std::shared_ptr<Schema> schema() const override;
 
@@ -140,6 +179,16 @@ class ARROW_EXPORT RecordBatchFileReader {
                      int64_t footer_offset,
                      std::shared_ptr<RecordBatchFileReader>* reader);
 
+  /// \brief Version of Open that retains ownership of file and takes read options
+  ///
+  /// \param[in] file the data source
+  /// \param[in] options options for reading the record batches
+  /// \param[out] reader the returned reader
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                     const IpcReadOptions& options,
+                     std::shared_ptr<RecordBatchFileReader>* reader);
+
   /// \brief The schema read from the file
   std::shared_ptr<Schema> schema() const;
 
@@ -231,6 +280,19 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
                        int max_recursion_depth, io::RandomAccessFile* file,
                        std::shared_ptr<RecordBatch>* out);
 
+/// Read record batch from file given metadata, schema and read options
+///
+/// \param[in] metadata a Message containing the record batch metadata
+/// \param[in] schema the record batch schema
+/// \param[in] options options for reading the record batch
+/// \param[in] file a random access file
+/// \param[out] out the read record batch
+/// \return Status
+ARROW_EXPORT
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       const IpcReadOptions& options, io::RandomAccessFile* file,
+                       std::shared_ptr<RecordBatch>* out);
+
 /// \brief Read arrow::Tensor as encapsulated IPC message in file
 ///
 /// \param[in] file an InputStream pointed at the start of the message
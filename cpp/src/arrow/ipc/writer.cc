@@ -43,6 +43,7 @@
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/stl.h"
 #include "arrow/visitor.h"
@@ -107,17 +108,31 @@ static inline bool NeedTruncate(int64_t offset, const Buffer* buffer,
   return offset != 0 || min_length < buffer->size();
 }
 
+IpcWriteOptions IpcWriteOptions::Defaults() { return IpcWriteOptions(); }
+
+static Status CheckWriteOptions(const IpcWriteOptions& options) {
+  if (options.compression != Compression::UNCOMPRESSED &&
+      !options.allow_non_interoperable_compression) {
+    return Status::Invalid(
+        "IPC body compression can only be read by this library, set "
+        "IpcWriteOptions::allow_non_interoperable_compression to enable it");
+  }
+  return Status::OK();
+}
+
 namespace internal {
 
 class RecordBatchSerializer : public ArrayVisitor {
  public:
   RecordBatchSerializer(MemoryPool* pool, int64_t buffer_start_offset,
-                        int max_recursion_depth, bool allow_64bit, IpcPayload* out)
+                        int max_recursion_depth, bool allow_64bit, IpcPayload* out,
+                        const IpcWriteOptions& options = IpcWriteOptions::Defaults())
       : out_(out),
         pool_(pool),
         max_recursion_depth_(max_recursion_depth),
         buffer_start_offset_(buffer_start_offset),
-        allow_64bit_(allow_64bit) {
+        allow_64bit_(allow_64bit),
+        options_(options) {
     DCHECK_GT(max_recursion_depth, 0);
   }
 
@@ -150,10 +165,53 @@ class RecordBatchSerializer : public ArrayVisitor {
   // Override this for writing dictionary metadata
   virtual Status SerializeMetadata(int64_t num_rows) {
     return WriteRecordBatchMessage(num_rows, out_->body_length, field_nodes_,
-                                   buffer_meta_, &out_->metadata);
+                                   buffer_meta_, options_.compression, &out_->metadata);
+  }
+
+  // Replace a body buffer by its compressed form, prefixed by the uncompressed
+  // length.  If compression does not save space, the buffer is kept as-is
+  // behind a -1 prefix so that readers need not run the codec on it.
+  Status CompressBuffer(const Buffer& buffer, std::shared_ptr<Buffer>* out) {
+    const int64_t prefix_length = sizeof(int64_t);
+    const int64_t max_length = codec_->MaxCompressedLen(buffer.size(), buffer.data());
+
+    std::shared_ptr<ResizableBuffer> result;
+    RETURN_NOT_OK(AllocateResizableBuffer(
+        pool_, prefix_length + std::max(max_length, buffer.size()), &result));
+    uint8_t* data = result->mutable_data() + prefix_length;
+
+    int64_t length = 0;
+    RETURN_NOT_OK(
+        codec_->Compress(buffer.size(), buffer.data(), max_length, data, &length));
+    int64_t uncompressed_length = buffer.size();
+    if (length >= buffer.size()) {
+      // Incompressible
+      std::memcpy(data, buffer.data(), buffer.size());
+      length = buffer.size();
+      uncompressed_length = -1;
+    }
+    uncompressed_length = BitUtil::ToLittleEndian(uncompressed_length);
+    std::memcpy(result->mutable_data(), &uncompressed_length, prefix_length);
+
+    RETURN_NOT_OK(result->Resize(prefix_length + length, false));
+    *out = result;
+    return Status::OK();
+  }
+
+  Status CompressBodyBuffers() {
+    if (!codec_) {
+      RETURN_NOT_OK(util::Codec::Create(options_.compression, &codec_));
+    }
+    for (auto& buffer : out_->body_buffers) {
+      if (buffer && buffer->size() > 0) {
+        RETURN_NOT_OK(CompressBuffer(*buffer, &buffer));
+      }
+    }
+    return Status::OK();
   }
 
   Status Assemble(const RecordBatch& batch) {
+    RETURN_NOT_OK(CheckWriteOptions(options_));
     if (field_nodes_.size() > 0) {
       field_nodes_.clear();
       buffer_meta_.clear();
@@ -165,6 +223,11 @@ class RecordBatchSerializer : public ArrayVisitor {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
+    const bool compressed = options_.compression != Compression::UNCOMPRESSED;
+    if (compressed) {
+      RETURN_NOT_OK(CompressBodyBuffers());
+    }
+
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -183,7 +246,9 @@ class RecordBatchSerializer : public ArrayVisitor {
         padding = BitUtil::RoundUpToMultipleOf8(size) - size;
       }
 
-      buffer_meta_.push_back({offset, size + padding});
+      // Compressed buffers record their exact length, as codecs generally
+      // can't skip trailing padding
+      buffer_meta_.push_back({offset, compressed ? size : size + padding});
       offset += size + padding;
     }
 
@@ -469,19 +534,24 @@ class RecordBatchSerializer : public ArrayVisitor {
   int64_t max_recursion_depth_;
   int64_t buffer_start_offset_;
   bool allow_64bit_;
+
+  IpcWriteOptions options_;
+  std::unique_ptr<util::Codec> codec_;
 };
 
 class DictionaryWriter : public RecordBatchSerializer {
  public:
   DictionaryWriter(int64_t dictionary_id, MemoryPool* pool, int64_t buffer_start_offset,
-                   int max_recursion_depth, bool allow_64bit, IpcPayload* out)
+                   int max_recursion_depth, bool allow_64bit, IpcPayload* out,
+                   const IpcWriteOptions& options = IpcWriteOptions::Defaults())
       : RecordBatchSerializer(pool, buffer_start_offset, max_recursion_depth, allow_64bit,
-                              out),
+                              out, options),
         dictionary_id_(dictionary_id) {}
 
   Status SerializeMetadata(int64_t num_rows) override {
     return WriteDictionaryMessage(dictionary_id_, num_rows, out_->body_length,
-                                  field_nodes_, buffer_meta_, &out_->metadata);
+                                  field_nodes_, buffer_meta_, options_.compression,
+                                  &out_->metadata);
   }
 
   Status Assemble(const std::shared_ptr<Array>& dictionary) {
@@ -534,6 +604,13 @@ Status WriteIpcPayload(const IpcPayload& payload, io::OutputStream* dst,
 
 Status GetSchemaPayloads(const Schema& schema, MemoryPool* pool, DictionaryMemo* out_memo,
                          std::vector<IpcPayload>* out_payloads) {
+  return GetSchemaPayloads(schema, IpcWriteOptions::Defaults(), pool, out_memo,
+                           out_payloads);
+}
+
+Status GetSchemaPayloads(const Schema& schema, const IpcWriteOptions& options,
+                         MemoryPool* pool, DictionaryMemo* out_memo,
+                         std::vector<IpcPayload>* out_payloads) {
   DictionaryMemo dictionary_memo;
   IpcPayload payload;
 
@@ -552,7 +629,7 @@ Status GetSchemaPayloads(const Schema& schema, MemoryPool* pool, DictionaryMemo*
     const int64_t buffer_start_offset = 0;
     payload.type = Message::DICTIONARY_BATCH;
     DictionaryWriter writer(dictionary_id, pool, buffer_start_offset, kMaxNestingDepth,
-                            true /* allow_64bit */, &payload);
+                            true /* allow_64bit */, &payload, options);
     RETURN_NOT_OK(writer.Assemble(dictionary));
     out_payloads->push_back(std::move(payload));
   }
@@ -571,8 +648,13 @@ Status GetSchemaPayloads(const Schema& schema, MemoryPool* pool,
 
 Status GetRecordBatchPayload(const RecordBatch& batch, MemoryPool* pool,
                              IpcPayload* out) {
+  return GetRecordBatchPayload(batch, IpcWriteOptions::Defaults(), pool, out);
+}
+
+Status GetRecordBatchPayload(const RecordBatch& batch, const IpcWriteOptions& options,
+                             MemoryPool* pool, IpcPayload* out) {
   out->type = Message::RECORD_BATCH;
-  RecordBatchSerializer writer(pool, 0, kMaxNestingDepth, true, out);
+  RecordBatchSerializer writer(pool, 0, kMaxNestingDepth, true, out, options);
   return writer.Assemble(batch);
 }
 
@@ -896,18 +978,22 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
   ~RecordBatchPayloadWriter() override = default;
 
   RecordBatchPayloadWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
-                           const Schema& schema)
+                           const Schema& schema,
+                           const IpcWriteOptions& options = IpcWriteOptions::Defaults())
       : payload_writer_(std::move(payload_writer)),
         schema_(schema),
+        options_(options),
         pool_(default_memory_pool()),
         started_(false) {}
 
   // A Schema-owning constructor variant
   RecordBatchPayloadWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
-                           const std::shared_ptr<Schema>& schema)
+                           const std::shared_ptr<Schema>& schema,
+                           const IpcWriteOptions& options = IpcWriteOptions::Defaults())
       : payload_writer_(std::move(payload_writer)),
         shared_schema_(schema),
         schema_(*schema),
+        options_(options),
         pool_(default_memory_pool()),
         started_(false) {}
 
@@ -918,7 +1004,7 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
 
     RETURN_NOT_OK(CheckStarted());
     internal::IpcPayload payload;
-    RETURN_NOT_OK(GetRecordBatchPayload(batch, pool_, &payload));
+    RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, pool_, &payload));
     return payload_writer_->WritePayload(payload);
   }
 
@@ -937,7 +1023,7 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
     std::vector<internal::IpcPayload> payloads;
     // XXX should we have a GetSchemaPayloads() variant that generates them
     // one by one, to minimize memory usage?
-    RETURN_NOT_OK(GetSchemaPayloads(schema_, pool_, &payloads));
+    RETURN_NOT_OK(GetSchemaPayloads(schema_, options_, pool_, nullptr, &payloads));
     for (const auto& payload : payloads) {
       RETURN_NOT_OK(payload_writer_->WritePayload(payload));
     }
@@ -956,6 +1042,7 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
   std::unique_ptr<internal::IpcPayloadWriter> payload_writer_;
   std::shared_ptr<Schema> shared_schema_;
   const Schema& schema_;
+  const IpcWriteOptions options_;
   MemoryPool* pool_;
   bool started_;
 };
@@ -1104,20 +1191,22 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl
     : public RecordBatchPayloadWriter {
  public:
   RecordBatchStreamWriterImpl(io::OutputStream* sink,
-                              const std::shared_ptr<Schema>& schema)
+                              const std::shared_ptr<Schema>& schema,
+                              const IpcWriteOptions& options)
       : RecordBatchPayloadWriter(
             std::unique_ptr<internal::IpcPayloadWriter>(new PayloadStreamWriter(sink)),
-            schema) {}
+            schema, options) {}
 
   ~RecordBatchStreamWriterImpl() = default;
 };
 
 class RecordBatchFileWriter::RecordBatchFileWriterImpl : public RecordBatchPayloadWriter {
  public:
-  RecordBatchFileWriterImpl(io::OutputStream* sink, const std::shared_ptr<Schema>& schema)
+  RecordBatchFileWriterImpl(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+                            const IpcWriteOptions& options)
       : RecordBatchPayloadWriter(std::unique_ptr<internal::IpcPayloadWriter>(
                                      new PayloadFileWriter(sink, schema)),
-                                 schema) {}
+                                 schema, options) {}
 
   ~RecordBatchFileWriterImpl() = default;
 };
@@ -1138,9 +1227,17 @@ void RecordBatchStreamWriter::set_memory_pool(MemoryPool* pool) {
 Status RecordBatchStreamWriter::Open(io::OutputStream* sink,
                                      const std::shared_ptr<Schema>& schema,
                                      std::shared_ptr<RecordBatchWriter>* out) {
+  return Open(sink, schema, IpcWriteOptions::Defaults(), out);
+}
+
+Status RecordBatchStreamWriter::Open(io::OutputStream* sink,
+                                     const std::shared_ptr<Schema>& schema,
+                                     const IpcWriteOptions& options,
+                                     std::shared_ptr<RecordBatchWriter>* out) {
+  RETURN_NOT_OK(CheckWriteOptions(options));
   // ctor is private
   auto result = std::shared_ptr<RecordBatchStreamWriter>(new RecordBatchStreamWriter());
-  result->impl_.reset(new RecordBatchStreamWriterImpl(sink, schema));
+  result->impl_.reset(new RecordBatchStreamWriterImpl(sink, schema, options));
   *out = result;
   return Status::OK();
 }
@@ -1154,9 +1251,17 @@ RecordBatchFileWriter::~RecordBatchFileWriter() {}
 Status RecordBatchFileWriter::Open(io::OutputStream* sink,
                                    const std::shared_ptr<Schema>& schema,
                                    std::shared_ptr<RecordBatchWriter>* out) {
+  return Open(sink, schema, IpcWriteOptions::Defaults(), out);
+}
+
+Status RecordBatchFileWriter::Open(io::OutputStream* sink,
+                                   const std::shared_ptr<Schema>& schema,
+                                   const IpcWriteOptions& options,
+                                   std::shared_ptr<RecordBatchWriter>* out) {
+  RETURN_NOT_OK(CheckWriteOptions(options));
   // ctor is private
   auto result = std::shared_ptr<RecordBatchFileWriter>(new RecordBatchFileWriter());
-  result->file_impl_.reset(new RecordBatchFileWriterImpl(sink, schema));
+  result->file_impl_.reset(new RecordBatchFileWriterImpl(sink, schema, options));
   *out = result;
   return Status::OK();
 }
@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "arrow/ipc/message.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -48,6 +49,26 @@ namespace ipc {
 
 class DictionaryMemo;
 
+/// \brief Options for writing record batches and dictionaries as IPC messages
+struct ARROW_EXPORT IpcWriteOptions {
+  /// Codec used to compress each buffer of a record batch or dictionary body.
+  /// A compressed buffer is prefixed with its uncompressed length; buffers
+  /// which do not get smaller are written as-is, with a length prefix of -1.
+  /// Readers of this library detect and undo the compression transparently.
+  ///
+  /// Body compression is not part of the Arrow IPC format: the codec is only
+  /// recorded in the custom_metadata of the messages, which other readers
+  /// (including older versions of this library) ignore, silently misreading
+  /// the data.  Writers therefore refuse to compress unless
+  /// allow_non_interoperable_compression is set.
+  Compression::type compression = Compression::UNCOMPRESSED;
+
+  /// Acknowledge that compressed output can only be read by this library
+  bool allow_non_interoperable_compression = false;
+
+  static IpcWriteOptions Defaults();
+};
+
 /// \class RecordBatchWriter
 /// \brief Abstract interface for writing a stream of record batches
 class ARROW_EXPORT RecordBatchWriter {
@@ -102,6 +123,18 @@ class ARROW_EXPORT RecordBatchStreamWriter : public RecordBatchWriter {
   static Status Open(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
                      std::shared_ptr<RecordBatchWriter>* out);
 
+  /// Create a new writer from stream sink, schema and write options. User is
+  /// responsible for closing the actual OutputStream.
+  ///
+  /// \param[in] sink output stream to write to
+  /// \param[in] schema the schema of the record batches to be written
+  /// \param[in] options options for serializing the record batches
+  /// \param[out] out the created stream writer
+  /// \return Status
+  static Status Open(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+                     const IpcWriteOptions& options,
+                     std::shared_ptr<RecordBatchWriter>* out);
+
   /// \brief Write a record batch to the stream
   ///
   /// \param[in] batch the record batch to write
@@ -139,6 +172,17 @@ class ARROW_EXPORT RecordBatchFileWriter : public RecordBatchStreamWriter {
   static Status Open(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
                      std::shared_ptr<RecordBatchWriter>* out);
 
+  /// Create a new writer from stream sink, schema and write options
+  ///
+  /// \param[in] sink output stream to write to
+  /// \param[in] schema the schema of the record batches to be written
+  /// \param[in] options options for serializing the record batches
+  /// \param[out] out the created stream writer
+  /// \return Status
+  static Status Open(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+                     const IpcWriteOptions& options,
+                     std::shared_ptr<RecordBatchWriter>* out);
+
   /// \brief Write a record batch to the file
   ///
   /// \param[in] batch the record batch to write
@@ -344,6 +388,10 @@ Status GetSchemaPayloads(const Schema& schema, MemoryPool* pool,
 ARROW_EXPORT
 Status GetSchemaPayloads(const Schema& schema, MemoryPool* pool,
                          std::vector<IpcPayload>* out);
+ARROW_EXPORT
+Status GetSchemaPayloads(const Schema& schema, const IpcWriteOptions& options,
+                         MemoryPool* pool, DictionaryMemo* dictionary_memo,
+                         std::vector<IpcPayload>* out);
 
 /// \brief Compute IpcPayload for the given record batch
 /// \param[in] batch the RecordBatch that is being serialized
@@ -352,6 +400,9 @@ Status GetSchemaPayloads(const Schema& schema, MemoryPool* pool,
 /// \return Status
 ARROW_EXPORT
 Status GetRecordBatchPayload(const RecordBatch& batch, MemoryPool* pool, IpcPayload* out);
+ARROW_EXPORT
+Status GetRecordBatchPayload(const RecordBatch& batch, const IpcWriteOptions& options,
+                             MemoryPool* pool, IpcPayload* out);
 
 }  // namespace internal
 
@@ -15,7 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <limits>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -23,6 +32,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/tracing_memory_pool.h"
 
 namespace arrow {
 
@@ -41,6 +51,47 @@ TEST_F(TestDefaultMemoryPool, OOM) {
 
 TEST_F(TestDefaultMemoryPool, Reallocate) { this->TestReallocate(); }
 
+class TestDefaultMemoryPoolOptions : public ::arrow::TestMemoryPoolBase {
+ public:
+  void SetUp() override {
+    auto options = MemoryPoolOptions::Defaults();
+    options.large_allocation_threshold = 16;
+    options.use_huge_pages = true;
+    options.numa_local = true;
+    pool_ = MemoryPool::CreateDefault(options);
+  }
+
+  ::arrow::MemoryPool* memory_pool() override { return pool_.get(); }
+
+ protected:
+  std::unique_ptr<MemoryPool> pool_;
+};
+
+TEST_F(TestDefaultMemoryPoolOptions, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestDefaultMemoryPoolOptions, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestDefaultMemoryPoolOptions, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestDefaultMemoryPoolOptions, LargeAllocations) {
+  const int64_t kHugePageSize = 2 * 1024 * 1024;
+  uint8_t* data;
+  ASSERT_OK(pool_->Allocate(10, &data));
+  data[9] = 42;
+  // Growing beyond the threshold moves to a huge page aligned region
+  ASSERT_OK(pool_->Reallocate(10, kHugePageSize + 1, &data));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % kHugePageSize);
+  ASSERT_EQ(42, data[9]);
+  memset(data, 1, kHugePageSize + 1);
+  ASSERT_EQ(kHugePageSize + 1, pool_->bytes_allocated());
+  pool_->Free(data, kHugePageSize + 1);
+  ASSERT_EQ(0, pool_->bytes_allocated());
+}
+
 // Death tests and valgrind are known to not play well 100% of the time. See
 // googletest documentation
 #if !(defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER))
@@ -99,4 +150,395 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pool->bytes_allocated());
   ASSERT_EQ(0, pp.bytes_allocated());
 }
+
+class TestArenaMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ArenaMemoryPool pool_{default_memory_pool()};
+};
+
+TEST_F(TestArenaMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestArenaMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestArenaMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(ArenaMemoryPool, Recycling) {
+  ProxyMemoryPool parent(default_memory_pool());
+  ArenaMemoryPool pool(&parent, 1024);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(100, &data1));
+  // Rounded up to the size class
+  ASSERT_EQ(128, parent.bytes_allocated());
+  ASSERT_EQ(128, pool.bytes_reserved());
+  ASSERT_EQ(100, pool.bytes_allocated());
+
+  // Freed blocks are cached and reused by allocations of the same size class
+  pool.Free(data1, 100);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(128, parent.bytes_allocated());
+  ASSERT_OK(pool.Allocate(120, &data2));
+  ASSERT_EQ(data1, data2);
+  ASSERT_EQ(128, parent.bytes_allocated());
+  ASSERT_EQ(120, pool.bytes_allocated());
+
+  // Reallocating within the size class doesn't move the block
+  ASSERT_OK(pool.Reallocate(120, 65, &data2));
+  ASSERT_EQ(data1, data2);
+  ASSERT_EQ(65, pool.bytes_allocated());
+  ASSERT_OK(pool.Reallocate(65, 300, &data2));
+  ASSERT_EQ(512 + 128, parent.bytes_allocated());
+  ASSERT_EQ(300, pool.bytes_allocated());
+  // Both blocks were allocated while moving the data
+  ASSERT_EQ(300 + 65, pool.max_memory());
+
+  // Larger allocations are not cached
+  uint8_t* data3;
+  ASSERT_OK(pool.Allocate(2000, &data3));
+  ASSERT_EQ(2000 + 512 + 128, parent.bytes_allocated());
+  pool.Free(data3, 2000);
+  ASSERT_EQ(512 + 128, parent.bytes_allocated());
+
+  pool.Free(data2, 300);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(512 + 128, pool.bytes_reserved());
+  pool.ReleaseUnused();
+  ASSERT_EQ(0, pool.bytes_reserved());
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, Reset) {
+  ProxyMemoryPool parent(default_memory_pool());
+  {
+    ArenaMemoryPool pool(&parent, 1024);
+
+    std::vector<uint8_t*> blocks(10);
+    for (auto& block : blocks) {
+      ASSERT_OK(pool.Allocate(200, &block));
+    }
+    uint8_t* large;
+    ASSERT_OK(pool.Allocate(4096, &large));
+    ASSERT_EQ(10 * 200 + 4096, pool.bytes_allocated());
+    ASSERT_EQ(10 * 256 + 4096, parent.bytes_allocated());
+
+    // All blocks become available at once, without freeing them individually
+    pool.Reset();
+    ASSERT_EQ(0, pool.bytes_allocated());
+    ASSERT_EQ(10 * 256, parent.bytes_allocated());
+    ASSERT_EQ(10 * 200 + 4096, pool.max_memory());
+
+    std::vector<uint8_t*> new_blocks(10);
+    for (auto& block : new_blocks) {
+      ASSERT_OK(pool.Allocate(150, &block));
+    }
+    ASSERT_EQ(10 * 256, parent.bytes_allocated());
+    std::sort(blocks.begin(), blocks.end());
+    std::sort(new_blocks.begin(), new_blocks.end());
+    ASSERT_EQ(blocks, new_blocks);
+  }
+  // Memory is returned to the parent on destruction
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, Threaded) {
+  const int kNumThreads = 8;
+  const int kNumIterations = 200;
+
+  ProxyMemoryPool parent(default_memory_pool());
+  ArenaMemoryPool pool(&parent);
+
+  std::vector<std::thread> threads;
+  std::vector<Status> statuses(kNumThreads);
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i]() {
+      for (int j = 0; j < kNumIterations && statuses[i].ok(); ++j) {
+        const int64_t size = 1 + (i * kNumIterations + j) % 5000;
+        uint8_t* data;
+        statuses[i] = pool.Allocate(size, &data);
+        if (statuses[i].ok()) {
+          memset(data, i, static_cast<size_t>(size));
+          pool.Free(data, size);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& st : statuses) {
+    ASSERT_OK(st);
+  }
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(pool.bytes_reserved(), parent.bytes_allocated());
+  pool.ReleaseUnused();
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, FreedByOtherThread) {
+  const int kNumBlocks = 100;
+  const int kNumRounds = 50;
+
+  ProxyMemoryPool parent(default_memory_pool());
+  ArenaMemoryPool pool(&parent);
+
+  // One thread allocates, another frees
+  for (int round = 0; round < kNumRounds; ++round) {
+    std::vector<uint8_t*> blocks(kNumBlocks);
+    for (auto& block : blocks) {
+      ASSERT_OK(pool.Allocate(1000, &block));
+    }
+    std::thread consumer([&]() {
+      for (auto block : blocks) {
+        pool.Free(block, 1000);
+      }
+    });
+    consumer.join();
+  }
+  // The freed blocks are reused instead of obtaining new ones
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(kNumBlocks * 1024, pool.bytes_reserved());
+  ASSERT_EQ(kNumBlocks * 1024, parent.bytes_allocated());
+}
+
+class TestLimitedMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  LimitedMemoryPool pool_{default_memory_pool(), std::numeric_limits<int64_t>::max()};
+};
+
+TEST_F(TestLimitedMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestLimitedMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestLimitedMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(LimitedMemoryPool, Limit) {
+  LimitedMemoryPool pool(default_memory_pool(), 1000);
+  ASSERT_EQ(1000, pool.limit());
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(600, &data1));
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(600, &data2));
+  ASSERT_OK(pool.Allocate(400, &data2));
+  ASSERT_EQ(1000, pool.bytes_allocated());
+
+  // Growing is subject to the limit, shrinking frees memory
+  ASSERT_RAISES(OutOfMemory, pool.Reallocate(400, 500, &data2));
+  ASSERT_OK(pool.Reallocate(600, 100, &data1));
+  ASSERT_OK(pool.Reallocate(400, 900, &data2));
+  ASSERT_EQ(1000, pool.bytes_allocated());
+  ASSERT_EQ(1000, pool.max_memory());
+
+  pool.Free(data1, 100);
+  pool.Free(data2, 900);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(4, pool.num_allocations());
+  ASSERT_EQ(2, pool.num_failed_allocations());
+}
+
+TEST(LimitedMemoryPool, Hierarchy) {
+  LimitedMemoryPool query_pool(default_memory_pool(), 1000);
+  LimitedMemoryPool reader1_pool(&query_pool, 800);
+  LimitedMemoryPool reader2_pool(&query_pool, 800);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, reader1_pool.Allocate(900, &data1));
+  ASSERT_OK(reader1_pool.Allocate(700, &data1));
+  // The parent's limit applies too
+  ASSERT_RAISES(OutOfMemory, reader2_pool.Allocate(500, &data2));
+  ASSERT_OK(reader2_pool.Allocate(300, &data2));
+
+  // Usage is attributed to each child
+  ASSERT_EQ(700, reader1_pool.bytes_allocated());
+  ASSERT_EQ(300, reader2_pool.bytes_allocated());
+  ASSERT_EQ(1000, query_pool.bytes_allocated());
+  ASSERT_EQ(1, reader2_pool.num_failed_allocations());
+
+  reader1_pool.Free(data1, 700);
+  reader2_pool.Free(data2, 300);
+  ASSERT_EQ(0, reader1_pool.bytes_allocated());
+  ASSERT_EQ(0, query_pool.bytes_allocated());
+}
+
+TEST(LimitedMemoryPool, Backpressure) {
+  LimitedMemoryPool pool(default_memory_pool(), 1000, /*timeout_seconds=*/10);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(800, &data1));
+  // Allocations which can never fit don't wait
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(1001, &data2));
+
+  std::thread freeing_thread([&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    pool.Free(data1, 800);
+  });
+  // Blocks until enough memory is freed
+  ASSERT_OK(pool.Allocate(500, &data2));
+  freeing_thread.join();
+  ASSERT_EQ(500, pool.bytes_allocated());
+  pool.Free(data2, 500);
+}
+
+TEST(LimitedMemoryPool, Timeout) {
+  LimitedMemoryPool pool(default_memory_pool(), 1000, /*timeout_seconds=*/1e-2);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(800, &data1));
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(500, &data2));
+  ASSERT_EQ(800, pool.bytes_allocated());
+  pool.Free(data1, 800);
+}
+
+TEST(LimitedMemoryPool, Histogram) {
+  LimitedMemoryPool pool(default_memory_pool(), 1 << 20);
+
+  std::vector<int64_t> sizes = {1, 2, 3, 4, 5, 64, 65, 1000};
+  for (int64_t size : sizes) {
+    uint8_t* data;
+    ASSERT_OK(pool.Allocate(size, &data));
+    pool.Free(data, size);
+  }
+  auto histogram = pool.allocation_size_histogram();
+  ASSERT_EQ(LimitedMemoryPool::kNumHistogramBuckets, histogram.size());
+  std::vector<int64_t> expected(LimitedMemoryPool::kNumHistogramBuckets, 0);
+  expected[0] = 1;   // 1
+  expected[1] = 1;   // 2
+  expected[2] = 2;   // 3, 4
+  expected[3] = 1;   // 5
+  expected[6] = 1;   // 64
+  expected[7] = 1;   // 65
+  expected[10] = 1;  // 1000
+  ASSERT_EQ(expected, histogram);
+  ASSERT_EQ(static_cast<int64_t>(sizes.size()), pool.num_allocations());
+}
+
+class TestTracingMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  TracingMemoryPool pool_{default_memory_pool()};
+};
+
+TEST_F(TestTracingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestTracingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestTracingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(TracingMemoryPool, Summary) {
+  auto options = TracingOptions::Defaults();
+  options.backtrace_sampling = 1;
+  TracingMemoryPool pool(default_memory_pool(), options);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(100, &data1));
+  ASSERT_OK(pool.Allocate(200, &data2));
+  ASSERT_OK(pool.Reallocate(200, 1000, &data2));
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  pool.Free(data1, 100);
+  pool.Free(data2, 1000);
+
+  auto summary = pool.Summarize();
+  ASSERT_EQ(2, summary.num_allocations);
+  ASSERT_EQ(1, summary.num_reallocations);
+  ASSERT_EQ(2, summary.num_frees);
+  ASSERT_EQ(100 + 1000, summary.bytes_allocated);
+  // Both the allocation of data2 and its reallocation end a lifetime
+  ASSERT_EQ(3, summary.num_lifetimes);
+  ASSERT_GE(summary.max_lifetime_ns, 1000000);
+  ASSERT_LE(summary.median_lifetime_ns, summary.max_lifetime_ns);
+  for (const auto& site : summary.top_sites) {
+    ASSERT_FALSE(site.backtrace.empty());
+  }
+  ASSERT_NE(std::string::npos, summary.ToString().find("Allocations: 2"));
+}
+
+TEST(TracingMemoryPool, AlternatingPools) {
+  // More pools than a thread keeps track of without locking
+  const int kNumPools = 6;
+  std::vector<std::unique_ptr<TracingMemoryPool>> pools;
+  for (int i = 0; i < kNumPools; ++i) {
+    pools.emplace_back(new TracingMemoryPool(default_memory_pool()));
+  }
+  for (int j = 0; j < 10; ++j) {
+    for (int i = 0; i < kNumPools; ++i) {
+      uint8_t* data;
+      ASSERT_OK(pools[i]->Allocate(i + 1, &data));
+      pools[i]->Free(data, i + 1);
+    }
+  }
+  for (int i = 0; i < kNumPools; ++i) {
+    auto summary = pools[i]->Summarize();
+    ASSERT_EQ(10, summary.num_allocations);
+    ASSERT_EQ(10, summary.num_frees);
+    ASSERT_EQ(10 * (i + 1), summary.bytes_allocated);
+  }
+}
+
+TEST(TracingMemoryPool, Threaded) {
+  const int kNumThreads = 4;
+  const int kNumIterations = 1000;
+
+  auto options = TracingOptions::Defaults();
+  // Only retain part of the events
+  options.events_per_thread = 100;
+  options.backtrace_sampling = 10;
+  TracingMemoryPool pool(default_memory_pool(), options);
+
+  std::atomic<bool> done(false);
+  std::thread summarizing_thread([&]() {
+    while (!done) {
+      auto summary = pool.Summarize(2);
+      ASSERT_LE(summary.top_sites.size(), 2);
+    }
+  });
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < kNumIterations; ++j) {
+        uint8_t* data;
+        ASSERT_OK(pool.Allocate(j + 1, &data));
+        pool.Free(data, j + 1);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  done = true;
+  summarizing_thread.join();
+
+  auto summary = pool.Summarize();
+  ASSERT_EQ(kNumThreads * kNumIterations, summary.num_allocations);
+  ASSERT_EQ(kNumThreads * kNumIterations, summary.num_frees);
+  ASSERT_EQ(kNumThreads * kNumIterations * (kNumIterations + 1) / 2,
+            summary.bytes_allocated);
+  ASSERT_LE(summary.num_lifetimes, kNumThreads * 100);
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
 }  // namespace arrow
@@ -18,16 +18,31 @@
 #include "arrow/memory_pool.h"
 
 #include <algorithm>  // IWYU pragma: keep
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>    // IWYU pragma: keep
 #include <cstring>    // IWYU pragma: keep
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <sstream>  // IWYU pragma: keep
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
 
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #ifdef ARROW_JEMALLOC
 // Needed to support jemalloc 3 and 4
 #define JEMALLOC_MANGLE
@@ -38,6 +53,10 @@
 namespace arrow {
 
 constexpr size_t kAlignment = 64;
+// The alignment of large allocations
+constexpr size_t kPageAlignment = 4096;
+// The alignment of large allocations backed by huge pages
+constexpr size_t kHugePageAlignment = 2 * 1024 * 1024;
 
 namespace {
 
@@ -46,8 +65,8 @@ namespace {
 alignas(kAlignment) static uint8_t zero_size_area[1];
 
 // Allocate memory according to the alignment requirements for Arrow
-// (as of May 2016 64 bytes)
-Status AllocateAligned(int64_t size, uint8_t** out) {
+// (as of May 2016 64 bytes), or a larger power-of-two alignment
+Status AllocateAligned(int64_t size, uint8_t** out, size_t alignment = kAlignment) {
   // TODO(emkornfield) find something compatible with windows
   if (size < 0) {
     return Status::Invalid("negative malloc size");
@@ -62,25 +81,25 @@ Status AllocateAligned(int64_t size, uint8_t** out) {
 #ifdef _WIN32
   // Special code path for Windows
   *out =
-      reinterpret_cast<uint8_t*>(_aligned_malloc(static_cast<size_t>(size), kAlignment));
+      reinterpret_cast<uint8_t*>(_aligned_malloc(static_cast<size_t>(size), alignment));
   if (!*out) {
     return Status::OutOfMemory("malloc of size ", size, " failed");
   }
 #elif defined(ARROW_JEMALLOC)
   *out = reinterpret_cast<uint8_t*>(
-      mallocx(static_cast<size_t>(size), MALLOCX_ALIGN(kAlignment)));
+      mallocx(static_cast<size_t>(size), MALLOCX_ALIGN(alignment)));
   if (*out == NULL) {
     return Status::OutOfMemory("malloc of size ", size, " failed");
   }
 #else
-  const int result = posix_memalign(reinterpret_cast<void**>(out), kAlignment,
+  const int result = posix_memalign(reinterpret_cast<void**>(out), alignment,
                                     static_cast<size_t>(size));
   if (result == ENOMEM) {
     return Status::OutOfMemory("malloc of size ", size, " failed");
   }
 
   if (result == EINVAL) {
-    return Status::Invalid("invalid alignment parameter: ", kAlignment);
+    return Status::Invalid("invalid alignment parameter: ", alignment);
   }
 #endif
   return Status::OK();
@@ -144,8 +163,34 @@ Status ReallocateAligned(int64_t old_size, int64_t new_size, uint8_t** ptr) {
   return Status::OK();
 }
 
+// Allocate a large memory region according to the pool options
+Status AllocateLarge(const MemoryPoolOptions& options, int64_t size, uint8_t** out) {
+  const size_t alignment = options.use_huge_pages ? kHugePageAlignment : kPageAlignment;
+  RETURN_NOT_OK(AllocateAligned(size, out, alignment));
+#ifdef __linux__
+  // Both are hints, so errors are ignored.  They must be given before the
+  // pages are first touched.
+#ifdef MADV_HUGEPAGE
+  if (options.use_huge_pages) {
+    madvise(*out, static_cast<size_t>(size), MADV_HUGEPAGE);
+  }
+#endif
+  if (options.numa_local) {
+    unsigned int cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0 && node < 64) {
+      unsigned long nodemask = 1UL << node;  // NOLINT
+      syscall(SYS_mbind, *out, static_cast<size_t>(size), MPOL_PREFERRED, &nodemask,
+              sizeof(nodemask) * 8, 0);
+    }
+  }
+#endif
+  return Status::OK();
+}
+
 }  // namespace
 
+MemoryPoolOptions MemoryPoolOptions::Defaults() { return MemoryPoolOptions(); }
+
 MemoryPool::MemoryPool() {}
 
 MemoryPool::~MemoryPool() {}
@@ -157,17 +202,34 @@ int64_t MemoryPool::max_memory() const { return -1; }
 
 class DefaultMemoryPool : public MemoryPool {
  public:
+  DefaultMemoryPool() : DefaultMemoryPool(MemoryPoolOptions::Defaults()) {}
+
+  explicit DefaultMemoryPool(const MemoryPoolOptions& options) : options_(options) {}
+
   ~DefaultMemoryPool() override {}
 
   Status Allocate(int64_t size, uint8_t** out) override {
-    RETURN_NOT_OK(AllocateAligned(size, out));
+    if (IsLarge(size)) {
+      RETURN_NOT_OK(AllocateLarge(options_, size, out));
+    } else {
+      RETURN_NOT_OK(AllocateAligned(size, out));
+    }
 
     stats_.UpdateAllocatedBytes(size);
     return Status::OK();
   }
 
   Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override {
-    RETURN_NOT_OK(ReallocateAligned(old_size, new_size, ptr));
+    if (IsLarge(new_size) && new_size > old_size) {
+      // Allocate a new large region, as reallocation wouldn't honour the options
+      uint8_t* out = nullptr;
+      RETURN_NOT_OK(AllocateLarge(options_, new_size, &out));
+      memcpy(out, *ptr, static_cast<size_t>(old_size));
+      DeallocateAligned(*ptr, old_size);
+      *ptr = out;
+    } else {
+      RETURN_NOT_OK(ReallocateAligned(old_size, new_size, ptr));
+    }
 
     stats_.UpdateAllocatedBytes(new_size - old_size);
     return Status::OK();
@@ -184,6 +246,12 @@ class DefaultMemoryPool : public MemoryPool {
   int64_t max_memory() const override { return stats_.max_memory(); }
 
  private:
+  bool IsLarge(int64_t size) const {
+    return options_.large_allocation_threshold >= 0 && size > 0 &&
+           size >= options_.large_allocation_threshold;
+  }
+
+  const MemoryPoolOptions options_;
   internal::MemoryPoolStats stats_;
 };
 
@@ -191,6 +259,10 @@ std::unique_ptr<MemoryPool> MemoryPool::CreateDefault() {
   return std::unique_ptr<MemoryPool>(new DefaultMemoryPool);
 }
 
+std::unique_ptr<MemoryPool> MemoryPool::CreateDefault(const MemoryPoolOptions& options) {
+  return std::unique_ptr<MemoryPool>(new DefaultMemoryPool(options));
+}
+
 MemoryPool* default_memory_pool() {
   static DefaultMemoryPool default_memory_pool_;
   return &default_memory_pool_;
@@ -286,4 +358,451 @@ int64_t ProxyMemoryPool::bytes_allocated() const { return impl_->bytes_allocated
 
 int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+class ArenaMemoryPool::ArenaMemoryPoolImpl {
+ public:
+  // The smallest size class, also the alignment guaranteed by the parent
+  static constexpr int64_t kMinClassSize = kAlignment;
+  // The number of free list shards, threads are assigned one in turn
+  static constexpr int kNumShards = 16;
+
+  ArenaMemoryPoolImpl(MemoryPool* parent, int64_t max_cached_size)
+      : parent_(parent), bytes_reserved_(0) {
+    max_cached_size = std::max(max_cached_size, kMinClassSize);
+    num_classes_ = SizeClass(max_cached_size) + 1;
+    max_cached_size_ = ClassSize(num_classes_ - 1);
+    for (auto& shard : shards_) {
+      shard.free_blocks.resize(num_classes_);
+      shard.owned_blocks.resize(num_classes_);
+    }
+  }
+
+  ~ArenaMemoryPoolImpl() {
+    for (auto& shard : shards_) {
+      for (int c = 0; c < num_classes_; ++c) {
+        for (uint8_t* block : shard.owned_blocks[c]) {
+          parent_->Free(block, ClassSize(c));
+        }
+      }
+    }
+    for (const auto& pair : large_blocks_) {
+      parent_->Free(pair.first, pair.second);
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size <= 0) {
+      // Nothing to cache, let the parent handle the zero-size area or error out
+      return parent_->Allocate(size, out);
+    }
+    if (size > max_cached_size_) {
+      RETURN_NOT_OK(AllocateLarge(size, out));
+    } else {
+      const int size_class = SizeClass(size);
+      Shard* shard = CurrentShard();
+      {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        auto& free_blocks = shard->free_blocks[size_class];
+        if (!free_blocks.empty()) {
+          *out = free_blocks.back();
+          free_blocks.pop_back();
+          stats_.UpdateAllocatedBytes(size);
+          return Status::OK();
+        }
+      }
+      if (StealFreeBlocks(shard, size_class, out)) {
+        stats_.UpdateAllocatedBytes(size);
+        return Status::OK();
+      }
+      const int64_t class_size = ClassSize(size_class);
+      RETURN_NOT_OK(parent_->Allocate(class_size, out));
+      bytes_reserved_ += class_size;
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->owned_blocks[size_class].push_back(*out);
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (old_size > 0 && new_size > 0 && old_size <= max_cached_size_ &&
+        new_size <= max_cached_size_ && SizeClass(old_size) == SizeClass(new_size)) {
+      // Fits in the same block
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* out = nullptr;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (size <= 0) {
+      parent_->Free(buffer, size);
+      return;
+    }
+    if (size > max_cached_size_) {
+      {
+        std::lock_guard<std::mutex> lock(large_mutex_);
+        DCHECK_EQ(large_blocks_.count(buffer), 1);
+        large_blocks_.erase(buffer);
+      }
+      parent_->Free(buffer, size);
+      bytes_reserved_ -= size;
+    } else {
+      // The block is cached by the current thread, regardless of which thread
+      // allocated it.  Allocating threads take it back in StealFreeBlocks().
+      Shard* shard = CurrentShard();
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->free_blocks[SizeClass(size)].push_back(buffer);
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  void Reset() {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.free_blocks = shard.owned_blocks;
+    }
+    {
+      std::lock_guard<std::mutex> lock(large_mutex_);
+      for (const auto& pair : large_blocks_) {
+        parent_->Free(pair.first, pair.second);
+        bytes_reserved_ -= pair.second;
+      }
+      large_blocks_.clear();
+    }
+    stats_.UpdateAllocatedBytes(-stats_.bytes_allocated());
+  }
+
+  void ReleaseUnused() {
+    // Free blocks may be cached by another shard than the one owning them
+    std::vector<std::unique_lock<std::mutex>> locks;
+    for (auto& shard : shards_) {
+      locks.emplace_back(shard.mutex);
+    }
+    for (int c = 0; c < num_classes_; ++c) {
+      std::unordered_set<uint8_t*> unused;
+      for (auto& shard : shards_) {
+        unused.insert(shard.free_blocks[c].begin(), shard.free_blocks[c].end());
+        shard.free_blocks[c].clear();
+      }
+      if (unused.empty()) {
+        continue;
+      }
+      const int64_t class_size = ClassSize(c);
+      for (auto& shard : shards_) {
+        auto& owned = shard.owned_blocks[c];
+        auto it = std::remove_if(owned.begin(), owned.end(), [&](uint8_t* block) {
+          return unused.count(block) > 0;
+        });
+        owned.erase(it, owned.end());
+      }
+      for (uint8_t* block : unused) {
+        parent_->Free(block, class_size);
+      }
+      bytes_reserved_ -= class_size * static_cast<int64_t>(unused.size());
+    }
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t bytes_reserved() const { return bytes_reserved_.load(); }
+
+ private:
+  struct Shard {
+    std::mutex mutex;
+    // Per size class, the blocks available for allocation
+    std::vector<std::vector<uint8_t*>> free_blocks;
+    // Per size class, the blocks obtained from the parent by this shard
+    std::vector<std::vector<uint8_t*>> owned_blocks;
+  };
+
+  static int SizeClass(int64_t size) {
+    return BitUtil::Log2(static_cast<uint64_t>(std::max(size, kMinClassSize))) -
+           BitUtil::Log2(static_cast<uint64_t>(kMinClassSize));
+  }
+
+  static int64_t ClassSize(int size_class) { return kMinClassSize << size_class; }
+
+  Shard* CurrentShard() {
+    static std::atomic<int> next_shard(0);
+    static thread_local int shard_index = next_shard++ % kNumShards;
+    return &shards_[shard_index];
+  }
+
+  // Take free blocks of the size class from another shard, return one in out
+  // and cache the others in the given shard.  When some threads allocate and
+  // others free, blocks otherwise pile up in the freeing threads' shards while
+  // the allocating threads keep obtaining new ones from the parent.
+  bool StealFreeBlocks(Shard* shard, int size_class, uint8_t** out) {
+    const int64_t shard_index = shard - shards_;
+    for (int i = 1; i < kNumShards; ++i) {
+      Shard* victim = &shards_[(shard_index + i) % kNumShards];
+      std::vector<uint8_t*> stolen;
+      {
+        std::lock_guard<std::mutex> lock(victim->mutex);
+        auto& free_blocks = victim->free_blocks[size_class];
+        if (free_blocks.empty()) {
+          continue;
+        }
+        // Take half of them, so that the next allocations don't need to steal
+        const size_t count = (free_blocks.size() + 1) / 2;
+        stolen.assign(free_blocks.end() - count, free_blocks.end());
+        free_blocks.resize(free_blocks.size() - count);
+      }
+      *out = stolen.back();
+      stolen.pop_back();
+      if (!stolen.empty()) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        auto& free_blocks = shard->free_blocks[size_class];
+        free_blocks.insert(free_blocks.end(), stolen.begin(), stolen.end());
+      }
+      return true;
+    }
+    return false;
+  }
+
+  Status AllocateLarge(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(parent_->Allocate(size, out));
+    bytes_reserved_ += size;
+    std::lock_guard<std::mutex> lock(large_mutex_);
+    large_blocks_.emplace(*out, size);
+    return Status::OK();
+  }
+
+  MemoryPool* parent_;
+  int num_classes_;
+  int64_t max_cached_size_;
+  Shard shards_[kNumShards];
+
+  std::mutex large_mutex_;
+  std::unordered_map<uint8_t*, int64_t> large_blocks_;
+
+  std::atomic<int64_t> bytes_reserved_;
+  internal::MemoryPoolStats stats_;
+};
+
+constexpr int64_t ArenaMemoryPool::ArenaMemoryPoolImpl::kMinClassSize;
+constexpr int ArenaMemoryPool::ArenaMemoryPoolImpl::kNumShards;
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* parent, int64_t max_cached_size)
+    : impl_(new ArenaMemoryPoolImpl(parent, max_cached_size)) {}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+void ArenaMemoryPool::Reset() { impl_->Reset(); }
+
+void ArenaMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t ArenaMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
+///////////////////////////////////////////////////////////////////////
+// LimitedMemoryPool implementation
+
+class LimitedMemoryPool::LimitedMemoryPoolImpl {
+ public:
+  LimitedMemoryPoolImpl(MemoryPool* pool, int64_t limit, double timeout_seconds)
+      : pool_(pool),
+        limit_(limit),
+        timeout_seconds_(timeout_seconds),
+        reserved_(0),
+        num_waiters_(0),
+        num_allocations_(0),
+        num_failed_allocations_(0) {
+    for (auto& bucket : histogram_) {
+      bucket.store(0);
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(Reserve(size));
+    Status st = pool_->Allocate(size, out);
+    if (!st.ok()) {
+      Release(size);
+      ++num_failed_allocations_;
+      return st;
+    }
+    RecordAllocation(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int64_t diff = new_size - old_size;
+    if (diff > 0) {
+      RETURN_NOT_OK(Reserve(diff));
+    }
+    Status st = pool_->Reallocate(old_size, new_size, ptr);
+    if (!st.ok()) {
+      if (diff > 0) {
+        Release(diff);
+      }
+      ++num_failed_allocations_;
+      return st;
+    }
+    if (diff < 0) {
+      Release(-diff);
+    }
+    RecordAllocation(new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    Release(size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t limit() const { return limit_; }
+
+  int64_t num_allocations() const { return num_allocations_.load(); }
+
+  int64_t num_failed_allocations() const { return num_failed_allocations_.load(); }
+
+  std::vector<int64_t> allocation_size_histogram() const {
+    std::vector<int64_t> histogram;
+    for (const auto& bucket : histogram_) {
+      histogram.push_back(bucket.load());
+    }
+    return histogram;
+  }
+
+ private:
+  bool TryReserve(int64_t size) {
+    int64_t reserved = reserved_.load();
+    do {
+      if (size > limit_ - reserved) {
+        return false;
+      }
+    } while (!reserved_.compare_exchange_weak(reserved, reserved + size));
+    return true;
+  }
+
+  Status Reserve(int64_t size) {
+    if (ARROW_PREDICT_TRUE(TryReserve(size))) {
+      stats_.UpdateAllocatedBytes(size);
+      return Status::OK();
+    }
+    // Allocations which can never succeed shouldn't wait
+    bool reserved = false;
+    if (timeout_seconds_ != 0 && size <= limit_) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      ++num_waiters_;
+      auto predicate = [&]() { return TryReserve(size); };
+      if (timeout_seconds_ < 0) {
+        cv_.wait(lock, predicate);
+        reserved = true;
+      } else {
+        reserved = cv_.wait_for(
+            lock, std::chrono::duration<double>(timeout_seconds_), predicate);
+      }
+      --num_waiters_;
+    }
+    if (!reserved) {
+      ++num_failed_allocations_;
+      return Status::OutOfMemory("allocation of size ", size,
+                                 " exceeds memory limit: ", bytes_allocated(),
+                                 " bytes allocated, limit is ", limit_);
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  void Release(int64_t size) {
+    stats_.UpdateAllocatedBytes(-size);
+    reserved_ -= size;
+    if (num_waiters_.load() > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cv_.notify_all();
+    }
+  }
+
+  void RecordAllocation(int64_t size) {
+    ++num_allocations_;
+    const int bucket =
+        size <= 1 ? 0
+                  : std::min(BitUtil::Log2(static_cast<uint64_t>(size)),
+                             kNumHistogramBuckets - 1);
+    ++histogram_[bucket];
+  }
+
+  MemoryPool* pool_;
+  const int64_t limit_;
+  const double timeout_seconds_;
+
+  // The bytes allocated or being allocated, checked against the limit
+  std::atomic<int64_t> reserved_;
+  std::atomic<int> num_waiters_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+
+  std::atomic<int64_t> num_allocations_;
+  std::atomic<int64_t> num_failed_allocations_;
+  std::atomic<int64_t> histogram_[kNumHistogramBuckets];
+  internal::MemoryPoolStats stats_;
+};
+
+constexpr int LimitedMemoryPool::kNumHistogramBuckets;
+
+LimitedMemoryPool::LimitedMemoryPool(MemoryPool* pool, int64_t limit,
+                                     double timeout_seconds)
+    : impl_(new LimitedMemoryPoolImpl(pool, limit, timeout_seconds)) {}
+
+LimitedMemoryPool::~LimitedMemoryPool() {}
+
+Status LimitedMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status LimitedMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                     uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void LimitedMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t LimitedMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t LimitedMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t LimitedMemoryPool::limit() const { return impl_->limit(); }
+
+int64_t LimitedMemoryPool::num_allocations() const { return impl_->num_allocations(); }
+
+int64_t LimitedMemoryPool::num_failed_allocations() const {
+  return impl_->num_failed_allocations();
+}
+
+std::vector<int64_t> LimitedMemoryPool::allocation_size_histogram() const {
+  return impl_->allocation_size_histogram();
+}
+
 }  // namespace arrow
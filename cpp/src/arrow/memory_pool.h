@@ -21,6 +21,7 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
@@ -56,6 +57,21 @@ class MemoryPoolStats {
 
 }  // namespace internal
 
+/// \brief Options for creating a default memory pool
+struct ARROW_EXPORT MemoryPoolOptions {
+  /// Allocations of at least this many bytes are considered large and
+  /// aligned on page boundaries.  A negative value disables the options below.
+  int64_t large_allocation_threshold = -1;
+  /// Back large allocations with transparent huge pages, where supported
+  /// (Linux only)
+  bool use_huge_pages = false;
+  /// Place large allocations on the NUMA node of the allocating thread,
+  /// where supported (Linux only)
+  bool numa_local = false;
+
+  static MemoryPoolOptions Defaults();
+};
+
 /// Base class for memory allocation.
 ///
 /// Besides tracking the number of allocated bytes, the allocator also should
@@ -67,6 +83,10 @@ class ARROW_EXPORT MemoryPool {
   /// \brief EXPERIMENTAL. Create a new instance of the default MemoryPool
   static std::unique_ptr<MemoryPool> CreateDefault();
 
+  /// \brief EXPERIMENTAL. Create a new instance of the default MemoryPool
+  /// with the given allocation options
+  static std::unique_ptr<MemoryPool> CreateDefault(const MemoryPoolOptions& options);
+
   /// Allocate a new memory region of at least size bytes.
   ///
   /// The allocated region shall be 64-byte aligned.
@@ -141,6 +161,107 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A caching memory pool for short-lived allocations
+///
+/// Allocations up to a maximum size are rounded up to a power-of-two size
+/// class, and freed blocks are kept in per-thread free lists rather than
+/// returned to the parent pool, so that they can be reused by subsequent
+/// allocations of the same size class.  Larger allocations are forwarded
+/// to the parent pool.
+///
+/// Memory held by this pool is returned to the parent pool on destruction
+/// or when calling ReleaseUnused().
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  /// \param[in] parent the pool to obtain memory from
+  /// \param[in] max_cached_size the largest allocation size to cache
+  explicit ArenaMemoryPool(MemoryPool* parent, int64_t max_cached_size = 1 << 20);
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// \brief Release all allocations at once
+  ///
+  /// All memory allocated from this pool becomes available for reuse, and
+  /// bytes_allocated() drops to 0.  Cached blocks are kept, larger allocations
+  /// are returned to the parent pool.  Memory allocated before the call must
+  /// not be used nor freed afterwards.  Must not be called concurrently with
+  /// other methods.
+  void Reset();
+
+  /// \brief Return the cached free blocks to the parent pool
+  void ReleaseUnused();
+
+  /// The number of bytes allocated and not yet freed through this pool.
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// The number of bytes currently obtained from the parent pool, including
+  /// cached free blocks.
+  int64_t bytes_reserved() const;
+
+ private:
+  class ArenaMemoryPoolImpl;
+  std::unique_ptr<ArenaMemoryPoolImpl> impl_;
+};
+
+/// \brief A memory pool enforcing a limit on the bytes allocated through it
+///
+/// Allocations beyond the limit fail with Status::OutOfMemory, optionally
+/// after waiting for other allocations to be freed.  Actual allocation is
+/// delegated to the parent pool.
+///
+/// Pools can be chained to bound and attribute memory usage hierarchically:
+/// a LimitedMemoryPool whose parent is another LimitedMemoryPool (for example
+/// one per reader, on top of one per query) is subject to both limits.
+///
+/// The pool also counts allocations, with a histogram of allocation sizes.
+class ARROW_EXPORT LimitedMemoryPool : public MemoryPool {
+ public:
+  /// The number of allocation size histogram buckets
+  static constexpr int kNumHistogramBuckets = 64;
+
+  /// \param[in] pool the pool to delegate allocations to
+  /// \param[in] limit the maximum number of bytes allocated at once
+  /// \param[in] timeout_seconds how long an allocation beyond the limit waits
+  /// for memory to be freed before failing.  A negative value waits forever.
+  LimitedMemoryPool(MemoryPool* pool, int64_t limit, double timeout_seconds = 0);
+  ~LimitedMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// The configured limit, in bytes
+  int64_t limit() const;
+
+  /// The number of successful calls to Allocate() and Reallocate()
+  int64_t num_allocations() const;
+
+  /// The number of calls to Allocate() and Reallocate() that failed
+  int64_t num_failed_allocations() const;
+
+  /// \brief The histogram of successful allocation sizes
+  ///
+  /// Bucket 0 counts allocations of at most 1 byte, bucket i > 0 counts
+  /// allocations of (2^(i-1), 2^i] bytes.  Reallocations are counted with
+  /// their new size.
+  std::vector<int64_t> allocation_size_histogram() const;
+
+ private:
+  class LimitedMemoryPoolImpl;
+  std::unique_ptr<LimitedMemoryPoolImpl> impl_;
+};
+
 /// Return the process-wide default memory pool.
 ARROW_EXPORT MemoryPool* default_memory_pool();
 
@@ -139,6 +139,55 @@ TEST_F(TestChunkedArray, SliceEquals) {
   ASSERT_TRUE(slice5->type()->Equals(one_->type()));
 }
 
+TEST_F(TestChunkedArray, Rechunk) {
+  for (int64_t length : {100, 10, 10, 10, 200, 0, 30}) {
+    arrays_one_.push_back(MakeRandomArray<Int32Array>(length));
+  }
+  Construct();
+
+  RechunkOptions options;
+  options.target_chunk_length = 64;
+  std::shared_ptr<ChunkedArray> result;
+  ASSERT_OK(Rechunk(*one_, options, default_memory_pool(), &result));
+  ASSERT_TRUE(result->Equals(*one_));
+
+  // Small chunks are merged, long and isolated chunks are passed through
+  ASSERT_EQ(4, result->num_chunks());
+  ASSERT_EQ(100, result->chunk(0)->length());
+  ASSERT_EQ(30, result->chunk(1)->length());
+  ASSERT_EQ(200, result->chunk(2)->length());
+  ASSERT_EQ(30, result->chunk(3)->length());
+  ASSERT_EQ(arrays_one_[0], result->chunk(0));
+  ASSERT_EQ(arrays_one_[4], result->chunk(2));
+  ASSERT_EQ(arrays_one_[6], result->chunk(3));
+
+  // Everything fits in one chunk
+  options.target_chunk_length = 1000;
+  ASSERT_OK(Rechunk(*one_, options, default_memory_pool(), &result));
+  ASSERT_TRUE(result->Equals(*one_));
+  ASSERT_EQ(1, result->num_chunks());
+}
+
+TEST_F(TestChunkedArray, RechunkZeroCopy) {
+  auto array = MakeRandomArray<Int32Array>(100);
+  arrays_one_ = {array->Slice(0, 10), array->Slice(10, 20), array->Slice(30, 70)};
+  Construct();
+
+  RechunkOptions options;
+  options.target_chunk_length = 100;
+  std::shared_ptr<ChunkedArray> result;
+  ASSERT_OK(Rechunk(*one_, options, default_memory_pool(), &result));
+  ASSERT_TRUE(result->Equals(*one_));
+  ASSERT_EQ(1, result->num_chunks());
+  ASSERT_EQ(array->data()->buffers, result->chunk(0)->data()->buffers);
+
+  options.zero_copy_if_contiguous = false;
+  ASSERT_OK(Rechunk(*one_, options, default_memory_pool(), &result));
+  ASSERT_TRUE(result->Equals(*one_));
+  ASSERT_EQ(1, result->num_chunks());
+  ASSERT_NE(array->data()->buffers[1], result->chunk(0)->data()->buffers[1]);
+}
+
 class TestColumn : public TestChunkedArray {
  protected:
   void Construct() override {
@@ -432,6 +481,48 @@ TEST_F(TestTable, ConcatenateTables) {
   ASSERT_RAISES(Invalid, ConcatenateTables({t1, t3}, &result));
 }
 
+TEST_F(TestTable, Slice) {
+  const int64_t length = 100;
+  MakeExample1(length);
+  table_ = Table::Make(schema_, columns_);
+
+  auto slice = table_->Slice(10, 20);
+  ASSERT_OK(slice->Validate());
+  ASSERT_EQ(20, slice->num_rows());
+  ASSERT_TRUE(slice->schema()->Equals(*schema_));
+  for (int i = 0; i < slice->num_columns(); ++i) {
+    AssertChunkedEqual(ChunkedArray(arrays_[i]->Slice(10, 20)),
+                       *slice->column(i)->data());
+    // Zero-copy
+    ASSERT_EQ(arrays_[i]->data()->buffers[1],
+              slice->column(i)->data()->chunk(0)->data()->buffers[1]);
+  }
+
+  ASSERT_EQ(10, table_->Slice(90, 50)->num_rows());
+  ASSERT_EQ(10, table_->Slice(90)->num_rows());
+  ASSERT_EQ(0, table_->Slice(length)->num_rows());
+}
+
+TEST_F(TestTable, Rechunk) {
+  const int64_t length = 10;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int i = 0; i < 5; ++i) {
+    MakeExample1(length);
+    batches.push_back(RecordBatch::Make(schema_, length, arrays_));
+  }
+  ASSERT_OK(Table::FromRecordBatches(batches, &table_));
+
+  RechunkOptions options;
+  options.target_chunk_length = 20;
+  std::shared_ptr<Table> result;
+  ASSERT_OK(Rechunk(*table_, options, default_memory_pool(), &result));
+  ASSERT_OK(result->Validate());
+  ASSERT_TRUE(result->Equals(*table_));
+  for (int i = 0; i < result->num_columns(); ++i) {
+    ASSERT_EQ(3, result->column(i)->data()->num_chunks());
+  }
+}
+
 TEST_F(TestTable, RemoveColumn) {
   const int64_t length = 10;
   MakeExample1(length);
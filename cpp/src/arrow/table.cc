@@ -29,6 +29,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/concatenate.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/stl.h"
 
@@ -436,6 +437,17 @@ Status Table::FromRecordBatches(const std::vector<std::shared_ptr<RecordBatch>>&
   return FromRecordBatches(batches[0]->schema(), batches, table);
 }
 
+std::shared_ptr<Table> Table::Slice(int64_t offset, int64_t length) const {
+  DCHECK_LE(offset, num_rows_);
+  length = std::min(length, num_rows_ - offset);
+
+  std::vector<std::shared_ptr<Column>> columns(num_columns());
+  for (int i = 0; i < num_columns(); ++i) {
+    columns[i] = column(i)->Slice(offset, length);
+  }
+  return Table::Make(schema_, columns, length);
+}
+
 Status ConcatenateTables(const std::vector<std::shared_ptr<Table>>& tables,
                          std::shared_ptr<Table>* table) {
   if (tables.size() == 0) {
@@ -471,6 +483,59 @@ Status ConcatenateTables(const std::vector<std::shared_ptr<Table>>& tables,
   return Status::OK();
 }
 
+RechunkOptions RechunkOptions::Defaults() { return RechunkOptions(); }
+
+Status Rechunk(const ChunkedArray& array, const RechunkOptions& options,
+               MemoryPool* pool, std::shared_ptr<ChunkedArray>* out) {
+  ConcatenateOptions concatenate_options;
+  concatenate_options.zero_copy_if_contiguous = options.zero_copy_if_contiguous;
+
+  ArrayVector chunks;
+  ArrayVector group;
+  int64_t group_length = 0;
+
+  auto FlushGroup = [&]() -> Status {
+    if (group.size() == 1) {
+      chunks.push_back(group[0]);
+    } else if (group.size() > 1) {
+      std::shared_ptr<Array> merged;
+      RETURN_NOT_OK(Concatenate(group, pool, concatenate_options, &merged));
+      chunks.push_back(merged);
+    }
+    group.clear();
+    group_length = 0;
+    return Status::OK();
+  };
+
+  for (const auto& chunk : array.chunks()) {
+    if (chunk->length() == 0) {
+      continue;
+    }
+    if (group_length + chunk->length() > options.target_chunk_length) {
+      RETURN_NOT_OK(FlushGroup());
+    }
+    group.push_back(chunk);
+    group_length += chunk->length();
+  }
+  RETURN_NOT_OK(FlushGroup());
+
+  *out = std::make_shared<ChunkedArray>(chunks, array.type());
+  return Status::OK();
+}
+
+Status Rechunk(const Table& table, const RechunkOptions& options, MemoryPool* pool,
+               std::shared_ptr<Table>* out) {
+  std::vector<std::shared_ptr<Column>> columns(table.num_columns());
+  for (int i = 0; i < table.num_columns(); ++i) {
+    const auto& column = table.column(i);
+    std::shared_ptr<ChunkedArray> data;
+    RETURN_NOT_OK(Rechunk(*column->data(), options, pool, &data));
+    columns[i] = std::make_shared<Column>(column->field(), data);
+  }
+  *out = Table::Make(table.schema(), columns, table.num_rows());
+  return Status::OK();
+}
+
 bool Table::Equals(const Table& other) const {
   if (this == &other) {
     return true;
@@ -285,6 +285,19 @@ class ARROW_EXPORT Table {
   /// \brief Perform any checks to validate the input arguments
   virtual Status Validate() const = 0;
 
+  /// \brief Construct a zero-copy slice of the table with the indicated
+  /// offset and length
+  ///
+  /// \param[in] offset the index of the first row in the constructed slice
+  /// \param[in] length the number of rows of the slice. If there are not enough
+  /// rows in the table, the length will be adjusted accordingly
+  ///
+  /// \return a new object wrapped in std::shared_ptr<Table>
+  std::shared_ptr<Table> Slice(int64_t offset, int64_t length) const;
+
+  /// \brief Slice from first row at offset until end of the table
+  std::shared_ptr<Table> Slice(int64_t offset) const { return Slice(offset, num_rows_); }
+
   /// \brief Return the number of columns in the table
   int num_columns() const { return schema_->num_fields(); }
 
@@ -342,6 +355,45 @@ ARROW_EXPORT
 Status ConcatenateTables(const std::vector<std::shared_ptr<Table>>& tables,
                          std::shared_ptr<Table>* table);
 
+/// \brief Options for Rechunk
+struct ARROW_EXPORT RechunkOptions {
+  /// Consecutive chunks are merged as long as the merged chunk has at most
+  /// this many rows.  Chunks already longer than this are left as-is.
+  int64_t target_chunk_length = 1 << 16;
+  /// Merge chunks which are adjacent slices of the same buffers by reference
+  /// rather than copying them
+  bool zero_copy_if_contiguous = true;
+
+  static RechunkOptions Defaults();
+};
+
+/// \brief Coalesce small chunks of a chunked array into larger ones
+///
+/// Chunks are never split, and only merged chunks are copied: a chunk which
+/// is not merged with any neighbour is passed through unchanged.
+///
+/// \param[in] array the chunked array to rechunk
+/// \param[in] options the target chunk length and merge behaviour
+/// \param[in] pool memory pool for the merged chunks
+/// \param[out] out the rechunked array
+/// \return Status
+ARROW_EXPORT
+Status Rechunk(const ChunkedArray& array, const RechunkOptions& options,
+               MemoryPool* pool, std::shared_ptr<ChunkedArray>* out);
+
+/// \brief Coalesce small chunks of each column of a table into larger ones
+///
+/// Each column is rechunked independently, see Rechunk(const ChunkedArray&, ...).
+///
+/// \param[in] table the table to rechunk
+/// \param[in] options the target chunk length and merge behaviour
+/// \param[in] pool memory pool for the merged chunks
+/// \param[out] out the rechunked table
+/// \return Status
+ARROW_EXPORT
+Status Rechunk(const Table& table, const RechunkOptions& options, MemoryPool* pool,
+               std::shared_ptr<Table>* out);
+
 }  // namespace arrow
 
 #endif  // ARROW_TABLE_H
@@ -0,0 +1,457 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/tracing_memory_pool.h"
+
+#ifdef ARROW_WITH_BACKTRACE
+#include <execinfo.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+namespace {
+
+constexpr int kMaxBacktraceDepth = 16;
+// Frames of the tracing machinery omitted from backtraces
+constexpr int kSkippedFrames = 3;
+// Pools whose buffers a thread finds without taking a lock
+constexpr int kCachedPools = 4;
+
+enum EventKind : int64_t { ALLOCATE = 1, REALLOCATE = 2, FREE = 3 };
+
+// A plain copy of a recorded event
+struct Event {
+  int64_t kind;
+  int64_t timestamp;
+  uintptr_t ptr;
+  uintptr_t old_ptr;
+  int64_t size;
+  int64_t old_size;
+  std::vector<uintptr_t> backtrace;
+};
+
+// An event slot, written by a single thread and read concurrently by
+// Summarize() using a sequence number (a seqlock), hence the relaxed atomics.
+struct EventSlot {
+  // 1 + the index of the event in the slot, 0 while being written
+  std::atomic<uint64_t> seq{0};
+  std::atomic<int64_t> kind{0};
+  std::atomic<int64_t> timestamp{0};
+  std::atomic<uintptr_t> ptr{0};
+  std::atomic<uintptr_t> old_ptr{0};
+  std::atomic<int64_t> size{0};
+  std::atomic<int64_t> old_size{0};
+  std::atomic<int> num_frames{0};
+  std::atomic<uintptr_t> frames[kMaxBacktraceDepth];
+};
+
+// The events and counters recorded by a thread
+//
+// The ring of event slots is allocated lazily by chunks, so that threads
+// recording few events don't pay for the whole capacity.
+struct ThreadBuffer {
+  static constexpr uint64_t kChunkSize = 256;
+
+  explicit ThreadBuffer(int64_t capacity)
+      : capacity(static_cast<uint64_t>(capacity)),
+        chunk_size(std::min(kChunkSize, this->capacity)),
+        num_chunks((this->capacity + chunk_size - 1) / chunk_size),
+        chunks(new std::atomic<EventSlot*>[num_chunks]()) {}
+
+  ~ThreadBuffer() {
+    for (uint64_t i = 0; i < num_chunks; ++i) {
+      delete[] chunks[i].load();
+    }
+  }
+
+  // The slot of the event with the given index, for the owning thread
+  EventSlot& MutableSlot(uint64_t index) {
+    const uint64_t position = index % capacity;
+    std::atomic<EventSlot*>& chunk = chunks[position / chunk_size];
+    EventSlot* slots = chunk.load(std::memory_order_relaxed);
+    if (slots == nullptr) {
+      slots = new EventSlot[chunk_size];
+      chunk.store(slots, std::memory_order_release);
+    }
+    return slots[position % chunk_size];
+  }
+
+  // The slot of the event with the given index, null if not allocated yet
+  const EventSlot* Slot(uint64_t index) const {
+    const uint64_t position = index % capacity;
+    const EventSlot* slots = chunks[position / chunk_size].load(std::memory_order_acquire);
+    return slots == nullptr ? nullptr : &slots[position % chunk_size];
+  }
+
+  void Record(int64_t kind, uintptr_t ptr, uintptr_t old_ptr, int64_t size,
+              int64_t old_size, const void* const* frames, int num_frames) {
+    const uint64_t index = num_events.load(std::memory_order_relaxed);
+    EventSlot& slot = MutableSlot(index);
+    slot.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.kind.store(kind, std::memory_order_relaxed);
+    slot.timestamp.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now().time_since_epoch())
+                             .count(),
+                         std::memory_order_relaxed);
+    slot.ptr.store(ptr, std::memory_order_relaxed);
+    slot.old_ptr.store(old_ptr, std::memory_order_relaxed);
+    slot.size.store(size, std::memory_order_relaxed);
+    slot.old_size.store(old_size, std::memory_order_relaxed);
+    slot.num_frames.store(num_frames, std::memory_order_relaxed);
+    for (int i = 0; i < num_frames; ++i) {
+      slot.frames[i].store(reinterpret_cast<uintptr_t>(frames[i]),
+                           std::memory_order_relaxed);
+    }
+    slot.seq.store(index + 1, std::memory_order_release);
+    num_events.store(index + 1, std::memory_order_release);
+  }
+
+  // Append the events still present in the buffer to `out`
+  void Collect(std::vector<Event>* out) const {
+    const uint64_t end = num_events.load(std::memory_order_acquire);
+    const uint64_t begin = end > capacity ? end - capacity : 0;
+    for (uint64_t index = begin; index < end; ++index) {
+      const EventSlot* slot_ptr = Slot(index);
+      if (slot_ptr == nullptr) {
+        continue;
+      }
+      const EventSlot& slot = *slot_ptr;
+      if (slot.seq.load(std::memory_order_acquire) != index + 1) {
+        // Overwritten in the meantime
+        continue;
+      }
+      Event event;
+      event.kind = slot.kind.load(std::memory_order_relaxed);
+      event.timestamp = slot.timestamp.load(std::memory_order_relaxed);
+      event.ptr = slot.ptr.load(std::memory_order_relaxed);
+      event.old_ptr = slot.old_ptr.load(std::memory_order_relaxed);
+      event.size = slot.size.load(std::memory_order_relaxed);
+      event.old_size = slot.old_size.load(std::memory_order_relaxed);
+      const int num_frames =
+          std::min(slot.num_frames.load(std::memory_order_relaxed), kMaxBacktraceDepth);
+      for (int i = 0; i < num_frames; ++i) {
+        event.backtrace.push_back(slot.frames[i].load(std::memory_order_relaxed));
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.seq.load(std::memory_order_relaxed) != index + 1) {
+        continue;
+      }
+      out->push_back(std::move(event));
+    }
+  }
+
+  const uint64_t capacity;
+  const uint64_t chunk_size;
+  const uint64_t num_chunks;
+  std::unique_ptr<std::atomic<EventSlot*>[]> chunks;
+  std::atomic<uint64_t> num_events{0};
+
+  // Totals, only updated by the owning thread
+  std::atomic<int64_t> num_allocations{0};
+  std::atomic<int64_t> num_reallocations{0};
+  std::atomic<int64_t> num_frees{0};
+  std::atomic<int64_t> bytes_allocated{0};
+  std::atomic<int64_t> bytes_reallocated{0};
+  // Only accessed by the owning thread
+  int64_t sampling_counter = 0;
+};
+
+// Add `value` to an atomic only written by the current thread
+void Increment(std::atomic<int64_t>* counter, int64_t value) {
+  counter->store(counter->load(std::memory_order_relaxed) + value,
+                 std::memory_order_relaxed);
+}
+
+constexpr uint64_t ThreadBuffer::kChunkSize;
+
+std::atomic<int64_t> next_pool_id(0);
+
+}  // namespace
+
+TracingOptions TracingOptions::Defaults() { return TracingOptions(); }
+
+///////////////////////////////////////////////////////////////////////
+// TracingMemoryPool implementation
+
+class TracingMemoryPool::TracingMemoryPoolImpl {
+ public:
+  TracingMemoryPoolImpl(MemoryPool* pool, const TracingOptions& options)
+      : pool_(pool), options_(options), id_(next_pool_id++) {
+    options_.events_per_thread = std::max<int64_t>(options_.events_per_thread, 1);
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    ThreadBuffer* buffer = GetThreadBuffer();
+    Increment(&buffer->num_allocations, 1);
+    Increment(&buffer->bytes_allocated, size);
+    RecordSampled(buffer, ALLOCATE, *out, nullptr, size, 0);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    uint8_t* old_ptr = *ptr;
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    ThreadBuffer* buffer = GetThreadBuffer();
+    Increment(&buffer->num_reallocations, 1);
+    Increment(&buffer->bytes_allocated, std::max<int64_t>(new_size - old_size, 0));
+    if (*ptr != old_ptr) {
+      Increment(&buffer->bytes_reallocated, std::min(old_size, new_size));
+    }
+    RecordSampled(buffer, REALLOCATE, *ptr, old_ptr, new_size, old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+    ThreadBuffer* thread_buffer = GetThreadBuffer();
+    Increment(&thread_buffer->num_frees, 1);
+    thread_buffer->Record(FREE, reinterpret_cast<uintptr_t>(buffer), 0, size, 0,
+                          nullptr, 0);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  TracingSummary Summarize(int max_sites) const {
+    TracingSummary summary;
+    std::vector<Event> events;
+    // Buffers live as long as the pool, only the list is copied under the
+    // lock so that threads using the pool for the first time aren't stalled
+    std::vector<const ThreadBuffer*> buffers;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& buffer : buffers_) {
+        buffers.push_back(buffer.get());
+      }
+    }
+    for (const ThreadBuffer* buffer : buffers) {
+      summary.num_allocations += buffer->num_allocations.load();
+      summary.num_reallocations += buffer->num_reallocations.load();
+      summary.num_frees += buffer->num_frees.load();
+      summary.bytes_allocated += buffer->bytes_allocated.load();
+      summary.bytes_reallocated += buffer->bytes_reallocated.load();
+      buffer->Collect(&events);
+    }
+    std::stable_sort(events.begin(), events.end(), [](const Event& a, const Event& b) {
+      return a.timestamp < b.timestamp;
+    });
+
+    // Match allocations and frees to compute lifetimes, and aggregate
+    // sampled events by call site
+    std::unordered_map<uintptr_t, int64_t> live;
+    std::vector<int64_t> lifetimes;
+    std::map<std::vector<uintptr_t>, TracingSummary::Site> sites;
+    auto end_lifetime = [&](uintptr_t ptr, int64_t timestamp) {
+      auto it = live.find(ptr);
+      if (it != live.end()) {
+        lifetimes.push_back(timestamp - it->second);
+        live.erase(it);
+      }
+    };
+    for (const auto& event : events) {
+      if (event.kind == FREE) {
+        end_lifetime(event.ptr, event.timestamp);
+        continue;
+      }
+      if (event.kind == REALLOCATE) {
+        end_lifetime(event.old_ptr, event.timestamp);
+      }
+      live[event.ptr] = event.timestamp;
+      if (event.backtrace.empty()) {
+        continue;
+      }
+      auto& site = sites[event.backtrace];
+      if (event.kind == ALLOCATE) {
+        ++site.num_allocations;
+        site.bytes_allocated += event.size;
+      } else {
+        ++site.num_reallocations;
+        site.bytes_allocated += std::max<int64_t>(event.size - event.old_size, 0);
+        if (event.ptr != event.old_ptr) {
+          site.bytes_reallocated += std::min(event.size, event.old_size);
+        }
+      }
+    }
+
+    if (!lifetimes.empty()) {
+      std::sort(lifetimes.begin(), lifetimes.end());
+      int64_t total = 0;
+      for (const int64_t lifetime : lifetimes) {
+        total += lifetime;
+      }
+      summary.num_lifetimes = static_cast<int64_t>(lifetimes.size());
+      summary.mean_lifetime_ns = total / summary.num_lifetimes;
+      summary.median_lifetime_ns = lifetimes[lifetimes.size() / 2];
+      summary.max_lifetime_ns = lifetimes.back();
+    }
+
+    for (auto& pair : sites) {
+      pair.second.backtrace = pair.first;
+      summary.top_sites.push_back(std::move(pair.second));
+    }
+    std::stable_sort(summary.top_sites.begin(), summary.top_sites.end(),
+                     [](const TracingSummary::Site& a, const TracingSummary::Site& b) {
+                       return a.bytes_allocated > b.bytes_allocated;
+                     });
+    if (static_cast<int>(summary.top_sites.size()) > max_sites) {
+      summary.top_sites.resize(std::max(max_sites, 0));
+    }
+    return summary;
+  }
+
+ private:
+  ThreadBuffer* GetThreadBuffer() {
+    // The buffers of the current thread for the last few pools it used, so
+    // that alternating between pools doesn't take the lock.  Pool ids aren't
+    // reused, so a destroyed pool's buffer is never looked up.
+    struct CachedBuffers {
+      CachedBuffers() { std::fill(pool_ids, pool_ids + kCachedPools, -1); }
+      int64_t pool_ids[kCachedPools];
+      ThreadBuffer* buffers[kCachedPools] = {};
+      int next = 0;
+    };
+    static thread_local CachedBuffers cached;
+    for (int i = 0; i < kCachedPools; ++i) {
+      if (cached.pool_ids[i] == id_) {
+        return cached.buffers[i];
+      }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& buffer = thread_buffers_[std::this_thread::get_id()];
+    if (buffer == nullptr) {
+      buffers_.emplace_back(new ThreadBuffer(options_.events_per_thread));
+      buffer = buffers_.back().get();
+    }
+    cached.pool_ids[cached.next] = id_;
+    cached.buffers[cached.next] = buffer;
+    cached.next = (cached.next + 1) % kCachedPools;
+    return buffer;
+  }
+
+  void RecordSampled(ThreadBuffer* buffer, int64_t kind, const uint8_t* ptr,
+                     const uint8_t* old_ptr, int64_t size, int64_t old_size) {
+    void* frames[kMaxBacktraceDepth + kSkippedFrames];
+    int num_frames = 0;
+#ifdef ARROW_WITH_BACKTRACE
+    if (options_.backtrace_sampling > 0 &&
+        buffer->sampling_counter++ % options_.backtrace_sampling == 0) {
+      num_frames = std::max(
+          backtrace(frames, kMaxBacktraceDepth + kSkippedFrames) - kSkippedFrames, 0);
+    }
+#endif
+    buffer->Record(kind, reinterpret_cast<uintptr_t>(ptr),
+                   reinterpret_cast<uintptr_t>(old_ptr), size, old_size,
+                   frames + kSkippedFrames, num_frames);
+  }
+
+  MemoryPool* pool_;
+  TracingOptions options_;
+  const int64_t id_;
+
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+  // Buffer of each thread, reused by a later thread with the same id
+  std::unordered_map<std::thread::id, ThreadBuffer*> thread_buffers_;
+  internal::MemoryPoolStats stats_;
+};
+
+TracingMemoryPool::TracingMemoryPool(MemoryPool* pool, const TracingOptions& options)
+    : impl_(new TracingMemoryPoolImpl(pool, options)) {}
+
+TracingMemoryPool::~TracingMemoryPool() {}
+
+Status TracingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status TracingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                     uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void TracingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t TracingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t TracingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+TracingSummary TracingMemoryPool::Summarize(int max_sites) const {
+  return impl_->Summarize(max_sites);
+}
+
+///////////////////////////////////////////////////////////////////////
+// TracingSummary implementation
+
+std::string TracingSummary::ToString() const {
+  std::stringstream ss;
+  ss << "Allocations: " << num_allocations << ", reallocations: " << num_reallocations
+     << ", frees: " << num_frees << std::endl;
+  ss << "Bytes allocated: " << bytes_allocated
+     << ", bytes copied by reallocations: " << bytes_reallocated << std::endl;
+  if (num_lifetimes > 0) {
+    ss << "Lifetimes (ns) of " << num_lifetimes << " allocations: mean "
+       << mean_lifetime_ns << ", median " << median_lifetime_ns << ", max "
+       << max_lifetime_ns << std::endl;
+  }
+  for (size_t i = 0; i < top_sites.size(); ++i) {
+    const Site& site = top_sites[i];
+    ss << "Site #" << i << ": " << site.bytes_allocated << " bytes in "
+       << site.num_allocations << " allocations and " << site.num_reallocations
+       << " reallocations (" << site.bytes_reallocated << " bytes copied)" << std::endl;
+#ifdef ARROW_WITH_BACKTRACE
+    std::vector<void*> frames;
+    for (const uintptr_t frame : site.backtrace) {
+      frames.push_back(reinterpret_cast<void*>(frame));
+    }
+    char** symbols = backtrace_symbols(frames.data(), static_cast<int>(frames.size()));
+    if (symbols != nullptr) {
+      for (size_t j = 0; j < frames.size(); ++j) {
+        ss << "  " << symbols[j] << std::endl;
+      }
+      std::free(symbols);
+      continue;
+    }
+#endif
+    for (const uintptr_t frame : site.backtrace) {
+      ss << "  0x" << std::hex << frame << std::dec << std::endl;
+    }
+  }
+  return ss.str();
+}
+
+}  // namespace arrow
@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_TRACING_MEMORY_POOL_H
+#define ARROW_TRACING_MEMORY_POOL_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+/// \brief Options for TracingMemoryPool
+struct ARROW_EXPORT TracingOptions {
+  /// The number of most recent events retained per thread.  Each event takes
+  /// about 200 bytes, allocated as needed.
+  int64_t events_per_thread = 4096;
+  /// Capture the call-site backtrace of one out of every N allocations and
+  /// reallocations.  0 disables backtraces.  Backtraces are only available
+  /// when Arrow is built with ARROW_WITH_BACKTRACE.
+  int32_t backtrace_sampling = 0;
+
+  static TracingOptions Defaults();
+};
+
+/// \brief Aggregate statistics collected by TracingMemoryPool
+struct ARROW_EXPORT TracingSummary {
+  /// \brief Statistics for a call site, identified by its backtrace
+  struct Site {
+    std::vector<uintptr_t> backtrace;
+    int64_t num_allocations = 0;
+    int64_t num_reallocations = 0;
+    /// Bytes allocated, including growth by reallocations
+    int64_t bytes_allocated = 0;
+    /// Bytes copied by reallocations
+    int64_t bytes_reallocated = 0;
+  };
+
+  // Totals over all events, including those not retained anymore
+  int64_t num_allocations = 0;
+  int64_t num_reallocations = 0;
+  int64_t num_frees = 0;
+  int64_t bytes_allocated = 0;
+  int64_t bytes_reallocated = 0;
+
+  // Lifetimes of the allocations whose allocation and free were both
+  // retained, in nanoseconds
+  int64_t num_lifetimes = 0;
+  int64_t mean_lifetime_ns = 0;
+  int64_t median_lifetime_ns = 0;
+  int64_t max_lifetime_ns = 0;
+
+  /// The sampled call sites, by decreasing bytes allocated
+  std::vector<Site> top_sites;
+
+  /// \brief A human-readable report, with symbolized backtraces if available
+  std::string ToString() const;
+};
+
+/// \brief A memory pool recording allocation events for diagnostics
+///
+/// Each thread records the sizes and timestamps of its allocations,
+/// reallocations and frees, with optionally sampled call-site backtraces, in
+/// its own ring buffer.  Recording only takes a lock when a thread uses the
+/// pool for the first time, or after using more than a few other tracing
+/// pools since.  Summarize() can be called at any time from any thread, and
+/// only holds that lock while listing the buffers.  Actual allocation is
+/// delegated to the wrapped pool.
+class ARROW_EXPORT TracingMemoryPool : public MemoryPool {
+ public:
+  explicit TracingMemoryPool(MemoryPool* pool,
+                             const TracingOptions& options = TracingOptions::Defaults());
+  ~TracingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief Aggregate the recorded events
+  ///
+  /// \param[in] max_sites the maximum number of call sites to report
+  TracingSummary Summarize(int max_sites = 10) const;
+
+ private:
+  class TracingMemoryPoolImpl;
+  std::unique_ptr<TracingMemoryPoolImpl> impl_;
+};
+
+}  // namespace arrow
+
+#endif  // ARROW_TRACING_MEMORY_POOL_H
@@ -99,6 +99,14 @@ class ConcatenateTest : public ::testing::Test {
         if (actual->type_id() == Type::BOOL) {
           CheckTrailingBitsAreZeroed(actual->data()->buffers[1], actual->length());
         }
+
+        // Adjacent slices are concatenated by reference when allowed
+        ConcatenateOptions options;
+        options.zero_copy_if_contiguous = true;
+        ASSERT_OK(Concatenate(slices, default_memory_pool(), options, &actual));
+        AssertArraysEqual(*expected, *actual);
+        ASSERT_EQ(expected->null_count(), actual->null_count());
+        ASSERT_EQ(array->data()->buffers, actual->data()->buffers);
       }
     }
   }
@@ -172,6 +180,29 @@ TEST_F(ConcatenateTest, DictionaryType) {
   });
 }
 
+TEST_F(ConcatenateTest, ZeroCopyNonContiguous) {
+  auto array = GeneratePrimitive<Int32Type>(100, 0.5);
+  auto other = GeneratePrimitive<Int32Type>(100, 0.5);
+  ConcatenateOptions options;
+  options.zero_copy_if_contiguous = true;
+
+  // A gap between slices of the same array
+  std::shared_ptr<Array> actual, expected;
+  ArrayVector slices = {array->Slice(0, 10), array->Slice(20, 30)};
+  ASSERT_OK(Concatenate(slices, default_memory_pool(), &expected));
+  ASSERT_OK(Concatenate(slices, default_memory_pool(), options, &actual));
+  AssertArraysEqual(*expected, *actual);
+  ASSERT_NE(array->data()->buffers[1], actual->data()->buffers[1]);
+
+  // Slices of different arrays
+  slices = {array->Slice(0, 10), other->Slice(10, 30)};
+  ASSERT_OK(Concatenate(slices, default_memory_pool(), &expected));
+  ASSERT_OK(Concatenate(slices, default_memory_pool(), options, &actual));
+  AssertArraysEqual(*expected, *actual);
+  ASSERT_NE(array->data()->buffers[1], actual->data()->buffers[1]);
+  ASSERT_NE(other->data()->buffers[1], actual->data()->buffers[1]);
+}
+
 TEST_F(ConcatenateTest, DISABLED_UnionType) {
   // sparse mode
   Check([this](int32_t size, double null_probability, std::shared_ptr<Array>* out) {
@@ -295,8 +295,69 @@ class ConcatenateImpl {
 const std::shared_ptr<FixedWidthType> ConcatenateImpl::offset_type =
     std::static_pointer_cast<FixedWidthType>(int32());
 
+// Whether two ArrayData reference the same buffers, ignoring their own offset
+// and length.  Children are compared including offset and length, since
+// slicing a nested array leaves its children untouched.
+static bool SameStorage(const ArrayData& left, const ArrayData& right) {
+  if (left.buffers.size() != right.buffers.size() ||
+      left.child_data.size() != right.child_data.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < left.buffers.size(); ++i) {
+    const auto& l = left.buffers[i];
+    const auto& r = right.buffers[i];
+    if (l == r) {
+      continue;
+    }
+    if (!l || !r || l->data() != r->data() || l->size() != r->size()) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < left.child_data.size(); ++i) {
+    const auto& l = left.child_data[i];
+    const auto& r = right.child_data[i];
+    if (l == r) {
+      continue;
+    }
+    if (l->offset != r->offset || l->length != r->length || !SameStorage(*l, *r)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// If the arrays are adjacent slices of the same storage, output a zero-copy
+// slice spanning all of them and return true.
+static bool ConcatenateContiguous(const ArrayVector& arrays,
+                                  std::shared_ptr<Array>* out) {
+  const ArrayData& first = *arrays[0]->data();
+  int64_t length = first.length;
+  int64_t null_count = arrays[0]->null_count();
+  for (size_t i = 1; i < arrays.size(); ++i) {
+    const ArrayData& data = *arrays[i]->data();
+    if (data.offset != first.offset + length || !SameStorage(first, data)) {
+      return false;
+    }
+    length += data.length;
+    null_count += arrays[i]->null_count();
+  }
+
+  auto out_data = first.Copy();
+  out_data->length = length;
+  out_data->null_count = null_count;
+  *out = MakeArray(out_data);
+  return true;
+}
+
+ConcatenateOptions ConcatenateOptions::Defaults() { return ConcatenateOptions(); }
+
 Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
                    std::shared_ptr<Array>* out) {
+  return Concatenate(arrays, pool, ConcatenateOptions::Defaults(), out);
+}
+
+Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
+                   const ConcatenateOptions& options, std::shared_ptr<Array>* out) {
   if (arrays.size() == 0) {
     return Status::Invalid("Must pass at least one array");
   }
@@ -312,6 +373,10 @@ Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
     data[i] = ArrayData(*arrays[i]->data());
   }
 
+  if (options.zero_copy_if_contiguous && ConcatenateContiguous(arrays, out)) {
+    return Status::OK();
+  }
+
   ArrayData out_data;
   RETURN_NOT_OK(ConcatenateImpl(data, pool).Concatenate(&out_data));
   *out = MakeArray(std::make_shared<ArrayData>(std::move(out_data)));
@@ -26,6 +26,16 @@
 
 namespace arrow {
 
+/// \brief Options for Concatenate
+struct ARROW_EXPORT ConcatenateOptions {
+  /// If the arrays are adjacent slices of the same buffers (for example the
+  /// chunks obtained by slicing a single array), return a zero-copy slice
+  /// spanning all of them instead of copying into fresh buffers
+  bool zero_copy_if_contiguous = false;
+
+  static ConcatenateOptions Defaults();
+};
+
 /// \brief Concatenate arrays
 ///
 /// \param[in] arrays a vector of arrays to be concatenated
@@ -36,4 +46,15 @@ ARROW_EXPORT
 Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
                    std::shared_ptr<Array>* out);
 
+/// \brief Concatenate arrays
+///
+/// \param[in] arrays a vector of arrays to be concatenated
+/// \param[in] pool memory to store the result will be allocated from this memory pool
+/// \param[in] options whether the arrays may be concatenated by reference
+/// \param[out] out the resulting concatenated array
+/// \return Status
+ARROW_EXPORT
+Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
+                   const ConcatenateOptions& options, std::shared_ptr<Array>* out);
+
 }  // namespace arrow
@@ -0,0 +1,156 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/future.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+
+using internal::ThreadPool;
+
+TEST(TestFuture, MarkFinished) {
+  auto fut = Future<int>::Make();
+  ASSERT_TRUE(fut.is_valid());
+  ASSERT_FALSE(fut.is_finished());
+
+  std::thread thread([&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    fut.MarkFinished(Status::OK(), 42);
+  });
+  int value = 0;
+  ASSERT_OK(fut.Get(&value));
+  ASSERT_EQ(42, value);
+  ASSERT_TRUE(fut.is_finished());
+  thread.join();
+
+  auto failed = Future<int>::MakeFinished(Status::IOError("some error"));
+  ASSERT_TRUE(failed.is_finished());
+  ASSERT_RAISES(IOError, failed.Wait());
+  ASSERT_RAISES(IOError, failed.Get(&value));
+
+  ASSERT_FALSE(Future<int>().is_valid());
+}
+
+TEST(TestFuture, Callbacks) {
+  auto fut = Future<int>::Make();
+  int ncalls = 0;
+  fut.AddCallback([&]() { ++ncalls; });
+  ASSERT_EQ(0, ncalls);
+  fut.MarkFinished(Status::OK(), 1);
+  ASSERT_EQ(1, ncalls);
+  // Executed immediately on a finished future
+  fut.AddCallback([&]() { ++ncalls; });
+  ASSERT_EQ(2, ncalls);
+}
+
+TEST(TestFuture, Then) {
+  std::shared_ptr<ThreadPool> pool;
+  ASSERT_OK(ThreadPool::Make(2, &pool));
+
+  auto fut = Future<int>::Make();
+  auto doubled =
+      fut.Then<int>([](const int& value, int* out) {
+           *out = value * 2;
+           return Status::OK();
+         },
+         pool.get())
+          .Then<std::string>(
+              [](const int& value, std::string* out) {
+                *out = std::to_string(value);
+                return Status::OK();
+              },
+              pool.get());
+  ASSERT_FALSE(doubled.is_finished());
+  fut.MarkFinished(Status::OK(), 21);
+
+  std::string result;
+  ASSERT_OK(doubled.Get(&result));
+  ASSERT_EQ("42", result);
+
+  // Errors are propagated without executing continuations
+  std::atomic<int> ncalls(0);
+  auto failed = Future<int>::MakeFinished(Status::Invalid("xxx"));
+  auto next = failed.Then<int>([&](const int& value, int* out) {
+    ++ncalls;
+    return Status::OK();
+  });
+  ASSERT_RAISES(Invalid, next.Wait());
+  ASSERT_EQ(0, ncalls.load());
+
+  // Errors returned by continuations
+  auto erroring = Future<int>::MakeFinished(Status::OK(), 1).Then<int>(
+      [](const int& value, int* out) { return Status::IOError("yyy"); }, nullptr);
+  ASSERT_TRUE(erroring.is_finished());
+  ASSERT_RAISES(IOError, erroring.Wait());
+
+  // Continuations can't be spawned on a shut down pool
+  ASSERT_OK(pool->Shutdown());
+  auto unspawned = Future<int>::MakeFinished(Status::OK(), 1).Then<int>(
+      [](const int& value, int* out) { return Status::OK(); }, pool.get());
+  ASSERT_RAISES(Invalid, unspawned.Wait());
+}
+
+TEST(TestFuture, Async) {
+  std::shared_ptr<ThreadPool> pool;
+  ASSERT_OK(ThreadPool::Make(4, &pool));
+
+  const int kNumTasks = 20;
+  std::vector<Future<int>> futures;
+  for (int i = 0; i < kNumTasks; ++i) {
+    futures.push_back(Async<int>(pool.get(), [i](int* out) {
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+      *out = i;
+      return Status::OK();
+    }));
+  }
+  std::vector<int> values;
+  ASSERT_OK(AllComplete(futures).Get(&values));
+  ASSERT_EQ(kNumTasks, static_cast<int>(values.size()));
+  for (int i = 0; i < kNumTasks; ++i) {
+    ASSERT_EQ(i, values[i]);
+  }
+}
+
+TEST(TestFuture, AllComplete) {
+  std::vector<int> values;
+  ASSERT_OK(AllComplete(std::vector<Future<int>>()).Get(&values));
+  ASSERT_EQ(0, values.size());
+
+  std::vector<Future<int>> futures = {Future<int>::Make(), Future<int>::Make(),
+                                      Future<int>::Make()};
+  auto all = AllComplete(futures);
+  futures[2].MarkFinished(Status::OK(), 3);
+  futures[1].MarkFinished(Status::IOError("xxx"));
+  ASSERT_FALSE(all.is_finished());
+  futures[0].MarkFinished(Status::OK(), 1);
+  ASSERT_TRUE(all.is_finished());
+  ASSERT_RAISES(IOError, all.Get(&values));
+}
+
+}  // namespace arrow
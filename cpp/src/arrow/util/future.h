@@ -0,0 +1,232 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_FUTURE_H
+#define ARROW_UTIL_FUTURE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+namespace internal {
+
+class ThreadPool;
+
+// Run a task on the given thread pool, or inline if the pool is null.
+// Defined out of line to avoid including thread-pool.h.
+ARROW_EXPORT Status SpawnOrRun(ThreadPool* pool, std::function<void()> task);
+
+// The default thread pool for executing continuations
+ARROW_EXPORT ThreadPool* GetDefaultContinuationExecutor();
+
+}  // namespace internal
+
+/// \brief A value of type T (or an error) that will be available later
+///
+/// A Future is a handle to a shared state, which is finished exactly once
+/// by MarkFinished().  Consumers can either wait for completion, or
+/// register continuations that are executed once the future is finished,
+/// without blocking a thread.
+///
+/// T must be default-constructible and copyable or movable.
+template <typename T>
+class Future {
+ public:
+  using ValueType = T;
+
+  /// \brief Create an invalid future, see Make()
+  Future() = default;
+
+  /// \brief Create a pending future
+  static Future Make() { return Future(std::make_shared<State>()); }
+
+  /// \brief Create an already finished future
+  static Future MakeFinished(Status status, T value = T()) {
+    Future fut = Make();
+    fut.MarkFinished(std::move(status), std::move(value));
+    return fut;
+  }
+
+  /// \brief Whether this future refers to a shared state
+  bool is_valid() const { return state_ != nullptr; }
+
+  /// \brief Whether the value (or error) is available, non-blocking
+  bool is_finished() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->finished;
+  }
+
+  /// \brief Finish the future with the given status and value
+  ///
+  /// Waiting threads are woken up and continuations are executed.
+  /// The value is ignored if the status is an error.
+  void MarkFinished(Status status, T value = T()) {
+    std::vector<std::function<void()>> callbacks;
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      DCHECK(!state_->finished) << "Future finished twice";
+      state_->status = std::move(status);
+      state_->value = std::move(value);
+      state_->finished = true;
+      callbacks.swap(state_->callbacks);
+    }
+    state_->cv.notify_all();
+    for (auto& callback : callbacks) {
+      callback();
+    }
+  }
+
+  /// \brief Block until the future is finished and return its status
+  Status Wait() const {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->cv.wait(lock, [this]() { return state_->finished; });
+    return state_->status;
+  }
+
+  /// \brief Block until the future is finished and return its value
+  Status Get(T* out) const {
+    RETURN_NOT_OK(Wait());
+    *out = state_->value;
+    return Status::OK();
+  }
+
+  /// \brief Execute a callback once the future is finished
+  ///
+  /// The callback is executed inline, either immediately if the future is
+  /// already finished, or by the thread calling MarkFinished().  It should
+  /// therefore be cheap; use Then() for actual work.
+  void AddCallback(std::function<void()> callback) const {
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      if (!state_->finished) {
+        state_->callbacks.push_back(std::move(callback));
+        return;
+      }
+    }
+    callback();
+  }
+
+  /// \brief Chain a continuation computing a U from this future's value
+  ///
+  /// Once this future finishes successfully, `func` is executed on
+  /// `executor` (inline if null) with the value, and its result finishes the
+  /// returned future.  If this future fails, `func` isn't executed and the
+  /// returned future fails with the same error.
+  template <typename U>
+  Future<U> Then(std::function<Status(const T&, U*)> func,
+                 internal::ThreadPool* executor =
+                     internal::GetDefaultContinuationExecutor()) const {
+    auto next = Future<U>::Make();
+    auto state = state_;
+    AddCallback([state, next, func, executor]() mutable {
+      if (!state->status.ok()) {
+        next.MarkFinished(state->status);
+        return;
+      }
+      Status st = internal::SpawnOrRun(executor, [state, next, func]() mutable {
+        U out;
+        Status st = func(state->value, &out);
+        next.MarkFinished(std::move(st), std::move(out));
+      });
+      if (!st.ok()) {
+        // The continuation couldn't be spawned (the pool is shut down)
+        next.MarkFinished(std::move(st));
+      }
+    });
+    return next;
+  }
+
+ private:
+  struct State {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool finished = false;
+    Status status;
+    T value{};
+    std::vector<std::function<void()>> callbacks;
+  };
+
+  explicit Future(std::shared_ptr<State> state) : state_(std::move(state)) {}
+
+  std::shared_ptr<State> state_;
+};
+
+/// \brief Create a future finished when all given futures are finished
+///
+/// The returned future holds the values of the given futures, in order.
+/// It fails with the error of the first (in order) failed future, if any.
+template <typename T>
+Future<std::vector<T>> AllComplete(const std::vector<Future<T>>& futures) {
+  using Values = std::vector<T>;
+  auto all = Future<Values>::Make();
+  if (futures.empty()) {
+    all.MarkFinished(Status::OK());
+    return all;
+  }
+  auto shared_futures = std::make_shared<std::vector<Future<T>>>(futures);
+  auto remaining = std::make_shared<std::atomic<size_t>>(futures.size());
+  for (const auto& fut : futures) {
+    fut.AddCallback([shared_futures, all, remaining]() mutable {
+      if (remaining->fetch_sub(1) != 1) {
+        return;
+      }
+      // All finished, collect the results without blocking
+      Values values(shared_futures->size());
+      for (size_t i = 0; i < values.size(); ++i) {
+        Status st = (*shared_futures)[i].Get(&values[i]);
+        if (!st.ok()) {
+          all.MarkFinished(std::move(st));
+          return;
+        }
+      }
+      all.MarkFinished(Status::OK(), std::move(values));
+    });
+  }
+  return all;
+}
+
+/// \brief Execute a function asynchronously on a thread pool
+///
+/// Return a future finished with the function's result.
+template <typename T>
+Future<T> Async(internal::ThreadPool* executor, std::function<Status(T*)> func) {
+  auto fut = Future<T>::Make();
+  Status st = internal::SpawnOrRun(executor, [fut, func]() mutable {
+    T out;
+    Status st = func(&out);
+    fut.MarkFinished(std::move(st), std::move(out));
+  });
+  if (!st.ok()) {
+    fut.MarkFinished(std::move(st));
+  }
+  return fut;
+}
+
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_FUTURE_H
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <random>
 #include <utility>
 #include <vector>
@@ -382,5 +383,54 @@ TEST(TransposeInts, Int8ToInt64) {
   ASSERT_EQ(dest, std::vector<int64_t>({2222, 4444, 6666, 1111, 4444, 3333}));
 }
 
+
+TEST(IntOverflow, Add) {
+  int8_t i8;
+  ASSERT_FALSE(AddWithOverflow<int8_t>(100, 27, &i8));
+  ASSERT_EQ(127, i8);
+  ASSERT_TRUE(AddWithOverflow<int8_t>(100, 28, &i8));
+  ASSERT_EQ(-128, i8);
+  ASSERT_TRUE(AddWithOverflow<int8_t>(-100, -29, &i8));
+
+  uint32_t u32;
+  ASSERT_FALSE(AddWithOverflow<uint32_t>(4294967290U, 5, &u32));
+  ASSERT_TRUE(AddWithOverflow<uint32_t>(4294967290U, 6, &u32));
+  ASSERT_EQ(0, u32);
+
+  int64_t i64;
+  ASSERT_TRUE(AddWithOverflow(std::numeric_limits<int64_t>::max(), int64_t(1), &i64));
+  ASSERT_EQ(std::numeric_limits<int64_t>::min(), i64);
+}
+
+TEST(IntOverflow, Subtract) {
+  int16_t i16;
+  ASSERT_FALSE(SubtractWithOverflow<int16_t>(-32767, 1, &i16));
+  ASSERT_TRUE(SubtractWithOverflow<int16_t>(-32767, 2, &i16));
+  ASSERT_TRUE(SubtractWithOverflow<int16_t>(0, -32768, &i16));
+
+  uint8_t u8;
+  ASSERT_FALSE(SubtractWithOverflow<uint8_t>(3, 3, &u8));
+  ASSERT_EQ(0, u8);
+  ASSERT_TRUE(SubtractWithOverflow<uint8_t>(3, 4, &u8));
+  ASSERT_EQ(255, u8);
+}
+
+TEST(IntOverflow, Multiply) {
+  int32_t i32;
+  ASSERT_FALSE(MultiplyWithOverflow<int32_t>(-46340, 46340, &i32));
+  ASSERT_EQ(-2147395600, i32);
+  ASSERT_TRUE(MultiplyWithOverflow<int32_t>(46341, 46341, &i32));
+  ASSERT_TRUE(
+      MultiplyWithOverflow<int32_t>(-1, std::numeric_limits<int32_t>::min(), &i32));
+
+  uint16_t u16;
+  ASSERT_TRUE(MultiplyWithOverflow<uint16_t>(256, 256, &u16));
+  ASSERT_EQ(0, u16);
+
+  uint64_t u64;
+  ASSERT_FALSE(MultiplyWithOverflow<uint64_t>(1ULL << 32, (1ULL << 32) - 1, &u64));
+  ASSERT_TRUE(MultiplyWithOverflow<uint64_t>(1ULL << 32, 1ULL << 32, &u64));
+}
+
 }  // namespace internal
 }  // namespace arrow
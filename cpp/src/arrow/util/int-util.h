@@ -19,6 +19,7 @@
 #define ARROW_UTIL_INT_UTIL_H
 
 #include <cstdint>
+#include <limits>
 #include <type_traits>
 
 #include "arrow/util/visibility.h"
@@ -83,6 +84,62 @@ SignedInt SafeLeftShift(SignedInt u, Shift shift) {
   return static_cast<SignedInt>(static_cast<UnsignedInt>(u) << shift);
 }
 
+/// Integer addition detecting overflow. The wrapped-around result is stored
+/// in *out and true is returned if the exact result is not representable.
+template <typename Int>
+bool AddWithOverflow(Int u, Int v, Int* out) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_add_overflow(u, v, out);
+#else
+  using UnsignedInt = typename std::make_unsigned<Int>::type;
+  const Int result =
+      static_cast<Int>(static_cast<UnsignedInt>(u) + static_cast<UnsignedInt>(v));
+  *out = result;
+  return std::is_signed<Int>::value ? ((u ^ result) & (v ^ result)) < 0 : result < u;
+#endif
+}
+
+/// Integer subtraction detecting overflow, see AddWithOverflow.
+template <typename Int>
+bool SubtractWithOverflow(Int u, Int v, Int* out) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_sub_overflow(u, v, out);
+#else
+  using UnsignedInt = typename std::make_unsigned<Int>::type;
+  const Int result =
+      static_cast<Int>(static_cast<UnsignedInt>(u) - static_cast<UnsignedInt>(v));
+  *out = result;
+  return std::is_signed<Int>::value ? ((u ^ v) & (u ^ result)) < 0 : u < v;
+#endif
+}
+
+/// Integer multiplication detecting overflow, see AddWithOverflow.
+template <typename Int>
+bool MultiplyWithOverflow(Int u, Int v, Int* out) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_mul_overflow(u, v, out);
+#else
+  if (sizeof(Int) < sizeof(int64_t)) {
+    // The exact product fits in 64 bits
+    const int64_t result = static_cast<int64_t>(u) * static_cast<int64_t>(v);
+    *out = static_cast<Int>(result);
+    return result < static_cast<int64_t>(std::numeric_limits<Int>::min()) ||
+           result > static_cast<int64_t>(std::numeric_limits<Int>::max());
+  }
+  using UnsignedInt = typename std::make_unsigned<Int>::type;
+  const Int result =
+      static_cast<Int>(static_cast<UnsignedInt>(u) * static_cast<UnsignedInt>(v));
+  *out = result;
+  if (u == 0) {
+    return false;
+  }
+  if (std::is_signed<Int>::value && u == static_cast<Int>(-1)) {
+    return v == std::numeric_limits<Int>::min();
+  }
+  return result / u != v;
+#endif
+}
+
 }  // namespace internal
 }  // namespace arrow
 
@@ -15,7 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
-// Non-Arrow system benchmarks, provided for convenience.
+// System benchmarks, provided for convenience.
 
 #include <algorithm>
 #include <cstdint>
@@ -26,6 +26,9 @@
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/memory_pool.h"
+#include "arrow/testing/gtest_util.h"
+
 namespace arrow {
 
 // Generate a vector of indices such as following the indices describes
@@ -67,4 +70,41 @@ static void BM_memory_latency(benchmark::State& state) {
 
 BENCHMARK(BM_memory_latency)->RangeMultiplier(2)->Range(2 << 10, 2 << 24);
 
+// Main memory scan bandwidth, with (argument 1) or without (argument 0)
+// huge pages and NUMA-local placement of the scanned buffer
+static void BM_memory_scan(benchmark::State& state) {
+  const int64_t nbytes = 64 << 20;
+
+  auto options = MemoryPoolOptions::Defaults();
+  if (state.range(0)) {
+    options.large_allocation_threshold = 1 << 20;
+    options.use_huge_pages = true;
+    options.numa_local = true;
+  }
+  auto pool = MemoryPool::CreateDefault(options);
+  uint8_t* data;
+  ABORT_NOT_OK(pool->Allocate(nbytes, &data));
+  // Touch the pages from the scanning thread
+  std::fill(data, data + nbytes, static_cast<uint8_t>(1));
+
+  const auto values = reinterpret_cast<const int64_t*>(data);
+  const int64_t nvalues = nbytes / sizeof(int64_t);
+  for (auto _ : state) {
+    int64_t total = 0;
+    for (int64_t i = 0; i < nvalues; ++i) {
+      total += values[i];
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(state.iterations() * nbytes);
+  pool->Free(data, nbytes);
+}
+
+BENCHMARK(BM_memory_scan)
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 16)
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
 }  // namespace arrow
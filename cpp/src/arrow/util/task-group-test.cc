@@ -212,6 +212,49 @@ void TestTasksSpawnTasks(std::shared_ptr<TaskGroup> task_group) {
   ASSERT_EQ(count.load(), (1 << (N + 1)) - 1);
 }
 
+// Check TaskGroup behaviour with tasks waiting on nested subgroups
+void TestNestedSubGroups(std::shared_ptr<TaskGroup> task_group, int max_concurrency) {
+  const int DEPTH = 3;
+  const int FANOUT = 4;
+
+  std::atomic<int> count(0), concurrency(0), peak_concurrency(0);
+
+  std::function<Status(int, std::shared_ptr<TaskGroup>)> run_task;
+  run_task = [&](int depth, std::shared_ptr<TaskGroup> group) -> Status {
+    int current = ++concurrency;
+    int peak = peak_concurrency.load();
+    while (current > peak && !peak_concurrency.compare_exchange_weak(peak, current)) {
+    }
+    ++count;
+    sleep_for(1e-4);
+    --concurrency;
+    if (depth > 0) {
+      // Fork subtasks and join them from within this task
+      auto sub_group = group->MakeSubGroup();
+      for (int i = 0; i < FANOUT; ++i) {
+        sub_group->Append(
+            [&, depth, sub_group]() { return run_task(depth - 1, sub_group); });
+      }
+      RETURN_NOT_OK(sub_group->Finish());
+    }
+    return Status::OK();
+  };
+
+  for (int i = 0; i < FANOUT; ++i) {
+    task_group->Append([&]() { return run_task(DEPTH, task_group); });
+  }
+  ASSERT_OK(task_group->Finish());
+  ASSERT_TRUE(task_group->ok());
+
+  int expected = 0;
+  for (int i = 1, n = FANOUT; i <= DEPTH + 1; ++i, n *= FANOUT) {
+    expected += n;
+  }
+  ASSERT_EQ(count.load(), expected);
+  // Tasks waiting on subgroups don't cause more tasks than threads to run at once
+  ASSERT_LE(peak_concurrency.load(), max_concurrency);
+}
+
 TEST(SerialTaskGroup, Success) { TestTaskGroupSuccess(TaskGroup::MakeSerial()); }
 
 TEST(SerialTaskGroup, Errors) { TestTaskGroupErrors(TaskGroup::MakeSerial()); }
@@ -226,6 +269,10 @@ TEST(SerialTaskGroup, SubGroupsErrors) {
   TestTaskSubGroupsErrors(TaskGroup::MakeSerial());
 }
 
+TEST(SerialTaskGroup, NestedSubGroups) {
+  TestNestedSubGroups(TaskGroup::MakeSerial(), 1);
+}
+
 TEST(ThreadedTaskGroup, Success) {
   auto task_group = TaskGroup::MakeThreaded(GetCpuThreadPool());
   TestTaskGroupSuccess(task_group);
@@ -259,5 +306,18 @@ TEST(ThreadedTaskGroup, SubGroupsErrors) {
   TestTaskSubGroupsErrors(TaskGroup::MakeThreaded(thread_pool.get()));
 }
 
+TEST(ThreadedTaskGroup, NestedSubGroups) {
+  // Even with a single thread, tasks waiting on subgroups don't deadlock
+  for (int threads : {1, 2, 4}) {
+    for (auto scheduler :
+         {ThreadPool::Scheduler::SHARED_QUEUE, ThreadPool::Scheduler::WORK_STEALING}) {
+      std::shared_ptr<ThreadPool> thread_pool;
+      ASSERT_OK(ThreadPool::Make(threads, scheduler, &thread_pool));
+      // The thread calling Finish() on the main group also executes tasks
+      TestNestedSubGroups(TaskGroup::MakeThreaded(thread_pool.get()), threads + 1);
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -20,6 +20,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <utility>
 
@@ -72,10 +74,16 @@ class SerialTaskGroup : public TaskGroup {
 ////////////////////////////////////////////////////////////////////////
 // Threaded TaskGroup implementation
 
+// Tasks are queued in the group, and each Append() spawns a thread pool task
+// executing one queued task, if any remains.  Finish() executes the queued
+// tasks itself rather than only waiting for the thread pool.  Hence a task
+// can wait for a subgroup (or any other group) while keeping its worker
+// thread busy, without deadlocking when all workers are waiting.
+
 class ThreadedTaskGroup : public TaskGroup {
  public:
   explicit ThreadedTaskGroup(ThreadPool* thread_pool)
-      : thread_pool_(thread_pool), nremaining_(0), ok_(true) {}
+      : thread_pool_(thread_pool), state_(std::make_shared<State>()) {}
 
   ~ThreadedTaskGroup() override {
     // Make sure all pending tasks are finished, so that dangling references
@@ -84,85 +92,133 @@ class ThreadedTaskGroup : public TaskGroup {
   }
 
   void AppendReal(std::function<Status()> task) override {
-    // The hot path is unlocked thanks to atomics
-    // Only if an error occurs is the lock taken
-    if (ok_.load(std::memory_order_acquire)) {
-      nremaining_.fetch_add(1, std::memory_order_acquire);
-      Status st = thread_pool_->Spawn([this, task]() {
-        if (ok_.load(std::memory_order_acquire)) {
-          // XXX what about exceptions?
-          Status st = task();
-          UpdateStatus(std::move(st));
-        }
-        OneTaskDone();
-      });
-      UpdateStatus(std::move(st));
+    // Tasks are not queued anymore once an error occurred
+    if (state_->ok_.load(std::memory_order_acquire)) {
+      state_->nremaining_.fetch_add(1, std::memory_order_acquire);
+      state_->Push(std::move(task));
+      // The pool task keeps the state alive, as Finish() may already have
+      // executed the queued task and returned.
+      std::shared_ptr<State> state = state_;
+      Status st = thread_pool_->Spawn([state]() { state->ExecuteOne(); });
+      // If spawning failed, Finish() executes the task.
+      state_->UpdateStatus(std::move(st));
     }
   }
 
   Status current_status() override {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return status_;
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    return state_->status_;
   }
 
-  bool ok() override { return ok_.load(); }
+  bool ok() override { return state_->ok_.load(); }
 
   Status Finish() override {
-    std::unique_lock<std::mutex> lock(mutex_);
+    std::unique_lock<std::mutex> lock(state_->mutex_);
     if (!finished_) {
-      cv_.wait(lock, [&]() { return nremaining_.load() == 0; });
+      // Help executing the queued tasks, then wait for the running ones
+      // (which may queue more tasks) to finish.
+      while (state_->nremaining_.load() != 0) {
+        if (!state_->tasks_.empty()) {
+          lock.unlock();
+          state_->ExecuteOne();
+          lock.lock();
+          continue;
+        }
+        ++state_->nwaiting_;
+        state_->cv_.wait(lock, [&]() {
+          return state_->nremaining_.load() == 0 || !state_->tasks_.empty();
+        });
+        --state_->nwaiting_;
+      }
       // Current tasks may start other tasks, so only set this when done
       finished_ = true;
       if (parent_) {
         parent_->OneTaskDone();
       }
     }
-    return status_;
+    return state_->status_;
   }
 
   int parallelism() override { return thread_pool_->GetCapacity(); }
 
   std::shared_ptr<TaskGroup> MakeSubGroup() override {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> lock(state_->mutex_);
     auto child = new ThreadedTaskGroup(thread_pool_);
-    child->parent_ = this;
-    nremaining_.fetch_add(1, std::memory_order_acquire);
+    child->parent_ = state_;
+    state_->nremaining_.fetch_add(1, std::memory_order_acquire);
     return std::shared_ptr<TaskGroup>(child);
   }
 
  protected:
-  void UpdateStatus(Status&& st) {
-    // Must be called unlocked, only locks on error
-    if (ARROW_PREDICT_FALSE(!st.ok())) {
+  struct State {
+    State() : nremaining_(0), ok_(true) {}
+
+    void Push(std::function<Status()> task) {
       std::lock_guard<std::mutex> lock(mutex_);
-      ok_.store(false, std::memory_order_release);
-      status_ &= std::move(st);
+      tasks_.push_back(std::move(task));
+      if (nwaiting_ > 0) {
+        cv_.notify_all();
+      }
+    }
+
+    // Execute a queued task, if any.  Must be called unlocked.
+    void ExecuteOne() {
+      std::function<Status()> task;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+          // Already executed by Finish()
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      if (ok_.load(std::memory_order_acquire)) {
+        // XXX what about exceptions?
+        Status st = task();
+        UpdateStatus(std::move(st));
+      }
+      OneTaskDone();
     }
-  }
 
-  void OneTaskDone() {
-    // Can be called unlocked thanks to atomics
-    auto nremaining = nremaining_.fetch_sub(1, std::memory_order_release) - 1;
-    DCHECK_GE(nremaining, 0);
-    if (nremaining == 0) {
-      // Take the lock so that ~ThreadedTaskGroup cannot destroy cv
-      // before cv.notify_one() has returned
-      std::unique_lock<std::mutex> lock(mutex_);
-      cv_.notify_one();
+    void UpdateStatus(Status&& st) {
+      // Must be called unlocked, only locks on error
+      if (ARROW_PREDICT_FALSE(!st.ok())) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ok_.store(false, std::memory_order_release);
+        status_ &= std::move(st);
+      }
     }
-  }
 
-  // These members are usable unlocked
-  ThreadPool* thread_pool_;
-  std::atomic<int32_t> nremaining_;
-  std::atomic<bool> ok_;
+    void OneTaskDone() {
+      // Can be called unlocked thanks to atomics
+      auto nremaining = nremaining_.fetch_sub(1, std::memory_order_release) - 1;
+      DCHECK_GE(nremaining, 0);
+      if (nremaining == 0) {
+        // Take the lock so that ~ThreadedTaskGroup cannot destroy cv
+        // before cv.notify_all() has returned
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.notify_all();
+      }
+    }
 
-  // These members use locking
-  std::mutex mutex_;
-  std::condition_variable cv_;
-  Status status_;
+    // These members are usable unlocked
+    std::atomic<int32_t> nremaining_;
+    std::atomic<bool> ok_;
+
+    // These members use locking
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<Status()>> tasks_;
+    int nwaiting_ = 0;
+    Status status_;
+  };
+
+  ThreadPool* thread_pool_;
+  std::shared_ptr<State> state_;
+  // Only accessed by Finish(), under state_->mutex_
   bool finished_ = false;
-  ThreadedTaskGroup* parent_ = nullptr;
+  std::shared_ptr<State> parent_;
 };
 
 std::shared_ptr<TaskGroup> TaskGroup::MakeSerial() {
@@ -53,6 +53,11 @@ class ARROW_EXPORT TaskGroup {
   /// or for at least one task (or subgroup) to error out.
   /// The returned Status propagates the error status of the first failing
   /// task (or subgroup).
+  ///
+  /// Rather than only blocking, the calling thread helps executing the
+  /// tasks of this group which haven't started yet.  It is therefore safe
+  /// to call Finish() from a task running on the same thread pool (for
+  /// example on a subgroup), even if all threads of the pool are busy.
   virtual Status Finish() = 0;
 
   /// The current agregate error Status.  Non-blocking, useful for stopping early.
@@ -68,7 +73,8 @@ class ARROW_EXPORT TaskGroup {
   /// Create a subgroup of this group.  This group can only finish
   /// when all subgroups have finished (this means you must be
   /// be careful to call Finish() on subgroups before calling it
-  /// on the main group).
+  /// on the main group).  Tasks may create subgroups and wait on them
+  /// to implement nested parallelism.
   // XXX if a subgroup errors out, should it propagate immediately to the parent
   // and to children?
   virtual std::shared_ptr<TaskGroup> MakeSubGroup() = 0;
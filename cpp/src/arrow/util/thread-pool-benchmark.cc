@@ -18,6 +18,7 @@
 #include "benchmark/benchmark.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
@@ -25,6 +26,7 @@
 #include <limits>
 #include <memory>
 #include <random>
+#include <thread>
 #include <vector>
 
 #include "arrow/status.h"
@@ -87,10 +89,16 @@ static void BM_WorkloadCost(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations());
 }
 
+static ThreadPool::Scheduler GetScheduler(int64_t arg) {
+  return arg == 0 ? ThreadPool::Scheduler::SHARED_QUEUE
+                  : ThreadPool::Scheduler::WORK_STEALING;
+}
+
 // Benchmark ThreadPool::Spawn
 static void BM_ThreadPoolSpawn(benchmark::State& state) {
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
+  const auto scheduler = GetScheduler(state.range(2));
 
   Workload workload(workload_size);
 
@@ -100,7 +108,7 @@ static void BM_ThreadPoolSpawn(benchmark::State& state) {
   for (auto _ : state) {
     state.PauseTiming();
     std::shared_ptr<ThreadPool> pool;
-    ABORT_NOT_OK(ThreadPool::Make(nthreads, &pool));
+    ABORT_NOT_OK(ThreadPool::Make(nthreads, scheduler, &pool));
     state.ResumeTiming();
 
     for (int32_t i = 0; i < nspawns; ++i) {
@@ -117,6 +125,45 @@ static void BM_ThreadPoolSpawn(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// Benchmark ThreadPool::Spawn called from the worker threads, as done by
+// tasks splitting their work into subtasks: each of nthreads root tasks
+// spawns its share of the tasks.
+static void BM_ThreadPoolNestedSpawn(benchmark::State& state) {
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+  const auto scheduler = GetScheduler(state.range(2));
+
+  Workload workload(workload_size);
+
+  const int32_t nspawns = 200000000 / workload_size + 1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::shared_ptr<ThreadPool> pool;
+    ABORT_NOT_OK(ThreadPool::Make(nthreads, scheduler, &pool));
+    state.ResumeTiming();
+
+    std::atomic<int> nroots_done(0);
+    for (int root = 0; root < nthreads; ++root) {
+      ABORT_NOT_OK(pool->Spawn([&]() {
+        for (int32_t i = 0; i < nspawns / nthreads; ++i) {
+          ABORT_NOT_OK(pool->Spawn(std::ref(workload)));
+        }
+        ++nroots_done;
+      }));
+    }
+    // Shutdown forbids new spawns, hence wait for the roots to finish first
+    while (nroots_done.load() < nthreads) {
+      std::this_thread::yield();
+    }
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * (nspawns / nthreads) * nthreads);
+}
+
 // Benchmark serial TaskGroup
 static void BM_SerialTaskGroup(benchmark::State& state) {
   const auto workload_size = static_cast<int32_t>(state.range(0));
@@ -140,9 +187,10 @@ static void BM_SerialTaskGroup(benchmark::State& state) {
 static void BM_ThreadedTaskGroup(benchmark::State& state) {
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
+  const auto scheduler = GetScheduler(state.range(2));
 
   std::shared_ptr<ThreadPool> pool;
-  ABORT_NOT_OK(ThreadPool::Make(nthreads, &pool));
+  ABORT_NOT_OK(ThreadPool::Make(nthreads, scheduler, &pool));
 
   Task task(workload_size);
 
@@ -173,10 +221,13 @@ static void WorkloadCost_Customize(benchmark::internal::Benchmark* b) {
 static void ThreadPoolSpawn_Customize(benchmark::internal::Benchmark* b) {
   for (const int32_t w : kWorkloadSizes) {
     for (const int nthreads : {1, 2, 4, 8}) {
-      b->Args({nthreads, w});
+      // 0 for the shared queue scheduler, 1 for work stealing
+      for (const int scheduler : {0, 1}) {
+        b->Args({nthreads, w, scheduler});
+      }
     }
   }
-  b->ArgNames({"threads", "task_cost"});
+  b->ArgNames({"threads", "task_cost", "work_stealing"});
 }
 
 static const int kRepetitions = 1;
@@ -188,6 +239,11 @@ BENCHMARK(BM_ThreadPoolSpawn)
     ->Repetitions(kRepetitions)
     ->Apply(ThreadPoolSpawn_Customize);
 
+BENCHMARK(BM_ThreadPoolNestedSpawn)
+    ->UseRealTime()
+    ->Repetitions(kRepetitions)
+    ->Apply(ThreadPoolSpawn_Customize);
+
 BENCHMARK(BM_SerialTaskGroup)
     ->UseRealTime()
     ->Repetitions(kRepetitions)
@@ -21,6 +21,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
@@ -132,7 +133,7 @@ class AddTester {
   std::vector<int> outs;
 };
 
-class TestThreadPool : public ::testing::Test {
+class TestThreadPool : public ::testing::TestWithParam<ThreadPool::Scheduler> {
  public:
   void TearDown() {
     fflush(stdout);
@@ -143,7 +144,7 @@ class TestThreadPool : public ::testing::Test {
 
   std::shared_ptr<ThreadPool> MakeThreadPool(int threads) {
     std::shared_ptr<ThreadPool> pool;
-    Status st = ThreadPool::Make(threads, &pool);
+    Status st = ThreadPool::Make(threads, GetParam(), &pool);
     return pool;
   }
 
@@ -175,7 +176,7 @@ class TestThreadPool : public ::testing::Test {
   }
 };
 
-TEST_F(TestThreadPool, ConstructDestruct) {
+TEST_P(TestThreadPool, ConstructDestruct) {
   // Stress shutdown-at-destruction logic
   for (int threads : {1, 2, 3, 8, 32, 70}) {
     auto pool = this->MakeThreadPool(threads);
@@ -184,22 +185,22 @@ TEST_F(TestThreadPool, ConstructDestruct) {
 
 // Correctness and stress tests using Spawn() and Shutdown()
 
-TEST_F(TestThreadPool, Spawn) {
+TEST_P(TestThreadPool, Spawn) {
   auto pool = this->MakeThreadPool(3);
   SpawnAdds(pool.get(), 7, task_add<int>);
 }
 
-TEST_F(TestThreadPool, StressSpawn) {
+TEST_P(TestThreadPool, StressSpawn) {
   auto pool = this->MakeThreadPool(30);
   SpawnAdds(pool.get(), 1000, task_add<int>);
 }
 
-TEST_F(TestThreadPool, StressSpawnThreaded) {
+TEST_P(TestThreadPool, StressSpawnThreaded) {
   auto pool = this->MakeThreadPool(30);
   SpawnAddsThreaded(pool.get(), 20, 100, task_add<int>);
 }
 
-TEST_F(TestThreadPool, SpawnSlow) {
+TEST_P(TestThreadPool, SpawnSlow) {
   // This checks that Shutdown() waits for all tasks to finish
   auto pool = this->MakeThreadPool(2);
   SpawnAdds(pool.get(), 7, [](int x, int y, int* out) {
@@ -207,21 +208,21 @@ TEST_F(TestThreadPool, SpawnSlow) {
   });
 }
 
-TEST_F(TestThreadPool, StressSpawnSlow) {
+TEST_P(TestThreadPool, StressSpawnSlow) {
   auto pool = this->MakeThreadPool(30);
   SpawnAdds(pool.get(), 1000, [](int x, int y, int* out) {
     return task_slow_add(0.002 /* seconds */, x, y, out);
   });
 }
 
-TEST_F(TestThreadPool, StressSpawnSlowThreaded) {
+TEST_P(TestThreadPool, StressSpawnSlowThreaded) {
   auto pool = this->MakeThreadPool(30);
   SpawnAddsThreaded(pool.get(), 20, 100, [](int x, int y, int* out) {
     return task_slow_add(0.002 /* seconds */, x, y, out);
   });
 }
 
-TEST_F(TestThreadPool, QuickShutdown) {
+TEST_P(TestThreadPool, QuickShutdown) {
   AddTester add_tester(100);
   {
     auto pool = this->MakeThreadPool(3);
@@ -234,7 +235,7 @@ TEST_F(TestThreadPool, QuickShutdown) {
   add_tester.CheckNotAllComputed();
 }
 
-TEST_F(TestThreadPool, SetCapacity) {
+TEST_P(TestThreadPool, SetCapacity) {
   auto pool = this->MakeThreadPool(3);
   ASSERT_EQ(pool->GetCapacity(), 3);
   ASSERT_EQ(pool->GetActualCapacity(), 3);
@@ -268,7 +269,7 @@ TEST_F(TestThreadPool, SetCapacity) {
 
 // Test Submit() functionality
 
-TEST_F(TestThreadPool, Submit) {
+TEST_P(TestThreadPool, Submit) {
   auto pool = this->MakeThreadPool(3);
   {
     auto fut = pool->Submit(add<int>, 4, 5);
@@ -300,7 +301,7 @@ TEST_F(TestThreadPool, Submit) {
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
       defined(THREAD_SANITIZER))
-TEST_F(TestThreadPool, ForkSafety) {
+TEST_P(TestThreadPool, ForkSafety) {
   pid_t child_pid;
   int child_status;
 
@@ -356,6 +357,71 @@ TEST_F(TestThreadPool, ForkSafety) {
 }
 #endif
 
+// Tasks spawned from the worker threads
+
+TEST_P(TestThreadPool, RecursiveSpawn) {
+  // Binary tree of tasks, each spawning its children from a worker thread
+  auto pool = this->MakeThreadPool(4);
+  const int kDepth = 14;
+  std::atomic<int> nleaves(0);
+  std::function<void(int)> spawn_tree = [&](int depth) {
+    if (depth == kDepth) {
+      ++nleaves;
+      return;
+    }
+    for (int i = 0; i < 2; ++i) {
+      ASSERT_OK(pool->Spawn(std::bind(spawn_tree, depth + 1)));
+    }
+  };
+  ASSERT_OK(pool->Spawn(std::bind(spawn_tree, 0)));
+  busy_wait(10, [&] { return nleaves.load() == (1 << kDepth); });
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(nleaves.load(), 1 << kDepth);
+}
+
+TEST_P(TestThreadPool, StealFromBusyWorker) {
+  // A single task spawns many slow tasks to its own worker's deque; the
+  // other workers must take them.
+  auto pool = this->MakeThreadPool(4);
+  std::vector<std::thread::id> thread_ids(40);
+  std::atomic<int> ndone(0);
+  ASSERT_OK(pool->Spawn([&] {
+    for (size_t i = 0; i < thread_ids.size(); ++i) {
+      ASSERT_OK(pool->Spawn([&, i] {
+        sleep_for(0.002);
+        thread_ids[i] = std::this_thread::get_id();
+        ++ndone;
+      }));
+    }
+  }));
+  busy_wait(5, [&] { return ndone.load() == static_cast<int>(thread_ids.size()); });
+  ASSERT_OK(pool->Shutdown());
+  std::sort(thread_ids.begin(), thread_ids.end());
+  ASSERT_GT(std::unique(thread_ids.begin(), thread_ids.end()) - thread_ids.begin(), 1);
+}
+
+TEST_P(TestThreadPool, SpawnAfterShrinking) {
+  // Tasks left in the deque of a seceding worker are still executed
+  auto pool = this->MakeThreadPool(4);
+  std::atomic<int> ndone(0);
+  for (int round = 0; round < 20; ++round) {
+    ASSERT_OK(pool->SetCapacity(round % 2 == 0 ? 1 : 4));
+    ASSERT_OK(pool->Spawn([&] {
+      for (int i = 0; i < 50; ++i) {
+        ASSERT_OK(pool->Spawn([&] { ++ndone; }));
+      }
+    }));
+  }
+  busy_wait(5, [&] { return ndone.load() == 20 * 50; });
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(ndone.load(), 20 * 50);
+}
+
+INSTANTIATE_TEST_CASE_P(SharedQueue, TestThreadPool,
+                        ::testing::Values(ThreadPool::Scheduler::SHARED_QUEUE));
+INSTANTIATE_TEST_CASE_P(WorkStealing, TestThreadPool,
+                        ::testing::Values(ThreadPool::Scheduler::WORK_STEALING));
+
 TEST(TestGlobalThreadPool, Capacity) {
   // Sanity check
   auto pool = GetCpuThreadPool();
@@ -401,5 +467,30 @@ TEST(TestGlobalThreadPool, Capacity) {
   ASSERT_OK(DelEnvVar("OMP_THREAD_LIMIT"));
 }
 
+TEST(TestGlobalThreadPool, IOCapacity) {
+  // The I/O pool is distinct from the CPU pool
+  auto pool = GetIOThreadPool();
+  ASSERT_NE(pool, GetCpuThreadPool());
+  int capacity = pool->GetCapacity();
+  ASSERT_GT(capacity, 0);
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity);
+
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity + 1));
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity + 1);
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity));
+
+  // Exercise default capacity heuristic
+  ASSERT_OK(DelEnvVar("ARROW_IO_THREADS"));
+  int default_capacity = ThreadPool::DefaultIOCapacity();
+  ASSERT_GT(default_capacity, 0);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "13"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 13);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "0"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), default_capacity);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "zzz"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), default_capacity);
+  ASSERT_OK(DelEnvVar("ARROW_IO_THREADS"));
+}
+
 }  // namespace internal
 }  // namespace arrow
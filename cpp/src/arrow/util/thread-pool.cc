@@ -18,6 +18,7 @@
 #include "arrow/util/thread-pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <mutex>
@@ -31,8 +32,149 @@
 namespace arrow {
 namespace internal {
 
+namespace {
+
+using Task = std::function<void()>;
+
+// A Chase-Lev work-stealing deque of task pointers (see "Correct and
+// Efficient Work-Stealing for Weak Memory Models", Le et al., 2013).
+// Push() and Pop() are called by the owner thread only, at the bottom end;
+// Steal() is called by any thread, at the top end.
+class WorkStealingDeque {
+ public:
+  WorkStealingDeque() : top_(0), bottom_(0) {
+    arrays_.emplace_back(new Array(kInitialCapacity));
+    array_.store(arrays_.back().get(), std::memory_order_relaxed);
+  }
+
+  void Push(Task* task) {
+    const int64_t b = bottom_.load(std::memory_order_relaxed);
+    const int64_t t = top_.load(std::memory_order_acquire);
+    Array* array = array_.load(std::memory_order_relaxed);
+    if (b - t >= array->capacity) {
+      array = Grow(array, t, b);
+    }
+    array->Put(b, task);
+    // Publish the task to thieves
+    bottom_.store(b + 1, std::memory_order_release);
+  }
+
+  Task* Pop() {
+    const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* array = array_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      // Empty
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    Task* task = array->Get(b);
+    if (t == b) {
+      // Last task, race against thieves
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+        task = nullptr;
+      }
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  Task* Steal() {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) {
+      return nullptr;
+    }
+    Array* array = array_.load(std::memory_order_acquire);
+    Task* task = array->Get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      // Lost the race against the owner or another thief
+      return nullptr;
+    }
+    return task;
+  }
+
+ private:
+  static constexpr int64_t kInitialCapacity = 256;
+
+  struct Array {
+    explicit Array(int64_t capacity)
+        : capacity(capacity), slots(new std::atomic<Task*>[capacity]) {}
+
+    Task* Get(int64_t i) const {
+      return slots[i & (capacity - 1)].load(std::memory_order_relaxed);
+    }
+    void Put(int64_t i, Task* task) {
+      slots[i & (capacity - 1)].store(task, std::memory_order_relaxed);
+    }
+
+    const int64_t capacity;
+    std::unique_ptr<std::atomic<Task*>[]> slots;
+  };
+
+  Array* Grow(Array* array, int64_t t, int64_t b) {
+    // Thieves may still read the old array, so it is kept alive with the deque.
+    arrays_.emplace_back(new Array(array->capacity * 2));
+    Array* grown = arrays_.back().get();
+    for (int64_t i = t; i < b; ++i) {
+      grown->Put(i, array->Get(i));
+    }
+    array_.store(grown, std::memory_order_release);
+    return grown;
+  }
+
+  std::atomic<int64_t> top_;
+  std::atomic<int64_t> bottom_;
+  std::atomic<Array*> array_;
+  std::vector<std::unique_ptr<Array>> arrays_;
+};
+
+// The deque of a work-stealing worker.  Queues are never freed before the
+// pool state, and are reused by new workers when their owner exits, so that
+// tasks left by a seceding worker are still executed.
+struct WorkerQueue {
+  WorkStealingDeque deque;
+  // Whether a worker owns the queue, guarded by the state mutex
+  bool owned = false;
+  WorkerQueue* next = nullptr;
+};
+
+// The queue of the current thread if it is a worker of a work-stealing pool,
+// and the state of that pool.
+struct WorkerContext {
+  const void* state;
+  WorkerQueue* queue;
+};
+
+thread_local WorkerContext current_worker = {nullptr, nullptr};
+
+}  // namespace
+
 struct ThreadPool::State {
-  State() : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
+  explicit State(Scheduler scheduler = Scheduler::SHARED_QUEUE)
+      : desired_capacity_(0),
+        please_shutdown_(false),
+        quick_shutdown_(false),
+        scheduler_(scheduler),
+        stop_(false),
+        num_queued_(0),
+        num_sleeping_(0),
+        worker_queues_(nullptr) {}
+
+  ~State() {
+    DropQueuedTasks();
+    WorkerQueue* queue = worker_queues_.load();
+    while (queue != nullptr) {
+      WorkerQueue* next = queue->next;
+      delete queue;
+      queue = next;
+    }
+  }
 
   // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
   // such as https://github.com/cameron314/concurrentqueue
@@ -51,10 +193,80 @@ struct ThreadPool::State {
   // Are we shutting down?
   bool please_shutdown_;
   bool quick_shutdown_;
+
+  const Scheduler scheduler_;
+
+  // Work-stealing scheduler state.  pending_tasks_ is the shared queue of
+  // the tasks spawned from outside the workers, guarded by injection_mutex_
+  // rather than mutex_.
+  std::mutex injection_mutex_;
+  // Unlocked copy of quick_shutdown_
+  std::atomic<bool> stop_;
+  // Number of tasks in the queues, incremented before a task is queued
+  std::atomic<int64_t> num_queued_;
+  // Number of workers waiting on cv_ for tasks
+  std::atomic<int> num_sleeping_;
+  // Linked list of the worker deques, only ever prepended to
+  std::atomic<WorkerQueue*> worker_queues_;
+
+  // Return an unowned worker queue, or a new one.  Called with mutex_ held.
+  WorkerQueue* AcquireQueue() {
+    WorkerQueue* queue = worker_queues_.load();
+    while (queue != nullptr && queue->owned) {
+      queue = queue->next;
+    }
+    if (queue == nullptr) {
+      queue = new WorkerQueue();
+      queue->next = worker_queues_.load();
+      worker_queues_.store(queue);
+    }
+    queue->owned = true;
+    return queue;
+  }
+
+  Task* TakeInjectedTask() {
+    std::lock_guard<std::mutex> lock(injection_mutex_);
+    if (pending_tasks_.empty()) {
+      return nullptr;
+    }
+    Task* task = new Task(std::move(pending_tasks_.front()));
+    pending_tasks_.pop_front();
+    return task;
+  }
+
+  // Steal from the other queues, starting after the given one
+  Task* StealTask(WorkerQueue* own) {
+    for (int pass = 0; pass < 2; ++pass) {
+      WorkerQueue* queue = pass == 0 ? own->next : worker_queues_.load();
+      for (; queue != nullptr; queue = queue->next) {
+        if (queue == own) {
+          break;
+        }
+        Task* task = queue->deque.Steal();
+        if (task != nullptr) {
+          return task;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  // Delete the queued tasks.  Called once no worker is running.
+  void DropQueuedTasks() {
+    pending_tasks_.clear();
+    for (WorkerQueue* queue = worker_queues_.load(); queue != nullptr;
+         queue = queue->next) {
+      Task* task;
+      while ((task = queue->deque.Steal()) != nullptr) {
+        delete task;
+      }
+    }
+    num_queued_ = 0;
+  }
 };
 
-ThreadPool::ThreadPool()
-    : sp_state_(std::make_shared<ThreadPool::State>()),
+ThreadPool::ThreadPool(Scheduler scheduler)
+    : sp_state_(std::make_shared<ThreadPool::State>(scheduler)),
       state_(sp_state_.get()),
       shutdown_on_destroy_(true) {
 #ifndef _WIN32
@@ -78,7 +290,7 @@ void ThreadPool::ProtectAgainstFork() {
     // existing ThreadPools.
     int capacity = state_->desired_capacity_;
 
-    auto new_state = std::make_shared<ThreadPool::State>();
+    auto new_state = std::make_shared<ThreadPool::State>(state_->scheduler_);
     new_state->please_shutdown_ = state_->please_shutdown_;
     new_state->quick_shutdown_ = state_->quick_shutdown_;
 
@@ -137,12 +349,14 @@ Status ThreadPool::Shutdown(bool wait) {
   }
   state_->please_shutdown_ = true;
   state_->quick_shutdown_ = !wait;
+  state_->stop_ = !wait;
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
     DCHECK_EQ(state_->pending_tasks_.size(), 0);
+    DCHECK_EQ(state_->num_queued_.load(), 0);
   } else {
-    state_->pending_tasks_.clear();
+    state_->DropQueuedTasks();
   }
   CollectFinishedWorkersUnlocked();
   return Status::OK();
@@ -162,7 +376,11 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
   for (int i = 0; i < threads; i++) {
     state_->workers_.emplace_back();
     auto it = --(state_->workers_.end());
-    *it = std::thread([state, it] { WorkerLoop(state, it); });
+    if (state_->scheduler_ == Scheduler::WORK_STEALING) {
+      *it = std::thread([state, it] { WorkStealingWorkerLoop(state, it); });
+    } else {
+      *it = std::thread([state, it] { WorkerLoop(state, it); });
+    }
   }
 }
 
@@ -223,7 +441,102 @@ void ThreadPool::WorkerLoop(std::shared_ptr<State> state,
   }
 }
 
+void ThreadPool::WorkStealingWorkerLoop(std::shared_ptr<State> state,
+                                        std::list<std::thread>::iterator it) {
+  std::unique_lock<std::mutex> lock(state->mutex_);
+  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  WorkerQueue* queue = state->AcquireQueue();
+  current_worker = {state.get(), queue};
+
+  const auto should_secede = [&]() -> bool {
+    return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
+  };
+
+  while (true) {
+    lock.unlock();
+    // Execute tasks without locking as long as some can be found: newest
+    // first from our own deque, then oldest first from the shared queue and
+    // the other deques.
+    while (!state->stop_.load()) {
+      Task* task = queue->deque.Pop();
+      if (task == nullptr) {
+        task = state->TakeInjectedTask();
+      }
+      if (task == nullptr) {
+        task = state->StealTask(queue);
+      }
+      if (task == nullptr) {
+        if (state->num_queued_.load() == 0) {
+          break;
+        }
+        // A task is being queued or stolen by another worker
+        std::this_thread::yield();
+        continue;
+      }
+      state->num_queued_.fetch_sub(1);
+      (*task)();
+      delete task;
+    }
+
+    lock.lock();
+    if (state->stop_.load() || should_secede() ||
+        (state->please_shutdown_ && state->num_queued_.load() == 0)) {
+      break;
+    }
+    // Wait for next wakeup.  num_sleeping_ is incremented before checking
+    // for queued tasks, so that a concurrent spawn notifies us.
+    state->num_sleeping_.fetch_add(1);
+    state->cv_.wait(lock, [&] {
+      return state->num_queued_.load() > 0 || state->please_shutdown_ ||
+             should_secede();
+    });
+    state->num_sleeping_.fetch_sub(1);
+  }
+
+  // Leave our queue, and the tasks possibly still in it, to other workers
+  current_worker = {nullptr, nullptr};
+  queue->owned = false;
+  if (state->num_queued_.load() > 0) {
+    state->cv_.notify_all();
+  }
+  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  state->finished_workers_.push_back(std::move(*it));
+  state->workers_.erase(it);
+  if (state->please_shutdown_) {
+    state->cv_shutdown_.notify_one();
+  }
+}
+
+Status ThreadPool::SpawnWorkStealing(std::function<void()> task) {
+  if (current_worker.state == state_) {
+    // Fast path: spawned from one of our workers, push to its own deque.
+    // No need to check for shutdown, as the worker is still running.
+    state_->num_queued_.fetch_add(1);
+    current_worker.queue->deque.Push(new Task(std::move(task)));
+  } else {
+    ProtectAgainstFork();
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      if (state_->please_shutdown_) {
+        return Status::Invalid("operation forbidden during or after shutdown");
+      }
+      CollectFinishedWorkersUnlocked();
+    }
+    std::lock_guard<std::mutex> lock(state_->injection_mutex_);
+    state_->num_queued_.fetch_add(1);
+    state_->pending_tasks_.push_back(std::move(task));
+  }
+  if (state_->num_sleeping_.load() > 0) {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    state_->cv_.notify_one();
+  }
+  return Status::OK();
+}
+
 Status ThreadPool::SpawnReal(std::function<void()> task) {
+  if (state_->scheduler_ == Scheduler::WORK_STEALING) {
+    return SpawnWorkStealing(std::move(task));
+  }
   {
     ProtectAgainstFork();
     std::lock_guard<std::mutex> lock(state_->mutex_);
@@ -238,7 +551,12 @@ Status ThreadPool::SpawnReal(std::function<void()> task) {
 }
 
 Status ThreadPool::Make(int threads, std::shared_ptr<ThreadPool>* out) {
-  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+  return Make(threads, Scheduler::SHARED_QUEUE, out);
+}
+
+Status ThreadPool::Make(int threads, Scheduler scheduler,
+                        std::shared_ptr<ThreadPool>* out) {
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool(scheduler));
   RETURN_NOT_OK(pool->SetCapacity(threads));
   *out = std::move(pool);
   return Status::OK();
@@ -283,10 +601,29 @@ int ThreadPool::DefaultCapacity() {
   return capacity;
 }
 
-// Helper for the singleton pattern
-std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
+// I/O-bound tasks mostly wait, so their pool isn't sized after the number
+// of cores
+static constexpr int kDefaultIOCapacity = 8;
+
+int ThreadPool::DefaultIOCapacity() {
+  std::string str;
+  if (GetEnvVar("ARROW_IO_THREADS", &str).ok()) {
+    try {
+      int capacity = std::stoi(str);
+      if (capacity > 0) {
+        return capacity;
+      }
+    } catch (...) {
+    }
+    ARROW_LOG(WARNING) << "Invalid ARROW_IO_THREADS value, using default capacity";
+  }
+  return kDefaultIOCapacity;
+}
+
+// Helpers for the singleton pattern
+std::shared_ptr<ThreadPool> ThreadPool::MakeGlobalThreadPool(int capacity) {
   std::shared_ptr<ThreadPool> pool;
-  DCHECK_OK(ThreadPool::Make(ThreadPool::DefaultCapacity(), &pool));
+  DCHECK_OK(ThreadPool::Make(capacity, &pool));
   // On Windows, the global ThreadPool destructor may be called after
   // non-main threads have been killed by the OS, and hang in a condition
   // variable.
@@ -297,11 +634,24 @@ std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
   return pool;
 }
 
+std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
+  return MakeGlobalThreadPool(ThreadPool::DefaultCapacity());
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::MakeIOThreadPool() {
+  return MakeGlobalThreadPool(ThreadPool::DefaultIOCapacity());
+}
+
 ThreadPool* GetCpuThreadPool() {
   static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeCpuThreadPool();
   return singleton.get();
 }
 
+ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeIOThreadPool();
+  return singleton.get();
+}
+
 }  // namespace internal
 
 int GetCpuThreadPoolCapacity() { return internal::GetCpuThreadPool()->GetCapacity(); }
@@ -310,4 +660,10 @@ Status SetCpuThreadPoolCapacity(int threads) {
   return internal::GetCpuThreadPool()->SetCapacity(threads);
 }
 
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace arrow
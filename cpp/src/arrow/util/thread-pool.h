@@ -56,6 +56,23 @@ ARROW_EXPORT int GetCpuThreadPoolCapacity();
 /// The current number is returned by GetCpuThreadPoolCapacity().
 ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches blocking I/O operations (such as readahead), so that
+/// they don't occupy the workers of the CPU thread pool.
+///
+/// You can change this number using SetIOThreadPoolCapacity().
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// Set the number of worker threads in the thread pool to which
+/// Arrow dispatches blocking I/O operations.
+///
+/// The current number is returned by GetIOThreadPoolCapacity().
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 namespace internal {
 
 namespace detail {
@@ -77,9 +94,25 @@ struct packaged_task_wrapper {
 
 class ARROW_EXPORT ThreadPool {
  public:
+  // How tasks are dispatched to the worker threads
+  enum class Scheduler {
+    // A single FIFO queue guarded by a mutex, shared by all workers.
+    SHARED_QUEUE,
+    // A lock-free deque per worker.  Tasks spawned from a worker thread are
+    // pushed to and popped from (LIFO) its own deque without locking, idle
+    // workers steal the oldest tasks of the other deques.  Tasks spawned
+    // from other threads go through a shared FIFO queue.  This scales
+    // better with many small tasks, at the expense of FIFO ordering.
+    WORK_STEALING
+  };
+
   // Construct a thread pool with the given number of worker threads
   static Status Make(int threads, std::shared_ptr<ThreadPool>* out);
 
+  // Construct a thread pool with the given number of worker threads and
+  // task scheduler
+  static Status Make(int threads, Scheduler scheduler, std::shared_ptr<ThreadPool>* out);
+
   // Destroy thread pool; the pool will first be shut down
   ~ThreadPool();
 
@@ -97,6 +130,9 @@ class ARROW_EXPORT ThreadPool {
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
 
+  // Heuristic for the default capacity of a thread pool for I/O-bound tasks.
+  static int DefaultIOCapacity();
+
   // Shutdown the pool.  Once the pool starts shutting down, new tasks
   // cannot be submitted anymore.
   // If "wait" is true, shutdown waits for all pending tasks to be finished.
@@ -137,15 +173,18 @@ class ARROW_EXPORT ThreadPool {
  protected:
   FRIEND_TEST(TestThreadPool, SetCapacity);
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
+  FRIEND_TEST(TestGlobalThreadPool, IOCapacity);
   friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
+  friend ARROW_EXPORT ThreadPool* GetIOThreadPool();
 
   struct State;
 
-  ThreadPool();
+  explicit ThreadPool(Scheduler scheduler = Scheduler::SHARED_QUEUE);
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(ThreadPool);
 
   Status SpawnReal(std::function<void()> task);
+  Status SpawnWorkStealing(std::function<void()> task);
   // Collect finished worker threads, making sure the OS threads have exited
   void CollectFinishedWorkersUnlocked();
   // Launch a given number of additional workers
@@ -159,8 +198,12 @@ class ARROW_EXPORT ThreadPool {
   // after the ThreadPool is destroyed
   static void WorkerLoop(std::shared_ptr<State> state,
                          std::list<std::thread>::iterator it);
+  static void WorkStealingWorkerLoop(std::shared_ptr<State> state,
+                                     std::list<std::thread>::iterator it);
 
+  static std::shared_ptr<ThreadPool> MakeGlobalThreadPool(int capacity);
   static std::shared_ptr<ThreadPool> MakeCpuThreadPool();
+  static std::shared_ptr<ThreadPool> MakeIOThreadPool();
 
   std::shared_ptr<State> sp_state_;
   State* state_;
@@ -173,6 +216,9 @@ class ARROW_EXPORT ThreadPool {
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
+// Return the process-global thread pool for I/O-bound tasks.
+ARROW_EXPORT ThreadPool* GetIOThreadPool();
+
 }  // namespace internal
 }  // namespace arrow
 
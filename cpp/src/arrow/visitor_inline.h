@@ -173,7 +173,8 @@ struct ArrayDataVisitor<T, enable_if_binary<T>> {
     if (!arr.buffers[2]) {
       data = &empty_value;
     } else {
-      data = arr.GetValues<uint8_t>(2);
+      // The value offsets index the non-sliced data buffer
+      data = arr.buffers[2]->data();
     }
 
     if (arr.null_count != 0) {